@@ -244,6 +244,19 @@ Actor::recvID(ID &theID, ChannelAddress *theAddress )
 }
 
 
+int
+Actor::startBatch(void)
+{
+    return theChannel->startBatch();
+}
+
+int
+Actor::flush(void)
+{
+    return theChannel->flush();
+}
+
+
 void
 Actor::setCommitTag(int tag)
 {
@@ -92,6 +92,10 @@ class Actor
     virtual int recvID(ID &theID, 
 		       ChannelAddress *theAddress =0);  
 
+    // sends between startBatch() and flush() may leave as one message
+    int startBatch(void);
+    int flush(void);
+
     Channel 		*getChannelPtr(void) const;
     FEM_ObjectBroker 	*getObjectBrokerPtr(void) const;    
     ChannelAddress  	*getShadowsAddressPtr(void) const;            
@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <SharedMemoryAddress.h>
+
+SharedMemoryAddress::SharedMemoryAddress(const char *segmentName)
+:ChannelAddress(SHM_TYPE), name(segmentName)
+{
+
+}
+
+SharedMemoryAddress::~SharedMemoryAddress()
+{
+
+}
+
+const char *
+SharedMemoryAddress::getName() const
+{
+  return name.c_str();
+}
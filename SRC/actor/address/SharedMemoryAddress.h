@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file contains the class definition for SharedMemoryAddress.
+// It is used to encapsulate the name of the shared memory segment through
+// which a SharedMemoryChannel communicates.
+//
+// Written: cmp
+//
+#ifndef SharedMemoryAddress_h
+#define SharedMemoryAddress_h
+
+#define SHM_TYPE 3
+
+#include <string>
+#include <ChannelAddress.h>
+
+class SharedMemoryAddress: public ChannelAddress
+{
+  public:
+    SharedMemoryAddress(const char *segmentName);
+    ~SharedMemoryAddress();
+
+    const char *getName() const;
+
+  private:
+    std::string name;
+};
+
+#endif
@@ -0,0 +1,452 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// A frame is a Vector of frameSize doubles. The first entry holds the
+// number n of doubles packed after it; when n exceeds frameSize-1 the
+// rest follows in a second Vector of length n-frameSize+1. Each packed
+// item is stored as {kind, size, data...}, integers being exact in a
+// double, so the receiver can check that it reads what was sent.
+//
+// Written: cmp
+//
+#include <BatchChannel.h>
+#include <MovableObject.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <OPS_Stream.h>
+#include <Logging.h>
+
+namespace {
+  enum ItemKind {
+    MatrixItem = 1, VectorItem, IDItem
+  };
+}
+
+
+BatchChannel::BatchChannel(Channel &channel, int size)
+:theChannel(&channel), frameSize(size > 0 ? (size < 8 ? 8 : size) : 0), depth(0),
+ outAddress(nullptr), inNext(0), inEnd(0)
+{
+
+}
+
+
+BatchChannel::~BatchChannel()
+{
+  this->sendFrame();
+
+  if (inNext != inEnd)
+    opserr << "BatchChannel::~BatchChannel() - " << int(inEnd - inNext)
+           << " received values were never read\n";
+}
+
+
+char *
+BatchChannel::addToProgram()
+{
+  return theChannel->addToProgram();
+}
+
+
+int
+BatchChannel::setUpConnection()
+{
+  return theChannel->setUpConnection();
+}
+
+
+int
+BatchChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  return theChannel->setNextAddress(theAddress);
+}
+
+
+ChannelAddress *
+BatchChannel::getLastSendersAddress()
+{
+  return theChannel->getLastSendersAddress();
+}
+
+
+int
+BatchChannel::isDatastore()
+{
+  return theChannel->isDatastore();
+}
+
+
+int
+BatchChannel::getDbTag()
+{
+  return theChannel->getDbTag();
+}
+
+
+int
+BatchChannel::startBatch()
+{
+  depth++;
+  return 0;
+}
+
+
+int
+BatchChannel::flush()
+{
+  if (depth > 0)
+    depth--;
+
+  if (depth > 0)
+    return 0;
+
+  return this->sendFrame();
+}
+
+
+void
+BatchChannel::resetCounters()
+{
+  sent.clear();
+  transmitted = Counts{};
+}
+
+
+void
+BatchChannel::Print(OPS_Stream &s, int flag)
+{
+  Counts total;
+  for (const auto &entry : sent) {
+    total.messages += entry.second.messages;
+    total.bytes    += entry.second.bytes;
+  }
+
+  s << "BatchChannel: frame size " << frameSize << "\n";
+  s << "  sent " << (int)total.messages << " messages, " << (double)total.bytes << " bytes";
+  s << " in " << (int)transmitted.messages << " messages, " << (double)transmitted.bytes << " bytes\n";
+  if (flag == 1)
+    for (const auto &entry : sent)
+      s << "  commitTag " << entry.first << ": " << (int)entry.second.messages
+        << " messages, " << (double)entry.second.bytes << " bytes\n";
+}
+
+
+//
+// true if an item of size doubles is packed into a frame rather than
+// sent directly; both ends decide this from the size alone
+//
+bool
+BatchChannel::isPacked(int size) const
+{
+  return frameSize > 0 && size + 3 <= frameSize;
+}
+
+
+double *
+BatchChannel::pack(int kind, int size, int commitTag, long bytes, ChannelAddress *theAddress)
+{
+  Counts &count = sent[commitTag];
+  count.messages++;
+  count.bytes += bytes;
+
+  if (out.empty())
+    out.push_back(0.0);
+  outAddress = theAddress;
+
+  const std::size_t start = out.size();
+  out.resize(start + 2 + size);
+  out[start]   = kind;
+  out[start+1] = size;
+  return out.data() + start + 2;
+}
+
+
+int
+BatchChannel::sendFrame()
+{
+  if (out.size() <= 1)
+    return 0;
+
+  out[0] = double(out.size() - 1);
+  if (out.size() < (std::size_t)frameSize)
+    out.resize(frameSize, 0.0);
+
+  int res = 0;
+  Vector head(out.data(), frameSize);
+  if (theChannel->sendVector(0, 0, head, outAddress) < 0)
+    res = -1;
+  transmitted.messages++;
+  transmitted.bytes += frameSize*sizeof(double);
+
+  if (out.size() > (std::size_t)frameSize) {
+    const int rest = int(out.size()) - frameSize;
+    Vector tail(out.data() + frameSize, rest);
+    if (theChannel->sendVector(0, 0, tail, outAddress) < 0)
+      res = -1;
+    transmitted.messages++;
+    transmitted.bytes += rest*sizeof(double);
+  }
+
+  out.clear();
+  if (res != 0)
+    opserr << "BatchChannel::flush() - failed to send a frame\n";
+  return res;
+}
+
+
+int
+BatchChannel::receiveFrame(ChannelAddress *theAddress)
+{
+  in.resize(frameSize);
+  Vector head(in.data(), frameSize);
+  if (theChannel->recvVector(0, 0, head, theAddress) < 0) {
+    opserr << "BatchChannel - failed to receive a frame\n";
+    inNext = inEnd = 0;
+    return -1;
+  }
+
+  const std::size_t n = (std::size_t)in[0];
+  if (n + 1 > (std::size_t)frameSize) {
+    in.resize(n + 1);
+    Vector tail(in.data() + frameSize, int(n + 1) - frameSize);
+    if (theChannel->recvVector(0, 0, tail, theAddress) < 0) {
+      opserr << "BatchChannel - failed to receive a frame\n";
+      inNext = inEnd = 0;
+      return -1;
+    }
+  }
+
+  inNext = 1;
+  inEnd  = n + 1;
+  return 0;
+}
+
+
+const double *
+BatchChannel::unpack(int kind, int size, ChannelAddress *theAddress)
+{
+  // requests and replies alternate, so whatever is pending goes first
+  if (this->sendFrame() != 0)
+    return nullptr;
+
+  if (inNext == inEnd && this->receiveFrame(theAddress) != 0)
+    return nullptr;
+
+  if (inNext + 2 > inEnd || int(in[inNext]) != kind || int(in[inNext+1]) != size
+      || inNext + 2 + size > inEnd) {
+    opserr << "BatchChannel - received data does not match the object being received\n";
+    // the rest of the frame cannot be trusted either
+    inNext = inEnd;
+    return nullptr;
+  }
+
+  const double *data = in.data() + inNext + 2;
+  inNext += 2 + size;
+  return data;
+}
+
+
+//
+// flush what is pending ahead of an object sent through the wrapped channel
+//
+int
+BatchChannel::direct(int commitTag, long bytes)
+{
+  Counts &count = sent[commitTag];
+  count.messages++;
+  count.bytes += bytes;
+  transmitted.messages++;
+  transmitted.bytes += bytes;
+
+  return this->sendFrame();
+}
+
+
+bool
+BatchChannel::checkDirect(const char *method)
+{
+  if (this->sendFrame() != 0)
+    return false;
+
+  if (inNext != inEnd) {
+    opserr << "BatchChannel::" << method << "() - " << int(inEnd - inNext)
+           << " values of the last frame were not read\n";
+    inNext = inEnd;
+    return false;
+  }
+  return true;
+}
+
+
+int
+BatchChannel::sendObj(int commitTag, MovableObject &theObject, ChannelAddress *theAddress)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+
+int
+BatchChannel::recvObj(int commitTag, MovableObject &theObject,
+                      FEM_ObjectBroker &theBroker, ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int
+BatchChannel::sendMsg(int dbTag, int commitTag, const Message &theMessage, ChannelAddress *theAddress)
+{
+  if (this->direct(commitTag, theMessage.length) != 0)
+    return -1;
+  return theChannel->sendMsg(dbTag, commitTag, theMessage, theAddress);
+}
+
+
+int
+BatchChannel::recvMsg(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  if (!this->checkDirect("recvMsg"))
+    return -1;
+  return theChannel->recvMsg(dbTag, commitTag, theMessage, theAddress);
+}
+
+
+int
+BatchChannel::recvMsgUnknownSize(int dbTag, int commitTag, Message &theMessage, ChannelAddress *theAddress)
+{
+  if (!this->checkDirect("recvMsgUnknownSize"))
+    return -1;
+  return theChannel->recvMsgUnknownSize(dbTag, commitTag, theMessage, theAddress);
+}
+
+
+int
+BatchChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  const int nr = theMatrix.noRows();
+  const int nc = theMatrix.noCols();
+  const long bytes = long(nr)*nc*sizeof(double);
+
+  if (!isPacked(nr*nc)) {
+    if (this->direct(commitTag, bytes) != 0)
+      return -1;
+    return theChannel->sendMatrix(dbTag, commitTag, theMatrix, theAddress);
+  }
+
+  double *data = this->pack(MatrixItem, nr*nc, commitTag, bytes, theAddress);
+  for (int j=0; j<nc; j++)
+    for (int i=0; i<nr; i++)
+      *data++ = theMatrix(i,j);
+
+  return depth == 0 ? this->sendFrame() : 0;
+}
+
+
+int
+BatchChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  const int nr = theMatrix.noRows();
+  const int nc = theMatrix.noCols();
+
+  if (!isPacked(nr*nc)) {
+    if (!this->checkDirect("recvMatrix"))
+      return -1;
+    return theChannel->recvMatrix(dbTag, commitTag, theMatrix, theAddress);
+  }
+
+  const double *data = this->unpack(MatrixItem, nr*nc, theAddress);
+  if (data == nullptr)
+    return -1;
+
+  for (int j=0; j<nc; j++)
+    for (int i=0; i<nr; i++)
+      theMatrix(i,j) = *data++;
+  return 0;
+}
+
+
+int
+BatchChannel::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+  const int n = theVector.Size();
+  const long bytes = long(n)*sizeof(double);
+
+  if (!isPacked(n)) {
+    if (this->direct(commitTag, bytes) != 0)
+      return -1;
+    return theChannel->sendVector(dbTag, commitTag, theVector, theAddress);
+  }
+
+  double *data = this->pack(VectorItem, n, commitTag, bytes, theAddress);
+  for (int i=0; i<n; i++)
+    data[i] = theVector(i);
+
+  return depth == 0 ? this->sendFrame() : 0;
+}
+
+
+int
+BatchChannel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+  const int n = theVector.Size();
+
+  if (!isPacked(n)) {
+    if (!this->checkDirect("recvVector"))
+      return -1;
+    return theChannel->recvVector(dbTag, commitTag, theVector, theAddress);
+  }
+
+  const double *data = this->unpack(VectorItem, n, theAddress);
+  if (data == nullptr)
+    return -1;
+
+  for (int i=0; i<n; i++)
+    theVector(i) = data[i];
+  return 0;
+}
+
+
+int
+BatchChannel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+  const int n = theID.Size();
+  const long bytes = long(n)*sizeof(int);
+
+  if (!isPacked(n)) {
+    if (this->direct(commitTag, bytes) != 0)
+      return -1;
+    return theChannel->sendID(dbTag, commitTag, theID, theAddress);
+  }
+
+  double *data = this->pack(IDItem, n, commitTag, bytes, theAddress);
+  for (int i=0; i<n; i++)
+    data[i] = theID(i);
+
+  return depth == 0 ? this->sendFrame() : 0;
+}
+
+
+int
+BatchChannel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+  const int n = theID.Size();
+
+  if (!isPacked(n)) {
+    if (!this->checkDirect("recvID"))
+      return -1;
+    return theChannel->recvID(dbTag, commitTag, theID, theAddress);
+  }
+
+  const double *data = this->unpack(IDItem, n, theAddress);
+  if (data == nullptr)
+    return -1;
+
+  for (int i=0; i<n; i++)
+    theID(i) = int(data[i]);
+  return 0;
+}
@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file contains the class definition for BatchChannel.
+// BatchChannel wraps another Channel and coalesces small sends to the
+// same peer into one packed frame. Sends issued between startBatch() and
+// flush() are buffered and leave as a single message at the flush; sends
+// outside a batch are framed and sent immediately. A pending batch is
+// also flushed before any receive, so request/reply exchanges cannot
+// deadlock. Vectors, Matrices and IDs too large to share a frame, and
+// all Messages, are passed to the wrapped channel directly.
+//
+// Both ends of a connection must be wrapped with the same frame size.
+// Every send is counted by commitTag, together with the number of
+// messages and bytes that actually went through the wrapped channel.
+//
+// Written: cmp
+//
+#ifndef BatchChannel_h
+#define BatchChannel_h
+
+#include <map>
+#include <vector>
+#include <Channel.h>
+
+class OPS_Stream;
+
+class BatchChannel : public Channel
+{
+  public:
+    struct Counts {
+      long messages = 0;
+      long bytes    = 0;
+    };
+
+    // frameSize is the number of doubles in a frame; 0 only counts the
+    // traffic and passes every send straight through
+    BatchChannel(Channel &theChannel, int frameSize = 64);
+    ~BatchChannel();
+
+    char *addToProgram();
+    int setUpConnection();
+    int setNextAddress(const ChannelAddress &theAddress);
+    ChannelAddress *getLastSendersAddress();
+
+    int isDatastore();
+    int getDbTag();
+
+    int startBatch();
+    int flush();
+
+    int sendObj(int commitTag,
+                MovableObject &theObject,
+                ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+                MovableObject &theObject,
+                FEM_ObjectBroker &theBroker,
+                ChannelAddress *theAddress =0);
+
+    int sendMsg(int dbTag, int commitTag,
+                const Message &,
+                ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+                Message &,
+                ChannelAddress *theAddress =0);
+    int recvMsgUnknownSize(int dbTag, int commitTag,
+                Message &,
+                ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+                   const Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+                   Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+                   const Vector &theVector,
+                   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+                   Vector &theVector,
+                   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+               const ID &theID,
+               ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+               ID &theID,
+               ChannelAddress *theAddress =0);
+
+    Channel *getChannel() const {return theChannel;};
+
+    // traffic seen by the wrapper, by commitTag, and the messages that
+    // actually went through the wrapped channel
+    const std::map<int, Counts> &getSent() const {return sent;};
+    const Counts &getTransmitted() const {return transmitted;};
+    void resetCounters();
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    bool    isPacked(int size) const;
+    double *pack(int kind, int size, int commitTag, long bytes, ChannelAddress *theAddress);
+    const double *unpack(int kind, int size, ChannelAddress *theAddress);
+    int     sendFrame();
+    int     receiveFrame(ChannelAddress *theAddress);
+    int     direct(int commitTag, long bytes);
+    bool    checkDirect(const char *method);
+
+    Channel *theChannel;
+    int frameSize;
+    int depth;                   // number of open batches
+
+    std::vector<double> out;     // pending frame; out[0] holds its length
+    ChannelAddress *outAddress;
+    std::vector<double> in;      // last frame received
+    std::size_t inNext, inEnd;
+
+    std::map<int, Counts> sent;
+    Counts transmitted;
+};
+
+#endif
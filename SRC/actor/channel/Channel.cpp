@@ -68,6 +68,18 @@ Channel::getTag(void)
 		return tag;
 }
 
+int
+Channel::startBatch(void)
+{
+  return 0;
+}
+
+int
+Channel::flush(void)
+{
+  return 0;
+}
+
 int
 Channel::recvMsgUnknownSize(int dataTag, int commitTag, Message &, ChannelAddress *theAddress)
 {
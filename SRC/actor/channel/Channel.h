@@ -62,6 +62,11 @@ class Channel
     virtual int isDatastore(void);
     virtual int getDbTag(void);
     int getTag(void);
+
+    // sends between startBatch() and flush() may be held back and sent
+    // together at the flush; by default every send goes out at once
+    virtual int startBatch(void);
+    virtual int flush(void);
     
     // methods to send/receive messages and objects on channels.
     virtual int sendObj(int commitTag,
@@ -0,0 +1,280 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// The processes sharing an equation are found through a home process,
+// the equation number modulo the number of processes: every process sends
+// its equation numbers to their homes, and each home replies to the
+// holders of an equation with the other processes holding it. This takes
+// two all-to-all exchanges whose volume is proportional to the local
+// number of equations, rather than every process broadcasting its list.
+//
+// Written: cmp
+//
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <MPI_NeighborExchange.h>
+#include <Logging.h>
+
+namespace {
+  const int exchangeTag = 3011;
+
+  //
+  // send data[...] in blocks of sendCounts to every process and return
+  // what is received, in increasing order of the process it came from
+  //
+  int allToAll(MPI_Comm comm, const std::vector<int> &data, const std::vector<int> &sendCounts,
+               std::vector<int> &received, std::vector<int> &recvCounts)
+  {
+    const int size = (int)sendCounts.size();
+    recvCounts.assign(size, 0);
+    if (MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm) != MPI_SUCCESS)
+      return -1;
+
+    std::vector<int> sendDispl(size, 0), recvDispl(size, 0);
+    for (int i=1; i<size; i++) {
+      sendDispl[i] = sendDispl[i-1] + sendCounts[i-1];
+      recvDispl[i] = recvDispl[i-1] + recvCounts[i-1];
+    }
+    received.resize(size > 0 ? recvDispl[size-1] + recvCounts[size-1] : 0);
+
+    if (MPI_Alltoallv(data.data(), sendCounts.data(), sendDispl.data(), MPI_INT,
+                      received.data(), recvCounts.data(), recvDispl.data(), MPI_INT,
+                      comm) != MPI_SUCCESS)
+      return -1;
+    return 0;
+  }
+}
+
+
+MPI_NeighborExchange::MPI_NeighborExchange(MPI_Comm c)
+  :comm(c), rank(0), offsets(1, 0), numActive(0)
+{
+  MPI_Comm_rank(comm, &rank);
+}
+
+
+MPI_NeighborExchange::~MPI_NeighborExchange()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (numActive > 0 && !finalized)
+    MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+
+int
+MPI_NeighborExchange::setUp(const int *dofs, int numDOF)
+{
+  if (numActive > 0) {
+    opserr << "MPI_NeighborExchange::setUp() - an exchange is still in progress\n";
+    return -1;
+  }
+
+  int size;
+  MPI_Comm_size(comm, &size);
+  MPI_Comm_rank(comm, &rank);
+
+  neighbors.clear();
+  offsets.assign(1, 0);
+  positions.clear();
+  shared.clear();
+  sharedIndex.assign(numDOF, -1);
+  owned.clear();
+
+  //
+  // send each equation number to its home
+  //
+  std::vector<int> sendCounts(size, 0);
+  for (int i=0; i<numDOF; i++) {
+    if (dofs[i] < 0) {
+      opserr << "MPI_NeighborExchange::setUp() - negative equation number " << dofs[i] << "\n";
+      return -2;
+    }
+    sendCounts[dofs[i] % size]++;
+  }
+
+  std::vector<int> next(size, 0);
+  for (int p=1; p<size; p++)
+    next[p] = next[p-1] + sendCounts[p-1];
+
+  std::vector<int> data(numDOF);
+  for (int i=0; i<numDOF; i++)
+    data[next[dofs[i] % size]++] = dofs[i];
+
+  std::vector<int> homed, homedCounts;
+  if (allToAll(comm, data, sendCounts, homed, homedCounts) != 0) {
+    opserr << "MPI_NeighborExchange::setUp() - failed to send the equation numbers\n";
+    return -3;
+  }
+
+  // the processes holding each equation, in increasing order
+  std::unordered_map<int, std::vector<int>> holders;
+  for (int p=0, k=0; p<size; p++)
+    for (int j=0; j<homedCounts[p]; j++)
+      holders[homed[k++]].push_back(p);
+
+  //
+  // tell every holder of a shared equation who else holds it
+  //
+  std::vector<std::vector<int>> replies(size);
+  for (int p=0, k=0; p<size; p++)
+    for (int j=0; j<homedCounts[p]; j++) {
+      const int dof = homed[k++];
+      for (int other : holders[dof])
+        if (other != p) {
+          replies[p].push_back(dof);
+          replies[p].push_back(other);
+        }
+    }
+  holders.clear();
+
+  data.clear();
+  for (int p=0; p<size; p++) {
+    sendCounts[p] = (int)replies[p].size();
+    data.insert(data.end(), replies[p].begin(), replies[p].end());
+  }
+  replies.clear();
+
+  std::vector<int> pairs, pairCounts;
+  if (allToAll(comm, data, sendCounts, pairs, pairCounts) != 0) {
+    opserr << "MPI_NeighborExchange::setUp() - failed to send the shared equations\n";
+    return -3;
+  }
+
+  //
+  // both sides of a neighbor pair list their common entries in increasing
+  // equation order, so the messages need carry no equation numbers
+  //
+  std::map<int, std::vector<int>> common;
+  for (std::size_t k=0; k+1<pairs.size(); k+=2)
+    common[pairs[k+1]].push_back(pairs[k]);
+
+  std::unordered_map<int, int> location;
+  location.reserve(numDOF);
+  for (int i=0; i<numDOF; i++)
+    location[dofs[i]] = i;
+
+  for (auto &entry : common) {
+    std::sort(entry.second.begin(), entry.second.end());
+    neighbors.push_back(entry.first);
+    for (int dof : entry.second) {
+      const int loc = location[dof];
+      positions.push_back(loc);
+      sharedIndex[loc] = 0;
+    }
+    offsets.push_back((int)positions.size());
+  }
+
+  for (int i=0; i<numDOF; i++)
+    if (sharedIndex[i] == 0) {
+      sharedIndex[i] = (int)shared.size();
+      shared.push_back(i);
+    }
+
+  owned.assign(shared.size(), 1);
+  for (std::size_t n=0; n<neighbors.size() && neighbors[n] < rank; n++)
+    for (int j=offsets[n]; j<offsets[n+1]; j++)
+      owned[sharedIndex[positions[j]]] = 0;
+
+  return 0;
+}
+
+
+int
+MPI_NeighborExchange::start(const double *const *values, int numVectors)
+{
+  if (numActive > 0) {
+    opserr << "MPI_NeighborExchange::start() - the previous exchange has not been finished\n";
+    return -1;
+  }
+  if (numVectors < 1)
+    return 0;
+
+  const int numShared = (int)shared.size();
+  own.resize((std::size_t)numVectors*numShared);
+  for (int v=0; v<numVectors; v++)
+    for (int k=0; k<numShared; k++)
+      own[v*numShared + k] = values[v][shared[k]];
+
+  // the entries for a neighbor are contiguous, one vector after the other
+  sendData.resize((std::size_t)numVectors*positions.size());
+  recvData.resize(sendData.size());
+  const int numNeighbors = (int)neighbors.size();
+  for (int n=0; n<numNeighbors; n++) {
+    const int count = offsets[n+1] - offsets[n];
+    double *data = sendData.data() + (std::size_t)numVectors*offsets[n];
+    for (int v=0; v<numVectors; v++)
+      for (int j=0; j<count; j++)
+        *data++ = values[v][positions[offsets[n] + j]];
+  }
+
+  requests.resize(2*numNeighbors);
+  int res = MPI_SUCCESS;
+  for (int n=0; n<numNeighbors && res == MPI_SUCCESS; n++)
+    res = MPI_Irecv(recvData.data() + (std::size_t)numVectors*offsets[n],
+                    numVectors*(offsets[n+1] - offsets[n]), MPI_DOUBLE,
+                    neighbors[n], exchangeTag, comm, &requests[n]);
+  for (int n=0; n<numNeighbors && res == MPI_SUCCESS; n++)
+    res = MPI_Isend(sendData.data() + (std::size_t)numVectors*offsets[n],
+                    numVectors*(offsets[n+1] - offsets[n]), MPI_DOUBLE,
+                    neighbors[n], exchangeTag, comm, &requests[numNeighbors + n]);
+
+  if (res != MPI_SUCCESS) {
+    opserr << "MPI_NeighborExchange::start() - failed to post the exchange\n";
+    return -2;
+  }
+
+  numActive = numVectors;
+  return 0;
+}
+
+
+int
+MPI_NeighborExchange::finish(double *const *sums)
+{
+  if (numActive == 0) {
+    opserr << "MPI_NeighborExchange::finish() - no exchange has been started\n";
+    return -1;
+  }
+
+  const int numVectors = numActive;
+  numActive = 0;
+  if (MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
+    opserr << "MPI_NeighborExchange::finish() - failed to complete the exchange\n";
+    return -2;
+  }
+
+  const int numShared = (int)shared.size();
+  for (int v=0; v<numVectors; v++)
+    for (int k=0; k<numShared; k++)
+      sums[v][k] = 0.0;
+
+  // the own contribution goes in between the lower and higher neighbors
+  bool ownAdded = false;
+  auto addOwn = [&]() {
+    for (int v=0; v<numVectors; v++)
+      for (int k=0; k<numShared; k++)
+        sums[v][k] += own[v*numShared + k];
+    ownAdded = true;
+  };
+
+  const int numNeighbors = (int)neighbors.size();
+  for (int n=0; n<numNeighbors; n++) {
+    if (!ownAdded && neighbors[n] > rank)
+      addOwn();
+
+    const int count = offsets[n+1] - offsets[n];
+    const double *data = recvData.data() + (std::size_t)numVectors*offsets[n];
+    for (int v=0; v<numVectors; v++)
+      for (int j=0; j<count; j++)
+        sums[v][sharedIndex[positions[offsets[n] + j]]] += *data++;
+  }
+  if (!ownAdded)
+    addOwn();
+
+  return 0;
+}
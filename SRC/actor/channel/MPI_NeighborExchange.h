@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file contains the class definition for MPI_NeighborExchange.
+// An MPI_NeighborExchange sums the contributions that several processes
+// make to the same global equations, exchanging only the entries on the
+// interface between them and only with the processes that share them.
+//
+// setUp() is given the global equation numbers of the local entries and
+// finds, once, which processes share each of them. After that, start()
+// posts nonblocking sends and receives of the interface entries of one or
+// more local arrays and returns at once, so the caller can go on with work
+// that does not touch the interface; finish() waits for the messages and
+// returns the totals. Every process adds the contributions to an entry in
+// increasing process order, so all of them obtain the same total bit for
+// bit. All processes of the communicator must take part in setUp().
+//
+// Written: cmp
+//
+#ifndef MPI_NeighborExchange_h
+#define MPI_NeighborExchange_h
+
+#include <mpi.h>
+#include <vector>
+
+class MPI_NeighborExchange
+{
+  public:
+    MPI_NeighborExchange(MPI_Comm comm = MPI_COMM_WORLD);
+    ~MPI_NeighborExchange();
+
+    // dofs(i) is the global equation number of local entry i
+    int setUp(const int *dofs, int numDOF);
+
+    int getNumNeighbors() const {return (int)neighbors.size();};
+    int getNumShared() const    {return (int)shared.size();};
+
+    // the local entries on the interface, in increasing order, and the
+    // index in that list of local entry loc, or -1 if it is interior
+    const std::vector<int> &getShared() const {return shared;};
+    int getSharedIndex(int loc) const {return sharedIndex[loc];};
+
+    // true if this is the lowest ranked process holding the k'th
+    // interface entry, so that a global sum can count each entry once
+    bool ownsShared(int k) const {return owned[k] != 0;};
+
+    // values[v] are numVectors local arrays; the totals are written to
+    // sums[v][k] for the k'th interface entry. The same numVectors must
+    // be used by all processes.
+    int start(const double *const *values, int numVectors);
+    int finish(double *const *sums);
+    bool isActive() const {return numActive > 0;};
+
+  private:
+    MPI_Comm comm;
+    int rank;
+
+    std::vector<int> neighbors;     // ranks, in increasing order
+    std::vector<int> offsets;       // entries shared with neighbors[n] are
+    std::vector<int> positions;     // positions[offsets[n]...offsets[n+1]-1]
+    std::vector<int> shared;
+    std::vector<int> sharedIndex;
+    std::vector<char> owned;
+
+    int numActive;                  // vectors in flight, 0 if none
+    std::vector<double> own;
+    std::vector<double> sendData, recvData;
+    std::vector<MPI_Request> requests;
+};
+
+#endif
@@ -0,0 +1,441 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <SharedMemoryChannel.h>
+#include <SharedMemoryAddress.h>
+#include <MovableObject.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <Logging.h>
+
+namespace {
+  constexpr std::uint64_t segmentMagic = 0x4f50534d454d3031; // "OPSMEM01"
+
+  // seconds to wait for the other end to create or attach to the segment
+  constexpr int connectTimeout = 60;
+
+  enum FrameType : std::int32_t {
+    MessageFrame = 1, MatrixFrame, VectorFrame, IDFrame
+  };
+
+  struct Frame {
+    std::int32_t  type;
+    std::int32_t  pad;
+    std::uint64_t size;
+  };
+
+  // spin briefly, then yield, then sleep while waiting on the other end
+  inline void
+  backoff(int &count)
+  {
+    if (++count < 256)
+      ;
+    else if (count < 1024)
+      std::this_thread::yield();
+    else
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+}
+
+struct SharedMemoryChannel::Ring {
+  alignas(64) std::atomic<std::uint64_t> head; // bytes written by the producer
+  alignas(64) std::atomic<std::uint64_t> tail; // bytes consumed by the consumer
+};
+
+// The segment holds this header followed by the data of ring[0], written
+// by the creator, and the data of ring[1], written by the other end.
+struct SharedMemoryChannel::Segment {
+  std::atomic<std::uint64_t> magic;
+  std::uint64_t              capacity;
+  std::atomic<int>           attached;
+  Ring                       ring[2];
+};
+
+
+SharedMemoryChannel::SharedMemoryChannel(const char *segmentName, bool create, std::size_t size)
+:name(segmentName[0] == '/' ? segmentName : std::string("/") + segmentName),
+ creator(create), connected(false),
+ capacity(std::max<std::size_t>(size, 4096)), mappedSize(0),
+ segment(nullptr), sendRing(nullptr), recvRing(nullptr), program(nullptr)
+{
+
+}
+
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+  if (segment != nullptr)
+    munmap((void *)segment, mappedSize);
+
+  if (creator && segment != nullptr && !connected)
+    shm_unlink(name.c_str());
+
+  if (program != nullptr)
+    delete [] program;
+}
+
+
+char *
+SharedMemoryChannel::addToProgram()
+{
+  if (program == nullptr) {
+    std::string args = " -shm " + name;
+    program = new char[args.size() + 1];
+    strcpy(program, args.c_str());
+  }
+  return program;
+}
+
+
+int
+SharedMemoryChannel::open()
+{
+  if (segment != nullptr)
+    return 0;
+
+  int fd = -1;
+  if (creator) {
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+      opserr << "SharedMemoryChannel::open() - could not create segment " << name.c_str()
+             << " - " << strerror(errno) << "\n";
+      return -1;
+    }
+
+    mappedSize = sizeof(Segment) + 2*capacity;
+    if (ftruncate(fd, mappedSize) != 0) {
+      opserr << "SharedMemoryChannel::open() - could not size segment " << name.c_str() << "\n";
+      close(fd);
+      shm_unlink(name.c_str());
+      return -1;
+    }
+
+  } else {
+    // wait for the creator to make the segment and set its size
+    struct stat status;
+    for (int count = 0; ; backoff(count)) {
+      if (fd < 0)
+        fd = shm_open(name.c_str(), O_RDWR, 0);
+      if (fd >= 0 && fstat(fd, &status) == 0 && status.st_size > (off_t)sizeof(Segment))
+        break;
+      if (count > connectTimeout*20000) {
+        opserr << "SharedMemoryChannel::open() - segment " << name.c_str() << " not found\n";
+        if (fd >= 0)
+          close(fd);
+        return -1;
+      }
+    }
+    mappedSize = status.st_size;
+  }
+
+  void *address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    opserr << "SharedMemoryChannel::open() - could not map segment " << name.c_str() << "\n";
+    if (creator)
+      shm_unlink(name.c_str());
+    return -1;
+  }
+
+  if (creator) {
+    segment = new (address) Segment;
+    segment->capacity = capacity;
+    segment->attached.store(0, std::memory_order_relaxed);
+    for (Ring &ring : segment->ring) {
+      ring.head.store(0, std::memory_order_relaxed);
+      ring.tail.store(0, std::memory_order_relaxed);
+    }
+    segment->magic.store(segmentMagic, std::memory_order_release);
+    sendRing = &segment->ring[0];
+    recvRing = &segment->ring[1];
+
+  } else {
+    segment = static_cast<Segment *>(address);
+    for (int count = 0; segment->magic.load(std::memory_order_acquire) != segmentMagic; backoff(count))
+      ;
+    capacity = segment->capacity;
+    sendRing = &segment->ring[1];
+    recvRing = &segment->ring[0];
+  }
+
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::setUpConnection()
+{
+  if (connected)
+    return 0;
+
+  if (this->open() != 0)
+    return -1;
+
+  // wait for the other end
+  segment->attached.fetch_add(1, std::memory_order_acq_rel);
+  for (int count = 0; segment->attached.load(std::memory_order_acquire) < 2; backoff(count))
+    if (count > connectTimeout*20000) {
+      opserr << "SharedMemoryChannel::setUpConnection() - no process attached to "
+             << name.c_str() << "\n";
+      return -1;
+    }
+
+  // both ends hold a mapping, so the name is no longer needed
+  if (creator)
+    shm_unlink(name.c_str());
+
+  connected = true;
+  return 0;
+}
+
+
+bool
+SharedMemoryChannel::checkAddress(const ChannelAddress *theAddress, const char *method) const
+{
+  if (theAddress == nullptr)
+    return true;
+
+  if (theAddress->getType() != SHM_TYPE) {
+    opserr << "SharedMemoryChannel::" << method << "() - a SharedMemoryChannel "
+           << "can only communicate with a SharedMemoryChannel\n";
+    return false;
+  }
+
+  if (name != ((const SharedMemoryAddress *)theAddress)->getName()) {
+    opserr << "SharedMemoryChannel::" << method << "() - a SharedMemoryChannel "
+           << "can only communicate through its own segment\n";
+    return false;
+  }
+  return true;
+}
+
+
+int
+SharedMemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  return this->checkAddress(&theAddress, "setNextAddress") ? 0 : -1;
+}
+
+
+void
+SharedMemoryChannel::write(Ring &ring, const char *data, std::size_t size)
+{
+  char *buffer = (char *)segment + sizeof(Segment) + (&ring - segment->ring)*capacity;
+
+  std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+  while (size > 0) {
+    std::uint64_t space;
+    for (int count = 0;
+         (space = capacity - (head - ring.tail.load(std::memory_order_acquire))) == 0;
+         backoff(count))
+      ;
+
+    const std::size_t start = head % capacity;
+    const std::size_t chunk = std::min<std::size_t>({size, space, capacity - start});
+    memcpy(buffer + start, data, chunk);
+    head += chunk;
+    ring.head.store(head, std::memory_order_release);
+    data += chunk;
+    size -= chunk;
+  }
+}
+
+
+void
+SharedMemoryChannel::read(Ring &ring, char *data, std::size_t size)
+{
+  const char *buffer = (char *)segment + sizeof(Segment) + (&ring - segment->ring)*capacity;
+
+  std::uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+  while (size > 0) {
+    std::uint64_t available;
+    for (int count = 0;
+         (available = ring.head.load(std::memory_order_acquire) - tail) == 0;
+         backoff(count))
+      ;
+
+    const std::size_t start = tail % capacity;
+    const std::size_t chunk = std::min<std::size_t>({size, available, capacity - start});
+    // a null destination discards the data
+    if (data != nullptr) {
+      memcpy(data, buffer + start, chunk);
+      data += chunk;
+    }
+    tail += chunk;
+    ring.tail.store(tail, std::memory_order_release);
+    size -= chunk;
+  }
+}
+
+
+int
+SharedMemoryChannel::send(int type, const void *data, std::size_t size)
+{
+  if (!connected && this->setUpConnection() != 0)
+    return -1;
+
+  Frame frame {type, 0, size};
+  this->write(*sendRing, (const char *)&frame, sizeof(Frame));
+  this->write(*sendRing, (const char *)data, size);
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::recv(int type, void *data, std::size_t size, std::size_t *received)
+{
+  if (!connected && this->setUpConnection() != 0)
+    return -1;
+
+  Frame frame;
+  this->read(*recvRing, (char *)&frame, sizeof(Frame));
+
+  if (frame.type != type || (received == nullptr && frame.size != size)) {
+    opserr << "SharedMemoryChannel::recv() - expected " << (int)size << " bytes of type " << type
+           << " but received " << (int)frame.size << " bytes of type " << frame.type << "\n";
+    this->read(*recvRing, nullptr, frame.size);
+    return -1;
+  }
+
+  // a message of unknown size is truncated to the space available
+  const std::size_t length = std::min<std::size_t>(size, frame.size);
+  this->read(*recvRing, (char *)data, length);
+  this->read(*recvRing, nullptr, frame.size - length);
+
+  if (received != nullptr)
+    *received = frame.size;
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::sendObj(int commitTag, MovableObject &theObject, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "sendObj"))
+    return -1;
+
+  return theObject.sendSelf(commitTag, *this);
+}
+
+
+int
+SharedMemoryChannel::recvObj(int commitTag, MovableObject &theObject,
+                             FEM_ObjectBroker &theBroker, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "recvObj"))
+    return -1;
+
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int
+SharedMemoryChannel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "sendMsg"))
+    return -1;
+
+  return this->send(MessageFrame, msg.data, msg.length);
+}
+
+
+int
+SharedMemoryChannel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "recvMsg"))
+    return -1;
+
+  return this->recv(MessageFrame, msg.data, msg.length);
+}
+
+
+int
+SharedMemoryChannel::recvMsgUnknownSize(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "recvMsgUnknownSize"))
+    return -1;
+
+  std::size_t received;
+  return this->recv(MessageFrame, msg.data, msg.length, &received);
+}
+
+
+int
+SharedMemoryChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "sendMatrix"))
+    return -1;
+
+  return this->send(MatrixFrame, theMatrix.data, theMatrix.dataSize*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "recvMatrix"))
+    return -1;
+
+  return this->recv(MatrixFrame, theMatrix.data, theMatrix.dataSize*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "sendVector"))
+    return -1;
+
+  return this->send(VectorFrame, theVector.theData, theVector.sz*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "recvVector"))
+    return -1;
+
+  return this->recv(VectorFrame, theVector.theData, theVector.sz*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "sendID"))
+    return -1;
+
+  return this->send(IDFrame, theID.data, theID.sz*sizeof(int));
+}
+
+
+int
+SharedMemoryChannel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+  if (!this->checkAddress(theAddress, "recvID"))
+    return -1;
+
+  return this->recv(IDFrame, theID.data, theID.sz*sizeof(int));
+}
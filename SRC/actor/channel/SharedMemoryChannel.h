@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file contains the class definition for SharedMemoryChannel.
+// SharedMemoryChannel is a sub-class of Channel connecting two processes
+// on the same host through a POSIX shared memory segment. The segment
+// holds a single-producer/single-consumer ring buffer for each direction.
+// The data of a Vector, Matrix, ID or Message is copied directly between
+// its storage and the mapped ring, without system calls, kernel buffers
+// or intermediate serialization. Payloads larger than the ring are
+// streamed through it while the receiver drains it.
+//
+// The process that creates the segment calls open() or setUpConnection()
+// first; the other attaches to it by name. Once both ends are connected
+// the name is unlinked, so the segment is released when both processes
+// exit.
+//
+// Written: cmp
+//
+#ifndef SharedMemoryChannel_h
+#define SharedMemoryChannel_h
+
+#include <string>
+#include <cstddef>
+#include <Channel.h>
+
+class SharedMemoryChannel : public Channel
+{
+  public:
+    SharedMemoryChannel(const char *segmentName, bool create,
+                        std::size_t capacity = 1 << 22);
+    ~SharedMemoryChannel();
+
+    char *addToProgram();
+
+    int open();
+    int setUpConnection();
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    ChannelAddress *getLastSendersAddress() {return 0;};
+
+    int sendObj(int commitTag,
+                MovableObject &theObject,
+                ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+                MovableObject &theObject,
+                FEM_ObjectBroker &theBroker,
+                ChannelAddress *theAddress =0);
+
+    int sendMsg(int dbTag, int commitTag,
+                const Message &,
+                ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+                Message &,
+                ChannelAddress *theAddress =0);
+    int recvMsgUnknownSize(int dbTag, int commitTag,
+                Message &,
+                ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+                   const Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+                   Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+                   const Vector &theVector,
+                   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+                   Vector &theVector,
+                   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+               const ID &theID,
+               ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+               ID &theID,
+               ChannelAddress *theAddress =0);
+
+  private:
+    struct Segment;
+    struct Ring;
+
+    int  send(int type, const void *data, std::size_t size);
+    int  recv(int type, void *data, std::size_t size, std::size_t *received = nullptr);
+    void write(Ring &ring, const char *data, std::size_t size);
+    void read(Ring &ring, char *data, std::size_t size);
+    bool checkAddress(const ChannelAddress *theAddress, const char *method) const;
+
+    std::string name;
+    bool creator;
+    bool connected;
+    std::size_t capacity;
+    std::size_t mappedSize;
+    Segment *segment;
+    Ring *sendRing;
+    Ring *recvRing;
+    char *program;
+};
+
+#endif
@@ -29,14 +29,17 @@
 #include <OPS_Globals.h>
 #include <ID.h>
 #include <Channel.h>
+#include <BatchChannel.h>
 
 #include <Actor.h>
 #include <FEM_ObjectBroker.h>
 
 #include <OPS_Globals.h>
+#include <OPS_Stream.h>
 
 MachineBroker::MachineBroker(FEM_ObjectBroker *theBroker)
-  :theObjectBroker(theBroker), actorChannels(0), numActorChannels(0), numActiveChannels(0), activeChannels(0)
+  :theObjectBroker(theBroker), actorChannels(0), actorBatches(0), batchFrameSize(-1),
+   numActorChannels(0), numActiveChannels(0), activeChannels(0)
 {
 
 }
@@ -44,6 +47,10 @@ MachineBroker::MachineBroker(FEM_ObjectBroker *theBroker)
 MachineBroker::~MachineBroker()
 {  
   if (actorChannels != 0) {
+    for (int i=0; i<numActorChannels; i++)
+      if (actorBatches[i] != 0)
+        delete actorBatches[i];
+    delete [] actorBatches;
     delete [] actorChannels;
     delete activeChannels;
   }  
@@ -57,7 +64,12 @@ MachineBroker::shutdown(void)
   if (actorChannels != 0) {
 
     for (int i=0; i<numActorChannels; i++) {
-      ID idData(1);
+      if (actorBatches[i] != 0) {
+        delete actorBatches[i];
+        actorBatches[i] = 0;
+      }
+
+      ID idData(2);
       idData(0) = 0;
       Channel *theChannel = actorChannels[i];
       if (theChannel->sendID(0, 0, idData) < 0) {
@@ -72,8 +84,10 @@ MachineBroker::shutdown(void)
     }
     
     
+    delete [] actorBatches;
     delete [] actorChannels;
     delete activeChannels;
+    actorBatches = 0;
     actorChannels = 0;
     activeChannels = 0;
     numActorChannels = 0;
@@ -94,7 +108,8 @@ MachineBroker::runActors(void)
     return -1;    
   }
 
-  ID idData(1);
+  // the actor type and the frame size of its BatchChannel, if any
+  ID idData(2);
   int done = 0;
 
   // loop until recv kill signal
@@ -119,8 +134,14 @@ MachineBroker::runActors(void)
 
     } else {
 
+      // the shadow wraps its end after the reply below, and so do we
+      BatchChannel *theBatch = 0;
+      if (idData(1) > 0)
+        theBatch = new BatchChannel(*theChannel, idData(1));
+
       // create an actor of approriate type
-      Actor *theActor = theObjectBroker->getNewActor(actorType, theChannel);
+      Actor *theActor = theObjectBroker->getNewActor(actorType,
+                          theBatch != 0 ? (Channel *)theBatch : theChannel);
       if (theActor == 0) {
 	opserr << "MachineBroker::run(void) - invalid actor type\n";
 	idData(0) = 1;
@@ -133,12 +154,15 @@ MachineBroker::runActors(void)
       }
 	 
       // run the actor object
-      if (theActor->run() != 0) {
+      if (theActor != 0 && theActor->run() != 0) {
 	opserr << "MachineBroker::run(void) - actor failed while running\n";
       }  
 	 
       // destroying theActor
-      delete theActor;
+      if (theActor != 0)
+        delete theActor;
+      if (theBatch != 0)
+        delete theBatch;
     }
     done = 0;
   }
@@ -154,6 +178,7 @@ MachineBroker::startActor(int actorType, int compDemand)
     opserr << "MachineBroker::startActor() - does not take computational demand variable into account\n";
 
   Channel *theChannel = 0;
+  int slot = -1;
 
   // check if have an available machine broker running runActors() and waiting to start an actor running
   if (numActiveChannels < numActorChannels) {
@@ -162,6 +187,7 @@ MachineBroker::startActor(int actorType, int compDemand)
 	theChannel = actorChannels[i];
 	numActiveChannels++;
 	(*activeChannels)(i) = 1;
+	slot = i;
 	i=numActorChannels;
       }
     }
@@ -178,31 +204,38 @@ MachineBroker::startActor(int actorType, int compDemand)
     }
 
     Channel **nextChannels = new Channel *[numActorChannels +1];
+    BatchChannel **nextBatches = new BatchChannel *[numActorChannels +1];
     ID *nextChannelID = new ID(numActorChannels+1);
     for (int i=0; i<numActorChannels; i++) {
       nextChannels[i] = actorChannels[i];
+      nextBatches[i] = actorBatches[i];
       (*nextChannelID)(i) = (*activeChannels)(i);
     }
 
     nextChannels[numActorChannels] = theChannel;
+    nextBatches[numActorChannels] = 0;
     (*nextChannelID)(numActorChannels) = 0;    
 
     // clean up old memory
     if (actorChannels != 0) {
       delete [] actorChannels;
+      delete [] actorBatches;
       delete activeChannels;
     }
 
     // reset the arrays
     actorChannels = nextChannels;
+    actorBatches = nextBatches;
     activeChannels = nextChannelID;    
+    slot = numActorChannels;
     numActorChannels++;
     numActiveChannels++;    
   }
 
   // now that we have a channel to a machine broker waiting to run some actor processes, start the actor
-  ID idData(1);
+  ID idData(2);
   idData(0) = actorType;
+  idData(1) = batchFrameSize;
   if (theChannel->sendID(0, 0, idData) != 0) {
     opserr << "MachineBroker::startActor() - failed to send actorType\n";
     this->freeProcess(theChannel);
@@ -220,7 +253,17 @@ MachineBroker::startActor(int actorType, int compDemand)
     this->freeProcess(theChannel);
     return 0;    
   }
- 
+
+  // a slot reused for a new actor starts with new counters
+  if (actorBatches[slot] != 0) {
+    delete actorBatches[slot];
+    actorBatches[slot] = 0;
+  }
+  if (batchFrameSize >= 0) {
+    actorBatches[slot] = new BatchChannel(*theChannel, batchFrameSize);
+    return actorBatches[slot];
+  }
+
   return theChannel;
 }
 
@@ -230,7 +273,8 @@ MachineBroker::finishedWithActor(Channel *theChannel)
 	
   // send the termination notice to all machineBrokers running actorProcesses
   for (int i=0; i<numActorChannels; i++) {
-    if (theChannel == actorChannels[i]) {
+    if (theChannel == actorChannels[i] || theChannel == actorBatches[i]) {
+      theChannel->flush();
       numActiveChannels--;
       (*activeChannels)(i) = 0;
       return 0;
@@ -246,3 +290,19 @@ MachineBroker::setObjectBroker(FEM_ObjectBroker *theBroker)
 {
   theObjectBroker = theBroker;
 }
+
+void
+MachineBroker::setChannelBatching(int frameSize)
+{
+  batchFrameSize = frameSize < 0 ? -1 : frameSize;
+}
+
+void
+MachineBroker::Print(OPS_Stream &s, int flag)
+{
+  for (int i=0; i<numActorChannels; i++)
+    if (actorBatches[i] != 0) {
+      s << "actor channel " << i << ", ";
+      actorBatches[i]->Print(s, flag);
+    }
+}
@@ -37,8 +37,10 @@
 #define MachineBroker_h
 
 class Channel;
+class BatchChannel;
 class FEM_ObjectBroker;
 class ID;
+class OPS_Stream;
 
 class MachineBroker
 {
@@ -63,6 +65,11 @@ class MachineBroker
     
     void setObjectBroker(FEM_ObjectBroker *theBroker);
 
+    // channels to actors started from now on are wrapped in a BatchChannel
+    // with the given frame size; 0 only counts messages, < 0 turns it off
+    void setChannelBatching(int frameSize);
+    void Print(OPS_Stream &s, int flag = 0);
+
     /* ************ THE OLD INTERFACE ***************
     virtual int startActor(char *actorProgram, 
 			   Channel &theChannel,
@@ -75,6 +82,8 @@ class MachineBroker
     FEM_ObjectBroker *theObjectBroker;
 
     Channel **actorChannels; // channels owned with running actor processes
+    BatchChannel **actorBatches; // and the BatchChannel wrapping each, if any
+    int batchFrameSize;
     int numActorChannels;
     int numActiveChannels;
     ID *activeChannels;
@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <string>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <SharedMemoryMachineBroker.h>
+#include <SharedMemoryChannel.h>
+#include <Logging.h>
+
+
+SharedMemoryMachineBroker::SharedMemoryMachineBroker(FEM_ObjectBroker *theBroker,
+                                                     int numProcesses,
+                                                     std::size_t capacity)
+  :MachineBroker(theBroker), rank(0), size(1), myChannel(nullptr)
+{
+  const std::string prefix = "/opensees-" + std::to_string((long)getpid()) + "-";
+
+  for (int i=1; i<numProcesses; i++) {
+    const std::string name = prefix + std::to_string(i);
+
+    // the segment is created before forking so the child can attach at once
+    SharedMemoryChannel *theChannel = new SharedMemoryChannel(name.c_str(), true, capacity);
+    if (theChannel->open() != 0) {
+      opserr << "SharedMemoryMachineBroker - could not create channel " << name.c_str() << "\n";
+      delete theChannel;
+      break;
+    }
+
+    pid_t child = fork();
+    if (child < 0) {
+      opserr << "SharedMemoryMachineBroker - could not start process " << i << "\n";
+      delete theChannel;
+      break;
+
+    } else if (child == 0) {
+      // the channels of the primary process are inherited but not ours to use
+      channels.clear();
+      children.clear();
+      rank = i;
+      size = numProcesses;
+      myChannel = new SharedMemoryChannel(name.c_str(), false, capacity);
+      if (myChannel->setUpConnection() != 0)
+        opserr << "SharedMemoryMachineBroker - process " << i << " failed to connect\n";
+      return;
+    }
+
+    channels.push_back(theChannel);
+    children.push_back(child);
+  }
+
+  size = (int)channels.size() + 1;
+  usedChannels.assign(channels.size(), false);
+
+  for (SharedMemoryChannel *theChannel : channels)
+    if (theChannel->setUpConnection() != 0)
+      opserr << "SharedMemoryMachineBroker - failed to connect to a secondary process\n";
+}
+
+
+SharedMemoryMachineBroker::~SharedMemoryMachineBroker()
+{
+  if (rank == 0) {
+    // stop any secondary process still running actors
+    this->shutdown();
+
+    for (SharedMemoryChannel *theChannel : channels)
+      delete theChannel;
+
+    // secondary processes that never ran an actor are still waiting for
+    // one, so they are given a moment to finish and are then terminated
+    for (int count = 0; count < 100; count++) {
+      bool running = false;
+      for (pid_t &child : children)
+        if (child > 0) {
+          int status;
+          if (waitpid(child, &status, WNOHANG) == child)
+            child = 0;
+          else
+            running = true;
+        }
+      if (!running)
+        break;
+      usleep(10000);
+    }
+    for (pid_t child : children)
+      if (child > 0) {
+        int status;
+        kill(child, SIGTERM);
+        waitpid(child, &status, 0);
+      }
+
+  } else if (myChannel != nullptr)
+    delete myChannel;
+}
+
+
+int
+SharedMemoryMachineBroker::getPID()
+{
+  return rank;
+}
+
+
+int
+SharedMemoryMachineBroker::getNP()
+{
+  return size;
+}
+
+
+Channel *
+SharedMemoryMachineBroker::getMyChannel()
+{
+  return myChannel;
+}
+
+
+Channel *
+SharedMemoryMachineBroker::getRemoteProcess()
+{
+  if (rank != 0) {
+    opserr << "SharedMemoryMachineBroker::getRemoteProcess() - child process cannot not yet allocate processes\n";
+    return nullptr;
+  }
+
+  for (std::size_t i=0; i<channels.size(); i++)
+    if (!usedChannels[i]) {
+      usedChannels[i] = true;
+      return channels[i];
+    }
+
+  // no processes available
+  return nullptr;
+}
+
+
+int
+SharedMemoryMachineBroker::freeProcess(Channel *theChannel)
+{
+  for (std::size_t i=0; i<channels.size(); i++)
+    if (channels[i] == theChannel) {
+      usedChannels[i] = false;
+      return 0;
+    }
+
+  // channel not found!
+  return -1;
+}
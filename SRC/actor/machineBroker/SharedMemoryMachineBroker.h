@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file contains the class definition for
+// SharedMemoryMachineBroker. SharedMemoryMachineBroker is a MachineBroker
+// that runs numProcesses processes on one host. The constructor forks
+// numProcesses-1 secondary processes, each connected to the primary
+// process (pid 0) by a SharedMemoryChannel. As with the MPI_MachineBroker,
+// every process returns from the constructor and is told apart by
+// getPID(); secondary processes typically call runActors().
+//
+// MPI is not started, so the broker only suits programs whose processes
+// talk through the channels of the broker alone, such as the actors of
+// OpenSeesSP. Code that calls MPI directly, like the send, recv and
+// barrier commands of OpenSeesMP and the MPI based solvers, cannot run
+// with it.
+//
+// Written: cmp
+//
+#ifndef SharedMemoryMachineBroker_h
+#define SharedMemoryMachineBroker_h
+
+#include <vector>
+#include <cstddef>
+#include <sys/types.h>
+#include <MachineBroker.h>
+
+class SharedMemoryChannel;
+
+class SharedMemoryMachineBroker : public MachineBroker
+{
+  public:
+    SharedMemoryMachineBroker(FEM_ObjectBroker *theBroker, int numProcesses,
+                              std::size_t channelCapacity = 1 << 22);
+    ~SharedMemoryMachineBroker();
+
+    int getPID();
+    int getNP();
+
+    Channel *getMyChannel();
+    Channel *getRemoteProcess();
+    int freeProcess(Channel *);
+
+  private:
+    int rank;
+    int size;
+    SharedMemoryChannel *myChannel;              // secondary: channel to pid 0
+    std::vector<SharedMemoryChannel *> channels; // primary: channel to pid i+1
+    std::vector<bool>  usedChannels;
+    std::vector<pid_t> children;
+};
+
+#endif
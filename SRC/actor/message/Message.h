@@ -51,6 +51,8 @@ class Message
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class SharedMemoryChannel;
+    friend class BatchChannel;
     friend class MPI_Channel;
     
   private:
@@ -44,6 +44,8 @@
 #include "graph/numberer/RCM.h"
 #include "graph/numberer/MyRCM.h"
 #include "graph/numberer/SimpleNumberer.h"
+#include "graph/numberer/ThreadedRCM.h"
+#include "graph/numberer/NestedDissection.h"
 
 
 // uniaxial material model header files
@@ -756,6 +758,14 @@ FEM_ObjectBrokerAllClasses::getPtrNewGraphNumberer(int classTag)
 	     return new SimpleNumberer();				
 	     
 	     
+	case GraphNUMBERER_TAG_ThreadedRCM:  
+	     return new ThreadedRCM();
+	     
+	     
+	case GraphNUMBERER_TAG_NestedDissection:  
+	     return new NestedDissection();
+	     
+	     
 	default:
 	     opserr << "ObjectBrokerAllClasses::getPtrNewGraphNumberer - ";
 	     opserr << " - no GraphNumberer type exists for class tag " ;
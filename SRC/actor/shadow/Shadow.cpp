@@ -169,6 +169,19 @@ Shadow::setCommitTag(int tag)
 }
 
 
+int
+Shadow::startBatch(void)
+{
+    return theChannel->startBatch();
+}
+
+int
+Shadow::flush(void)
+{
+    return theChannel->flush();
+}
+
+
 Channel *
 Shadow::getChannelPtr(void) const
 {
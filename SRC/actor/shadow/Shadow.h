@@ -77,6 +77,10 @@ class Shadow
     virtual int recvID(ID &theID);      
     void setCommitTag(int commitTag);
 
+    // sends between startBatch() and flush() may leave as one message
+    int startBatch(void);
+    int flush(void);
+
     Channel 		  *getChannelPtr(void) const;
     FEM_ObjectBroker 	  *getObjectBrokerPtr(void) const;        
     ChannelAddress        *getActorAddressPtr(void) const;
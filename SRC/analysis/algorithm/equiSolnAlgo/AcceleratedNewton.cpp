@@ -37,11 +37,13 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <TangentReuse.h>
 #include <Matrix.h>
 #include <Vector.h>
 #include <ID.h>
 
 #include <fstream>
+#include <logging/Profiler.h>
 
 // Constructor
 AcceleratedNewton::AcceleratedNewton(int theTangentToUse)
@@ -131,15 +133,25 @@ AcceleratedNewton::solveCurrentStep(void)
     return -2;
   }
 
-  // Evaluate system Jacobian J = R'(y)|y_0
-  if (theIntegrator->formTangent(tangent) < 0){
-    opserr << "WARNING AcceleratedNewton::solveCurrentStep() - ";
-    opserr << "the Integrator failed in formTangent()\n";
-    return -1;
-  }
+  if (theReuse != nullptr)
+    theReuse->startStep(*theAnaModel, *theSOE);
+
+  // Evaluate system Jacobian J = R'(y)|y_0, unless the one factored in
+  // an earlier step still contracts well
+  if (theReuse == nullptr || !theReuse->reuse()) {
+    if (theIntegrator->formTangent(tangent) < 0){
+      opserr << "WARNING AcceleratedNewton::solveCurrentStep() - ";
+      opserr << "the Integrator failed in formTangent()\n";
+      if (theReuse != nullptr)
+        theReuse->invalidate();
+      return -1;
+    }
   
-  // Count factorization of the first tangent
-  numFactorizations++;
+    // Count factorization of the first tangent
+    numFactorizations++;
+    if (theReuse != nullptr)
+      theReuse->formed();
+  }
   
   // set itself as the ConvergenceTest objects EquiSolnAlgo
   theTest->setEquiSolnAlgo(*this);
@@ -161,6 +173,8 @@ AcceleratedNewton::solveCurrentStep(void)
     if (theSOE->solve() < 0) {
       opserr << "WARNING AcceleratedNewton::solveCurrentStep() - ";
       opserr << "the LinearSysOfEqn failed in solve()\n";        
+      if (theReuse != nullptr)
+        theReuse->invalidate();
       return -3;
     }
 //    solveTimer.pause();
@@ -198,10 +212,16 @@ AcceleratedNewton::solveCurrentStep(void)
       return -2;
     }
 
+    if (theReuse != nullptr)
+      theReuse->residual(*theSOE);
+
     numIterations++;
 
     // Check convergence criteria
-    result = theTest->test();
+    {
+      OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+      result = theTest->test();
+    }
 
     if (result == -1) {
       // Let the accelerator update the tangent if needed
@@ -212,13 +232,19 @@ AcceleratedNewton::solveCurrentStep(void)
           opserr << "the Accelerator failed in updateTangent()\n";
           return -1;
         }
-        if (ret > 0)
+        if (ret > 0) {
           numFactorizations++;
+          if (theReuse != nullptr)
+            theReuse->formed();
+        }
       }
     }
     this->record(k++);
 
   }  while (result == ConvergenceTest::Continue);
+
+  if (theReuse != nullptr)
+    theReuse->endStep(result != ConvergenceTest::Failure);
  
   if (result == ConvergenceTest::Failure) {
     // opserr << "AcceleratedNewton::solveCurrentStep() - ";
@@ -307,6 +333,9 @@ AcceleratedNewton::Print(OPS_Stream &s, int flag)
   s << "AcceleratedNewton" << endln;
   LinearSOE *theSOE = this->getLinearSOEptr();
   s << "\tNumber of equations: " << theSOE->getNumEqn() << endln;
+  if (theReuse != nullptr)
+    s << "\tTangent reuse ratio: " << theReuse->getMaxRatio()
+      << ", factorizations saved: " << theReuse->getNumSaved() << endln;
 
   if (theAccelerator != 0)
     theAccelerator->Print(s,flag);
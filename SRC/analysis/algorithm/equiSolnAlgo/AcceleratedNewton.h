@@ -52,6 +52,7 @@ class AcceleratedNewton: public EquiSolnAlgo
   
   int getNumFactorizations(void) {return numFactorizations;}
   int getNumIterations(void) {return numIterations;}
+  bool canReuseTangent(void) const {return true;}
   //double getTotalTimeCPU(void)   {return totalTimeCPU;}
   //double getTotalTimeReal(void)  {return totalTimeReal;}
   //double getSolveTimeCPU(void)   {return solveTimeCPU;}
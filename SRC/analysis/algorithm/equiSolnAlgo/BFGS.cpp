@@ -30,6 +30,7 @@
 #include <ConvergenceTest.h>
 #include <ID.h>
 #include <elementAPI.h>
+#include <logging/Profiler.h>
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_BFGS)
@@ -343,11 +344,17 @@ BFGS::solveCurrentStep(void)
         if (theIntegrator->formUnbalance() < 0)
           return SolutionAlgorithm::BadFormResidual;
 
-        result = localTest->test(); 
+        {
+          OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+          result = localTest->test();
+        }
         
       } while (result == ConvergenceTest::Continue && nBFGS <= numberLoops);
 
-      result = theTest->test();
+      {
+        OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+        result = theTest->test();
+      }
 
       this->record(count++);
 
@@ -34,6 +34,7 @@
 #include <ID.h>
 #include <math.h>
 #include <elementAPI.h>
+#include <logging/Profiler.h>
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_Broyden)
@@ -326,12 +327,18 @@ Broyden::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";        
         }            
         
-        result = localTest->test() ;
+        {
+          OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+          result = localTest->test();
+        }
         
       } while ( result == -1 && nBroyden <= numberLoops );
 
 
-      result = theTest->test();
+      {
+        OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+        result = theTest->test();
+      }
       this->record(count++);
 
     } while (result == ConvergenceTest::Continue);
@@ -528,7 +535,10 @@ Broyden::Print(OPS_Stream &s, int flag)
             return -2;
         }        
         
-        result = theTest->test();
+        {
+          OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+          result = theTest->test();
+        }
         this->record(nBroyden++);
 
       const Vector &du = BroydengetX( theIntegrator, theSOE, nBroyden )  ;
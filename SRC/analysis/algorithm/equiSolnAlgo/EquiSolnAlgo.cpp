@@ -44,17 +44,19 @@
 #include <IncrementalIntegrator.h>
 #include <LinearSOE.h>
 #include <ConvergenceTest.h>
+#include <TangentReuse.h>
 
 EquiSolnAlgo::EquiSolnAlgo(int clasTag)
 :SolutionAlgorithm(clasTag),
- theModel(0), theIntegrator(0), theSysOfEqn(0), theTest(0)
+ theModel(0), theIntegrator(0), theSysOfEqn(0), theTest(0), theReuse(nullptr)
 {
 
 }
 
 EquiSolnAlgo::~EquiSolnAlgo()
 {
-
+  if (theReuse != nullptr)
+    delete theReuse;
 }
 
 void 
@@ -68,6 +70,10 @@ EquiSolnAlgo::setLinks(AnalysisModel &theNewModel,
     theSysOfEqn = &theSOE;
     theTest = theConvergenceTest;
 
+    // the factorization in a new SOE is not known to the algorithm
+    if (theReuse != nullptr)
+      theReuse->invalidate();
+
     this->setConvergenceTest(theConvergenceTest);
 }
 
@@ -86,6 +92,35 @@ EquiSolnAlgo::getConvergenceTest(void)
 }
 
 
+int
+EquiSolnAlgo::setTangentReuse(double maxRatio, int maxSteps)
+{
+  if (maxRatio > 0.0 && !this->canReuseTangent()) {
+    opserr << "WARNING EquiSolnAlgo::setTangentReuse() - the algorithm does not reuse the tangent\n";
+    return -1;
+  }
+
+  if (theReuse != nullptr) {
+    delete theReuse;
+    theReuse = nullptr;
+  }
+
+  if (maxRatio > 0.0)
+    theReuse = new TangentReuse(maxRatio, maxSteps);
+
+  return 0;
+}
+
+
+int
+EquiSolnAlgo::getNumFactorizationsSaved(void)
+{
+  if (theReuse == nullptr)
+    return 0;
+  return theReuse->getNumSaved();
+}
+
+
 
 
 AnalysisModel *
@@ -37,6 +37,7 @@
 class AnalysisModel;
 class LinearSOE;
 class ConvergenceTest;
+class TangentReuse;
 
 class EquiSolnAlgo: public SolutionAlgorithm
 {
@@ -55,10 +56,19 @@ class EquiSolnAlgo: public SolutionAlgorithm
     virtual int setConvergenceTest(ConvergenceTest *theNewTest);    
     virtual ConvergenceTest *getConvergenceTest(void);     
 
+    // keep the factored tangent across iterations and steps while the
+    // residual contracts by maxRatio, for at most maxSteps steps if > 0;
+    // a maxRatio <= 0 forms the tangent as the algorithm would. Fails
+    // for an algorithm that does not consult the policy.
+    int setTangentReuse(double maxRatio, int maxSteps = 0);
+    virtual bool canReuseTangent(void) const {return false;}
+
     virtual void Print(OPS_Stream &s, int flag =0) =0;    
 
     virtual int getNumFactorizations(void) {return 0;}
     virtual int getNumIterations(void) {return 0;}
+    virtual int getNumResidualEvaluations(void) {return 0;}
+    int getNumFactorizationsSaved(void);
     virtual double getTotalTimeCPU(void)   {return 0.0;}
     virtual double getTotalTimeReal(void)  {return 0.0;}
     virtual double getSolveTimeCPU(void)   {return 0.0;}
@@ -74,6 +84,7 @@ class EquiSolnAlgo: public SolutionAlgorithm
 
   protected:
     ConvergenceTest *theTest;
+    TangentReuse    *theReuse;    // null unless tangent reuse is enabled
     
   private:
     AnalysisModel           *theModel;
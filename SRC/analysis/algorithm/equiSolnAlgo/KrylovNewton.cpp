@@ -39,6 +39,7 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <ID.h>
+#include <logging/Profiler.h>
 
 // Constructor
 KrylovNewton::KrylovNewton(int theTangentToUse, int maxDim)
@@ -202,7 +203,10 @@ KrylovNewton::solveCurrentStep(void)
     // Increase current dimension of Krylov subspace
     dim++;
 
-    result = theTest->test();
+    {
+      OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+      result = theTest->test();
+    }
     this->record(k++);
 
   }  while (result == ConvergenceTest::Continue);
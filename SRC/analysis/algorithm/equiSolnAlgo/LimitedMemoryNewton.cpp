@@ -0,0 +1,399 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// LimitedMemoryNewton.
+//
+// Written: cmp
+//
+#include <LimitedMemoryNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <ConvergenceTest.h>
+#include <TangentReuse.h>
+#include <Channel.h>
+#include <classTags.h>
+#include <logging/Profiler.h>
+#include <math.h>
+
+namespace {
+
+double
+dot(const double *a, const double *b, int n)
+{
+  double sum = 0.0;
+  for (int i=0; i<n; i++)
+    sum += a[i]*b[i];
+  return sum;
+}
+
+// solves the symmetric positive definite system A x = b of order n in
+// place by Cholesky, returning -1 if A is not numerically positive
+int
+solveSPD(double *A, double *b, int n)
+{
+  for (int j=0; j<n; j++) {
+    double d = A[j*n+j];
+    for (int k=0; k<j; k++)
+      d -= A[j*n+k]*A[j*n+k];
+    if (d <= 0.0)
+      return -1;
+    d = sqrt(d);
+    A[j*n+j] = d;
+    for (int i=j+1; i<n; i++) {
+      double s = A[i*n+j];
+      for (int k=0; k<j; k++)
+        s -= A[i*n+k]*A[j*n+k];
+      A[i*n+j] = s/d;
+    }
+  }
+
+  for (int i=0; i<n; i++) {
+    for (int k=0; k<i; k++)
+      b[i] -= A[i*n+k]*b[k];
+    b[i] /= A[i*n+i];
+  }
+  for (int i=n-1; i>=0; i--) {
+    for (int k=i+1; k<n; k++)
+      b[i] -= A[k*n+i]*b[k];
+    b[i] /= A[i*n+i];
+  }
+  return 0;
+}
+
+}
+
+
+LimitedMemoryNewton::LimitedMemoryNewton(int theMethod, int dim, double ratio, int theTangent)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_LimitedMemoryNewton),
+ method(theMethod), maxDim(dim > 0 ? dim : 0), tangent(theTangent),
+ numEqn(0), numPairs(0), newest(0), havePrevious(false),
+ numFactorizations(0), numIterations(0)
+{
+  this->setTangentReuse(ratio);
+}
+
+
+LimitedMemoryNewton::~LimitedMemoryNewton()
+{
+
+}
+
+
+int
+LimitedMemoryNewton::formTangent(IncrementalIntegrator &theIntegrator)
+{
+  SOLUTION_ALGORITHM_tangentFlag = tangent;
+  if (theIntegrator.formTangent(tangent) < 0) {
+    opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - ";
+    opserr << "the Integrator failed in formTangent()\n";
+    if (theReuse != nullptr)
+      theReuse->invalidate();
+    return -1;
+  }
+
+  numFactorizations++;
+  if (theReuse != nullptr)
+    theReuse->formed();
+
+  // the mixing works on K^-1 R, which changes with K
+  if (method == Anderson)
+    this->clearHistory();
+
+  return 0;
+}
+
+
+void
+LimitedMemoryNewton::clearHistory(void)
+{
+  numPairs = 0;
+  newest = maxDim - 1;
+  havePrevious = false;
+}
+
+
+int
+LimitedMemoryNewton::solveCurrentStep(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModelPtr();
+  IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+  LinearSOE *theSOE = this->getLinearSOEptr();
+
+  if ((theModel == nullptr) || (theIntegrator == nullptr)
+      || (theSOE == nullptr) || (theTest == nullptr)) {
+    opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - setLinks() has";
+    opserr << " not been called - or no ConvergenceTest has been set\n";
+    return SolutionAlgorithm::BadAlgorithm;
+  }
+
+  const int n = theSOE->getNumEqn();
+  if (n != numEqn) {
+    numEqn = n;
+    dU.assign((std::size_t)numEqn*maxDim, 0.0);
+    dR.assign((std::size_t)numEqn*maxDim, 0.0);
+    rho.assign(maxDim, 0.0);
+    gram.assign((std::size_t)maxDim*maxDim, 0.0);
+    system.assign((std::size_t)maxDim*maxDim, 0.0);
+    coeff.assign(maxDim, 0.0);
+    direction.resize(numEqn);
+    previous.resize(numEqn);
+  }
+  this->clearHistory();
+
+  if (theIntegrator->formUnbalance() < 0) {
+    opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - ";
+    opserr << "the Integrator failed in formUnbalance()\n";
+    return SolutionAlgorithm::BadFormResidual;
+  }
+
+  // the factorization kept from the last step is used while it contracts
+  // the residual, see TangentReuse
+  if (theReuse != nullptr)
+    theReuse->startStep(*theModel, *theSOE);
+
+  if (theReuse == nullptr || !theReuse->reuse()) {
+    if (this->formTangent(*theIntegrator) < 0)
+      return SolutionAlgorithm::BadFormTangent;
+  }
+
+  theTest->setEquiSolnAlgo(*this);
+  if (theTest->start() < 0) {
+    opserr << "LimitedMemoryNewton::solveCurrentStep() - ";
+    opserr << "the ConvergenceTest object failed in start()\n";
+    return SolutionAlgorithm::BadTestStart;
+  }
+
+  int result = -1;
+  numIterations = 0;
+  do {
+    if (this->formDirection(*theSOE) < 0) {
+      if (theReuse != nullptr)
+        theReuse->invalidate();
+      return SolutionAlgorithm::BadLinearSolve;
+    }
+
+    if (theIntegrator->update(direction) < 0) {
+      opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - ";
+      opserr << "the Integrator failed in update()\n";
+      return SolutionAlgorithm::BadStepUpdate;
+    }
+
+    if (theIntegrator->formUnbalance() < 0) {
+      opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - ";
+      opserr << "the Integrator failed in formUnbalance()\n";
+      return SolutionAlgorithm::BadFormResidual;
+    }
+
+    if (theReuse != nullptr)
+      theReuse->residual(*theSOE);
+
+    numIterations++;
+
+    {
+      OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+      result = theTest->test();
+    }
+    this->record(numIterations);
+
+    // fall back on a fresh tangent when the correction stagnates; the
+    // initial tangent would factor the same matrix again and, for
+    // Anderson, discard the history that is to make up for it
+    if (result == ConvergenceTest::Continue && theReuse != nullptr
+        && tangent != INITIAL_TANGENT && theReuse->degraded()) {
+      if (this->formTangent(*theIntegrator) < 0)
+        return SolutionAlgorithm::BadFormTangent;
+    }
+
+  } while (result == ConvergenceTest::Continue);
+
+  // a failed step starts again from a fresh tangent
+  if (theReuse != nullptr)
+    theReuse->endStep(result != ConvergenceTest::Failure);
+
+  if (result == ConvergenceTest::Failure)
+    return SolutionAlgorithm::TestFailed;
+
+  return result;
+}
+
+
+int
+LimitedMemoryNewton::formDirection(LinearSOE &theSOE)
+{
+  const int n = numEqn;
+
+  if (method == LBFGS) {
+    const Vector &R = theSOE.getB();
+
+    // pair of the last iteration: dU = the increment, dR = R_prev - R,
+    // kept while the curvature dR.dU is positive
+    if (havePrevious && maxDim > 0) {
+      const int slot = (newest + 1) % maxDim;
+      double *s = &dU[(std::size_t)slot*n];
+      double *y = &dR[(std::size_t)slot*n];
+      for (int i=0; i<n; i++) {
+        s[i] = direction(i);
+        y[i] = previous(i) - R(i);
+      }
+      const double ys = dot(y, s, n);
+      if (ys > 1.0e-12*sqrt(dot(y, y, n)*dot(s, s, n))) {
+        rho[slot] = 1.0/ys;
+        newest = slot;
+        if (numPairs < maxDim)
+          numPairs++;
+      } else if (numPairs == maxDim) {
+        // the slot held the oldest pair
+        numPairs--;
+      }
+    }
+    previous = R;
+    havePrevious = true;
+
+    // two-loop recursion with K^-1 for the initial inverse
+    direction = R;
+    double *q = &direction(0);
+    for (int j=0; j<numPairs; j++) {
+      const int slot = (newest - j + maxDim) % maxDim;
+      const double *s = &dU[(std::size_t)slot*n];
+      const double *y = &dR[(std::size_t)slot*n];
+      const double a = rho[slot]*dot(s, q, n);
+      coeff[slot] = a;
+      for (int i=0; i<n; i++)
+        q[i] -= a*y[i];
+    }
+
+    if (numPairs > 0)
+      theSOE.setB(direction);
+    if (theSOE.solve() < 0) {
+      opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - ";
+      opserr << "the LinearSysOfEqn failed in solve()\n";
+      return -1;
+    }
+    direction = theSOE.getX();
+    double *r = &direction(0);
+    for (int j=numPairs-1; j>=0; j--) {
+      const int slot = (newest - j + maxDim) % maxDim;
+      const double *s = &dU[(std::size_t)slot*n];
+      const double *y = &dR[(std::size_t)slot*n];
+      const double b = coeff[slot] - rho[slot]*dot(y, r, n);
+      for (int i=0; i<n; i++)
+        r[i] += b*s[i];
+    }
+
+  } else {
+    if (theSOE.solve() < 0) {
+      opserr << "WARNING LimitedMemoryNewton::solveCurrentStep() - ";
+      opserr << "the LinearSysOfEqn failed in solve()\n";
+      return -1;
+    }
+    const Vector &f = theSOE.getX();
+
+    // pair of the last iteration: dU = the increment, dR = f - f_prev
+    if (havePrevious && maxDim > 0) {
+      const int slot = (newest + 1) % maxDim;
+      double *s = &dU[(std::size_t)slot*n];
+      double *y = &dR[(std::size_t)slot*n];
+      for (int i=0; i<n; i++) {
+        s[i] = direction(i);
+        y[i] = f(i) - previous(i);
+      }
+      newest = slot;
+      if (numPairs < maxDim)
+        numPairs++;
+
+      for (int j=0; j<numPairs; j++) {
+        const int other = (newest - j + maxDim) % maxDim;
+        const double g = dot(y, &dR[(std::size_t)other*n], n);
+        gram[slot*maxDim + other] = g;
+        gram[other*maxDim + slot] = g;
+      }
+    }
+    previous = f;
+    havePrevious = true;
+    direction = f;
+
+    // mixing: min |f - dR c|, then U += f - (dU + dR) c
+    if (numPairs > 0) {
+      const int m = numPairs;
+      double *A = system.data();
+      double scale = 0.0;
+      for (int i=0; i<m; i++) {
+        const int si = (newest - i + maxDim) % maxDim;
+        coeff[i] = dot(&dR[(std::size_t)si*n], &previous(0), n);
+        for (int j=0; j<m; j++)
+          A[i*m+j] = gram[si*maxDim + (newest - j + maxDim) % maxDim];
+        scale = fmax(scale, A[i*m+i]);
+      }
+      for (int i=0; i<m; i++)
+        A[i*m+i] += 1.0e-12*scale;
+
+      if (solveSPD(A, coeff.data(), m) < 0) {
+        // the differences are dependent, restart the history
+        numPairs = 0;
+      } else {
+        double *d = &direction(0);
+        for (int j=0; j<m; j++) {
+          const int slot = (newest - j + maxDim) % maxDim;
+          const double *s = &dU[(std::size_t)slot*n];
+          const double *y = &dR[(std::size_t)slot*n];
+          const double c = coeff[j];
+          for (int i=0; i<n; i++)
+            d[i] -= c*(s[i] + y[i]);
+        }
+      }
+    }
+  }
+
+  theSOE.setX(direction);
+  return 0;
+}
+
+
+int
+LimitedMemoryNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector data(4);
+  data(0) = method;
+  data(1) = maxDim;
+  data(2) = (theReuse != nullptr) ? theReuse->getMaxRatio() : 0.0;
+  data(3) = tangent;
+  return theChannel.sendVector(this->getDbTag(), cTag, data);
+}
+
+
+int
+LimitedMemoryNewton::recvSelf(int cTag, Channel &theChannel,
+                              FEM_ObjectBroker &theBroker)
+{
+  static Vector data(4);
+  int res = theChannel.recvVector(this->getDbTag(), cTag, data);
+  if (res < 0) {
+    opserr << "LimitedMemoryNewton::recvSelf() - failed to receive data\n";
+    return res;
+  }
+  method = (int)data(0);
+  maxDim = (int)data(1);
+  tangent = (int)data(3);
+  this->setTangentReuse(data(2));
+  numEqn = 0;
+  return 0;
+}
+
+
+void
+LimitedMemoryNewton::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "LimitedMemoryNewton" << (method == Anderson ? " (Anderson)" : " (L-BFGS)") << endln;
+    s << "\tMax history: " << maxDim << endln;
+    if (theReuse != nullptr)
+      s << "\tRatio for a new tangent: " << theReuse->getMaxRatio()
+        << ", factorizations saved: " << theReuse->getNumSaved() << endln;
+    s << "\tTangents formed: " << numFactorizations << endln;
+  }
+}
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: LimitedMemoryNewton is a quasi-Newton algorithm that
+// corrects the solution with a factored tangent K using the last few
+// iterates, either by the two-loop recursion of L-BFGS with K^-1 as the
+// initial inverse, or by Anderson mixing of the fixed point
+// U + K^-1 R(U). The increments and residual differences are held in
+// contiguous blocks of numEqn x maxDim, reused from step to step.
+//
+// The factorization of K is kept across steps by a TangentReuse policy.
+// It is formed again, and the history restarted where it depends on K,
+// only when the residual norm fails to drop by the factor maxRatio in an
+// iteration, or when the model or the system of equations changes.
+//
+// Written: cmp
+//
+#ifndef LimitedMemoryNewton_h
+#define LimitedMemoryNewton_h
+
+#include <vector>
+#include <EquiSolnAlgo.h>
+#include <Vector.h>
+
+class LimitedMemoryNewton: public EquiSolnAlgo
+{
+  public:
+    enum Method {
+      LBFGS    = 0,
+      Anderson = 1
+    };
+
+    LimitedMemoryNewton(int method = LBFGS, int maxDim = 8,
+                        double maxRatio = 0.5, int tangent = CURRENT_TANGENT);
+    ~LimitedMemoryNewton();
+
+    int solveCurrentStep(void);
+
+    int getNumFactorizations(void) {return numFactorizations;}
+    int getNumIterations(void) {return numIterations;}
+    bool canReuseTangent(void) const {return true;}
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+                 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+  private:
+    int formTangent(IncrementalIntegrator &theIntegrator);
+    int formDirection(LinearSOE &theSOE);
+    void clearHistory(void);
+
+    int method;
+    int maxDim;
+    int tangent;
+
+    // history, column i of each block at offset i*numEqn; slots are
+    // filled in turn and numPairs of them, ending at newest, are in use
+    int numEqn;
+    int numPairs;
+    int newest;
+    std::vector<double> dU;     // increments of U
+    std::vector<double> dR;     // L-BFGS: decrease of R, Anderson: increase of K^-1 R
+    std::vector<double> rho;    // L-BFGS: 1/(dR.dU)
+    std::vector<double> gram;   // Anderson: dR_i.dR_j, maxDim x maxDim
+    std::vector<double> system; // Anderson: the normal equations of the mixing
+    std::vector<double> coeff;  // the coefficients of the recursion or the mixing
+
+    Vector direction;           // increment applied in the iteration
+    Vector previous;            // L-BFGS: R, Anderson: K^-1 R, of the last iterate
+    bool havePrevious;
+
+    int numFactorizations;
+    int numIterations;
+};
+
+#endif
@@ -35,8 +35,10 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <TangentReuse.h>
 
 #include <elementAPI.h>
+#include <logging/Profiler.h>
 void *
 OPS_ADD_RUNTIME_VPV(OPS_ModifiedNewton)
 {
@@ -118,9 +120,13 @@ ModifiedNewton::solveCurrentStep(void)
       return SolutionAlgorithm::BadFormResidual;
     }        
 
-    SOLUTION_ALGORITHM_tangentFlag = tangent;
-    if (theIncIntegratorr->formTangent(tangent, iFactor, cFactor) < 0)
-      return SolutionAlgorithm::BadFormTangent;
+    if (theReuse != nullptr)
+      theReuse->startStep(*theAnalysisModel, *theSOE);
+
+    if (theReuse == nullptr || !theReuse->reuse()) {
+      if (this->formTangent(*theIncIntegratorr) < 0)
+        return SolutionAlgorithm::BadFormTangent;
+    }
 
 
     // set itself as the ConvergenceTest objects EquiSolnAlgo
@@ -135,8 +141,11 @@ ModifiedNewton::solveCurrentStep(void)
     int result = -1;
     numIterations = 0;
     do {
-      if (theSOE->solve() < 0)
+      if (theSOE->solve() < 0) {
+        if (theReuse != nullptr)
+          theReuse->invalidate();
         return SolutionAlgorithm::BadLinearSolve;
+      }
       
       if (theIncIntegratorr->update(theSOE->getX()) < 0)
         return SolutionAlgorithm::BadStepUpdate;
@@ -144,18 +153,51 @@ ModifiedNewton::solveCurrentStep(void)
       if (theIncIntegratorr->formUnbalance() < 0)
         return SolutionAlgorithm::BadFormResidual;
 
-      result = theTest->test();
+      if (theReuse != nullptr)
+        theReuse->residual(*theSOE);
+
+      {
+        OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+        result = theTest->test();
+      }
       numIterations++;
       this->record(numIterations);
 
+      // a tangent kept from an earlier step is replaced once it stops
+      // contracting the residual
+      if (result == ConvergenceTest::Continue && theReuse != nullptr
+          && theReuse->degraded()) {
+        if (this->formTangent(*theIncIntegratorr) < 0)
+          return SolutionAlgorithm::BadFormTangent;
+      }
+
     }  while (result == ConvergenceTest::Continue);
 
+    if (theReuse != nullptr)
+      theReuse->endStep(result != ConvergenceTest::Failure);
+
     if (result == ConvergenceTest::Failure)
       return SolutionAlgorithm::TestFailed;
 
     return result;
 }
 
+int
+ModifiedNewton::formTangent(IncrementalIntegrator &theIntegrator)
+{
+  SOLUTION_ALGORITHM_tangentFlag = tangent;
+  if (theIntegrator.formTangent(tangent, iFactor, cFactor) < 0) {
+    if (theReuse != nullptr)
+      theReuse->invalidate();
+    return -1;
+  }
+
+  if (theReuse != nullptr)
+    theReuse->formed();
+  return 0;
+}
+
+
 int
 ModifiedNewton::sendSelf(int cTag, Channel &theChannel)
 {
@@ -184,6 +226,9 @@ ModifiedNewton::Print(OPS_Stream &s, int flag)
 {
     if (flag == 0) {
         s << "ModifiedNewton";
+        if (theReuse != nullptr)
+          s << "\n\tTangent reuse ratio: " << theReuse->getMaxRatio()
+            << ", factorizations saved: " << theReuse->getNumSaved();
     }
 }
 
@@ -45,6 +45,7 @@ class ModifiedNewton: public EquiSolnAlgo
 
     int solveCurrentStep(void);    
     int getNumIterations(void);
+    bool canReuseTangent(void) const {return true;}
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -55,6 +56,8 @@ class ModifiedNewton: public EquiSolnAlgo
   protected:
     
   private:
+    int formTangent(IncrementalIntegrator &theIntegrator);
+
     int tangent;
     int numIterations;
 
@@ -34,6 +34,7 @@
 
 #include <elementAPI.h>
 #include <math.h>
+#include <logging/Profiler.h>
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_NewtonHallM)
@@ -184,7 +185,10 @@ NewtonHallM::solveCurrentStep(void)
         return -2;
       }        
       
-      result = theTest->test();
+      {
+        OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+        result = theTest->test();
+      }
       numIterations++;
       this->record(numIterations);
       
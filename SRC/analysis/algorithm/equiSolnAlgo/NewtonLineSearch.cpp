@@ -34,12 +34,14 @@
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
 #include <ID.h>
+#include <logging/Profiler.h>
 
 
 //Null Constructor
 NewtonLineSearch::NewtonLineSearch( )
 :EquiSolnAlgo(EquiALGORITHM_TAGS_NewtonLineSearch),
- theTest(0), theOtherTest(0), theLineSearch(0)
+ theTest(0), theOtherTest(0), theLineSearch(0),
+ numIterations(0), numEvaluations(0)
 {   
 }
 
@@ -48,7 +50,8 @@ NewtonLineSearch::NewtonLineSearch( )
 NewtonLineSearch::NewtonLineSearch( ConvergenceTest &theT, 
                                    LineSearch *theSearch) 
 :EquiSolnAlgo(EquiALGORITHM_TAGS_NewtonLineSearch),
- theTest(&theT), theLineSearch(theSearch)
+ theTest(&theT), theLineSearch(theSearch),
+ numIterations(0), numEvaluations(0)
 {
   theOtherTest = theTest->getCopy(10);
   theOtherTest->setEquiSolnAlgo(*this);
@@ -93,7 +96,11 @@ NewtonLineSearch::solveCurrentStep(void)
         return -5;
     }        
 
-    theLineSearch->newStep(*theSOE);
+    if (theLineSearch != 0)
+      theLineSearch->newStep(*theSOE);
+
+    numIterations = 0;
+    numEvaluations = 0;
 
     // set itself as the ConvergenceTest objects EquiSolnAlgo
     theTest->setEquiSolnAlgo(*this);
@@ -108,6 +115,7 @@ NewtonLineSearch::solveCurrentStep(void)
       opserr << "the Integrator failed in formUnbalance()\n";        
       return -2;
     }            
+    numEvaluations++;
 
     int result = -1;
     do {
@@ -147,10 +155,15 @@ NewtonLineSearch::solveCurrentStep(void)
             opserr << "the Integrator failed in formUnbalance()\n";        
             return -2;
         }        
+        numIterations++;
+        numEvaluations++;
 
         // do a line search only if convergence criteria not met
         theOtherTest->start();
-        result = theOtherTest->test();
+        {
+          OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+          result = theOtherTest->test();
+        }
 
         if (result < 1) {
           //new residual 
@@ -159,13 +172,23 @@ NewtonLineSearch::solveCurrentStep(void)
           //new value of s 
           double s = - ( dx0 ^ Resid ) ;
           
-          if (theLineSearch != 0)
-            theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+          if (theLineSearch != 0) {
+            int ok = theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+            numEvaluations += theLineSearch->getNumEvaluations();
+            if (ok < 0) {
+              opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+              opserr << "the LineSearch failed in search()\n";
+              return -4;
+            }
+          }
         }
 
         this->record(0);
           
-        result = theTest->test();
+        {
+          OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+          result = theTest->test();
+        }
 
     }  while (result == ConvergenceTest::Continue);
 
@@ -241,8 +264,11 @@ NewtonLineSearch::recvSelf(int cTag,
 void
 NewtonLineSearch::Print(OPS_Stream &s, int flag)
 {
-  if (flag == 0) 
+  if (flag == 0) {
     s << "NewtonLineSearch\n";
+    s << "  last step: " << numIterations << " iterations, "
+      << numEvaluations << " residual evaluations\n";
+  }
 
   if (theLineSearch != 0)
     theLineSearch->Print(s, flag);
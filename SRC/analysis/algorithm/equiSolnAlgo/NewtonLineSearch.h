@@ -51,6 +51,10 @@ class NewtonLineSearch: public EquiSolnAlgo
     int solveCurrentStep(void);    
     int setConvergenceTest(ConvergenceTest *theNewTest);
     ConvergenceTest *getConvergenceTest(void);     
+
+    // iterations and residual evaluations of the last step
+    int getNumIterations(void) {return numIterations;}
+    int getNumResidualEvaluations(void) {return numEvaluations;}
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -64,6 +68,9 @@ class NewtonLineSearch: public EquiSolnAlgo
     ConvergenceTest *theTest;
     ConvergenceTest *theOtherTest;
     LineSearch *theLineSearch;
+
+    int numIterations;
+    int numEvaluations;
 };
 
 #endif
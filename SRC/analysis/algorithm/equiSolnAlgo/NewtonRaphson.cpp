@@ -36,10 +36,12 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <TangentReuse.h>
 #include <ID.h>
 
 
 #include <elementAPI.h>
+#include <logging/Profiler.h>
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_NewtonRaphsonAlgorithm)
@@ -156,6 +158,9 @@ NewtonRaphson::solveCurrentStep()
       return SolutionAlgorithm::BadTestStart;
     }
 
+    if (theReuse != nullptr)
+      theReuse->startStep(*theAnaModel, *theSOE);
+
     int result = ConvergenceTest::Continue;
 
     numIterations = 0;
@@ -165,34 +170,25 @@ NewtonRaphson::solveCurrentStep()
     //
     do {
       //
-      // 2.1 Form tangent
+      // 2.1 Form tangent, unless the factored one still contracts well
       //
-      if (tangent == INITIAL_THEN_CURRENT_TANGENT) {
-
-        if (numIterations == 0) {
-
-          SOLUTION_ALGORITHM_tangentFlag = INITIAL_TANGENT;
-          if (theIntegrator->formTangent(INITIAL_TANGENT) < 0)
-            return SolutionAlgorithm::BadFormTangent;
-
-        } else {
-          SOLUTION_ALGORITHM_tangentFlag = CURRENT_TANGENT;
-          if (theIntegrator->formTangent(CURRENT_TANGENT) < 0)
-            return SolutionAlgorithm::BadFormTangent;
-        }
+      if (theReuse == nullptr || !theReuse->reuse()) {
+        int type = tangent;
+        if (tangent == INITIAL_THEN_CURRENT_TANGENT)
+          type = (numIterations == 0) ? INITIAL_TANGENT : CURRENT_TANGENT;
 
-      } else {
-
-        SOLUTION_ALGORITHM_tangentFlag = tangent;
-        if (theIntegrator->formTangent(tangent, iFactor, cFactor) < 0)
+        SOLUTION_ALGORITHM_tangentFlag = type;
+        if (this->formTangent(*theIntegrator, type) < 0)
           return SolutionAlgorithm::BadFormTangent;
-
       }
       //
       // 2.2 Solve for dx
       //
-      if (theSOE->solve() < 0) 
+      if (theSOE->solve() < 0) {
+        if (theReuse != nullptr)
+          theReuse->invalidate();
         return SolutionAlgorithm::BadLinearSolve;
+      }
 
       //
       // 2.3 Form updated residual
@@ -203,15 +199,24 @@ NewtonRaphson::solveCurrentStep()
       if (theIntegrator->formUnbalance() < 0)
         return SolutionAlgorithm::BadFormResidual;
 
+      if (theReuse != nullptr)
+        theReuse->residual(*theSOE);
+
       //
       // 2.4 Test on updated residual
       //
-      result = theTest->test();
+      {
+        OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+        result = theTest->test();
+      }
       numIterations++;
       this->record(numIterations);
 
     }  while (result == ConvergenceTest::Continue);
 
+    if (theReuse != nullptr)
+      theReuse->endStep(result != ConvergenceTest::Failure);
+
     if (result == ConvergenceTest::Failure)
       return SolutionAlgorithm::TestFailed;
 
@@ -221,6 +226,21 @@ NewtonRaphson::solveCurrentStep()
 }
 
 
+int
+NewtonRaphson::formTangent(IncrementalIntegrator &theIntegrator, int type)
+{
+  if (theIntegrator.formTangent(type, iFactor, cFactor) < 0) {
+    if (theReuse != nullptr)
+      theReuse->invalidate();
+    return -1;
+  }
+
+  if (theReuse != nullptr)
+    theReuse->formed();
+  return 0;
+}
+
+
 int
 NewtonRaphson::sendSelf(int cTag, Channel &theChannel)
 {
@@ -250,6 +270,9 @@ NewtonRaphson::Print(OPS_Stream &s, int flag)
 {
   if (flag == 0) {
     s << "NewtonRaphson" << endln;
+    if (theReuse != nullptr)
+      s << "\tTangent reuse ratio: " << theReuse->getMaxRatio()
+        << ", factorizations saved: " << theReuse->getNumSaved() << endln;
   }
 }
 
@@ -54,6 +54,7 @@ class NewtonRaphson: public EquiSolnAlgo
   ~NewtonRaphson();
   
   int solveCurrentStep(void);    
+  bool canReuseTangent(void) const {return true;}
     
   virtual int sendSelf(int commitTag, Channel &theChannel);
   virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -66,6 +67,8 @@ class NewtonRaphson: public EquiSolnAlgo
   
   
  private:
+  int formTangent(IncrementalIntegrator &theIntegrator, int type);
+
   int tangent;
   int numIterations;
   
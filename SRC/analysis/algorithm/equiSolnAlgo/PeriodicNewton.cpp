@@ -39,6 +39,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <logging/Profiler.h>
 
 // Constructor
 PeriodicNewton::PeriodicNewton(int theTangentToUse, int mc)
@@ -124,7 +125,10 @@ PeriodicNewton::solveCurrentStep(void)
         }        
 
         this->record(count++);
-        result = theTest->test();
+        {
+          OpenSees::ProfileScope scope(OpenSees::Profiler::Test);
+          result = theTest->test();
+        }
         
         iter++;
         if (iter > maxCount) {
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of TangentReuse.
+//
+// Written: cmp
+//
+#include <TangentReuse.h>
+#include <AnalysisModel.h>
+#include <Domain.h>
+#include <LinearSOE.h>
+#include <Vector.h>
+
+
+TangentReuse::TangentReuse(double ratio, int steps)
+:maxRatio(ratio), maxSteps(steps),
+ valid(false), domainStamp(-1), numEqn(-1), age(0),
+ lastNorm(-1.0), rate(0.0),
+ numFormed(0), numSaved(0)
+{
+
+}
+
+
+void
+TangentReuse::startStep(AnalysisModel &theModel, LinearSOE &theSOE)
+{
+  // a factorization is of no use once the model or the system changes
+  const int stamp = theModel.getDomainPtr()->hasDomainChanged();
+  const int n = theSOE.getNumEqn();
+  if (stamp != domainStamp || n != numEqn) {
+    domainStamp = stamp;
+    numEqn = n;
+    valid = false;
+  }
+
+  if (maxSteps > 0 && age >= maxSteps)
+    valid = false;
+
+  // the rate of the last step carries over to decide on the first
+  // iteration of this one
+  lastNorm = theSOE.getB().Norm();
+}
+
+
+void
+TangentReuse::residual(LinearSOE &theSOE)
+{
+  const double norm = theSOE.getB().Norm();
+  if (lastNorm > 0.0)
+    rate = norm/lastNorm;
+  lastNorm = norm;
+}
+
+
+void
+TangentReuse::formed(void)
+{
+  valid = true;
+  age = 0;
+  rate = 0.0;
+  numFormed++;
+}
+
+
+void
+TangentReuse::endStep(bool converged)
+{
+  if (converged)
+    age++;
+  else
+    valid = false;
+}
+
+
+void
+TangentReuse::invalidate(void)
+{
+  valid = false;
+}
+
+
+bool
+TangentReuse::degraded(void) const
+{
+  return rate > maxRatio;
+}
+
+
+bool
+TangentReuse::reuse(void)
+{
+  if (!valid || this->degraded())
+    return false;
+
+  numSaved++;
+  return true;
+}
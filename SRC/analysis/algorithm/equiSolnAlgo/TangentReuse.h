@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: TangentReuse decides for an EquiSolnAlgo when the tangent
+// factored in the LinearSOE may be used again in place of a new one. The
+// factorization is kept, within a step and from one step to the next,
+// while the residual norm contracts by at least maxRatio per iteration.
+// It is discarded when the contraction degrades, when a step fails, when
+// the domain or the size of the system changes, and, if maxSteps > 0,
+// once it has served maxSteps steps.
+//
+// The algorithm calls startStep() after forming the first unbalance of a
+// step, residual() after each further unbalance, formed() when it forms
+// a tangent and endStep() with the outcome of the step. Where it would
+// form a tangent it asks reuse(), which counts the factorizations saved.
+//
+// Written: cmp
+//
+#ifndef TangentReuse_h
+#define TangentReuse_h
+
+class AnalysisModel;
+class LinearSOE;
+
+class TangentReuse
+{
+  public:
+    TangentReuse(double maxRatio, int maxSteps = 0);
+
+    void startStep(AnalysisModel &theModel, LinearSOE &theSOE);
+    void residual(LinearSOE &theSOE);
+    void formed(void);
+    void endStep(bool converged);
+    void invalidate(void);
+
+    // true, and counted as saved, if the factored tangent may be used in
+    // place of forming a new one
+    bool reuse(void);
+
+    // true if the factored tangent no longer contracts the residual well
+    bool degraded(void) const;
+
+    double getMaxRatio(void) const {return maxRatio;}
+    int getMaxSteps(void) const    {return maxSteps;}
+    int getNumFormed(void) const   {return numFormed;}
+    int getNumSaved(void) const    {return numSaved;}
+
+  private:
+    double maxRatio;
+    int maxSteps;
+
+    bool valid;          // the SOE holds a factorization formed by the algorithm
+    int domainStamp;
+    int numEqn;
+    int age;             // steps completed with the factorization
+    double lastNorm;     // residual norm of the last iterate, < 0 if none
+    double rate;         // last observed contraction, 0 for a fresh tangent
+
+    int numFormed;
+    int numSaved;
+};
+
+#endif
@@ -33,40 +33,25 @@
 
 BisectionLineSearch::BisectionLineSearch(double tol, int mIter, double mnEta, double mxEta, int pFlag)
 :LineSearch(LINESEARCH_TAGS_BisectionLineSearch),
- x(0), tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
+ tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
 {   
 
 }
 
 BisectionLineSearch::~BisectionLineSearch()
 {
-  if (x != 0)
-    delete x;
-}
-
-
-int 
-BisectionLineSearch::newStep(LinearSOE &theSOE)
-{
-  const Vector &dU = theSOE.getX();
-
-  if (x == 0)
-    x = new Vector(dU);
-
-  if (x->Size() != dU.Size()) {
-    delete x;
-    x = new Vector(dU);
-  }
 
-  return 0;
 }
 
+
 int 
 BisectionLineSearch::search(double s0, 
                             double s1, 
                             LinearSOE &theSOE, 
                             IncrementalIntegrator &theIntegrator)
 {
+  this->startSearch(theSOE);
+
   double r0 = 0.0;
 
   if ( s0 != 0.0 ) 
@@ -86,10 +71,6 @@ BisectionLineSearch::search(double s0,
   double sU     = s1;
   double sL     = s0;
   double r      = r0;
-  double etaJ   = 1.0;
-  double compoundFactor = 0.0;
-
-  const Vector &dU = theSOE.getX();
 
   if (printFlag == 0) {
     opserr << "Bisection Line Search - initial: " 
@@ -102,38 +83,12 @@ BisectionLineSearch::search(double s0,
 
     count++;
 
-    /*
-    if (count == 1)
-      etaU = 0.5;
-    else
-    */
-    etaU = etaJ * 4.0;
+    etaU = this->getTrialEta() * 4.0;
 
     //update the incremental difference in response and determine new unbalance
-    *x = dU;
-    double factor = etaU - etaJ;
-    compoundFactor += factor;
-    *x *= factor;
-
-    etaJ = etaU;
-
-    if (theIntegrator.update(*x) < 0) {
-      opserr << "WARNING BisectionLineSearch::search() -";
-      opserr << "the Integrator failed in update()\n";        
-      return -1;
-    }
-    
-    if (theIntegrator.formUnbalance() < 0) {
-      opserr << "WARNING BisectionLineSearch::search() -";
-      opserr << "the Integrator failed in formUnbalance()\n";        
-      return -2;
-    }        
-  
-    //new residual
-    const Vector &ResidJ = theSOE.getB();
-    
-    //new value of sU
-    sU = dU ^ ResidJ;
+    int ok = this->evaluate(etaU, sU, theSOE, theIntegrator);
+    if (ok < 0)
+      return ok;
 
     // check if we have a solution we are happy with
     r = fabs( sU / s0 ); 
@@ -148,12 +103,8 @@ BisectionLineSearch::search(double s0,
 
   // return if no bracket for a solution found, resetting to initial values
   if (sU * sL > 0.0) {
-    *x = dU;
-    theSOE.setX(*x);
-    *x *= -compoundFactor;
-    theIntegrator.update(*x);
-    theIntegrator.formUnbalance();
-    return 0; 
+    this->setStep(1.0, theSOE);
+    return this->evaluate(1.0, s, theSOE, theIntegrator);
   }
 
   // perform the secant iterations:
@@ -169,42 +120,18 @@ BisectionLineSearch::search(double s0,
 
     eta = (etaU + etaL) * 0.5;
 
-    //-- want to put limits on eta(i)
-    //    if (r   > r0    )  eta =  1.0;
-    
-    //update the incremental difference in response and determine new unbalance
-    *x = dU;
-    double fact = eta-etaJ;
-
-    if (fact == 0)
+    if (eta == this->getTrialEta())
       break;
 
-    *x *= fact;
-            
-    if (theIntegrator.update(*x) < 0) {
-      opserr << "WARNING BisectionLineSearch::search() -";
-      opserr << "the Integrator failed in update()\n";        
-      return -1;
-    }
-    
-    if (theIntegrator.formUnbalance() < 0) {
-      opserr << "WARNING BisectionLineSearch::search() -";
-      opserr << "the Integrator failed in formUnbalance()\n";        
-      return -2;
-    }        
-
-    //new residual
-    const Vector &ResidJ = theSOE.getB();
-    
-    //new value of s
-    s = dU ^ ResidJ;
+    //update the incremental difference in response and determine new unbalance
+    int ok = this->evaluate(eta, s, theSOE, theIntegrator);
+    if (ok < 0)
+      return ok;
     
     //new value of r 
     r = fabs( s / s0 ); 
 
     // set variables for next iteration
-    etaJ = eta;
-    
     if (s*sU < 0.0) {
       etaL = eta;
       sL   = s;
@@ -226,11 +153,7 @@ BisectionLineSearch::search(double s0,
   } //end while
 
   // set X in the SOE for the revised dU, needed for convergence tests
-  *x = dU;
-  if (eta != 0.0) 
-    *x *= eta;
-
-  theSOE.setX(*x);
+  this->setStep(eta != 0.0 ? eta : 1.0, theSOE);
   
   return 0;
 }
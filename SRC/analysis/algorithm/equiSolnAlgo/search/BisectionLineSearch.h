@@ -61,7 +61,6 @@ class BisectionLineSearch: public LineSearch
 
     ~BisectionLineSearch();
 
-    int newStep(LinearSOE &theSOE);
     int search(double s0, 
                double s1, 
                LinearSOE &theSOE, 
@@ -74,7 +73,6 @@ class BisectionLineSearch: public LineSearch
   protected:
     
   private:
-    Vector *x;
     double tolerance;
     int    maxIter;
     double minEta;
@@ -35,31 +35,14 @@
 InitialInterpolatedLineSearch::InitialInterpolatedLineSearch(double tol, int mIter, double mnEta,
                                                              double mxEta, int pFlag)
 :LineSearch(LINESEARCH_TAGS_InitialInterpolatedLineSearch),
- x(0), tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
+ tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
 {   
 
 }
 
 InitialInterpolatedLineSearch::~InitialInterpolatedLineSearch()
 {
-  if (x != 0)
-    delete x;
-}
-
-int 
-InitialInterpolatedLineSearch::newStep(LinearSOE &theSOE)
-{
-  const Vector &dU = theSOE.getX();
 
-  if (x == 0)
-    x = new Vector(dU);
-
-  if (x->Size() != dU.Size()) {
-    delete x;
-    x = new Vector(dU);
-  }
-
-  return 0;
 }
 
 int 
@@ -68,6 +51,8 @@ InitialInterpolatedLineSearch::search(double s0,
                                       LinearSOE &theSOE, 
                                       IncrementalIntegrator &theIntegrator)
 {
+  this->startSearch(theSOE);
+
   double s = s1;
 
   //initialize r = ratio of residuals 
@@ -83,8 +68,6 @@ InitialInterpolatedLineSearch::search(double s0,
   double etaPrev = 1.0;
   double r = r0;
 
-  const Vector &dU = theSOE.getX();
-
   int count = 0; //initial value of iteration counter 
 
   if (printFlag == 0) {
@@ -101,9 +84,6 @@ InitialInterpolatedLineSearch::search(double s0,
   //                                -----------
   //                                s0 - s(i-1)  to compute eta(i)
 
-
-  //  opserr << "dU: " << dU;
-
   while ( r > tolerance  &&  count < maxIter ) {
 
     count++;
@@ -118,27 +98,9 @@ InitialInterpolatedLineSearch::search(double s0,
     if (eta == etaPrev)
       break; // no change in response break
 
-    //dx = ( eta * dx0 ); 
-    *x = dU;
-    *x *= eta-etaPrev;
-            
-    if (theIntegrator.update(*x) < 0) {
-      opserr << "WARNInG InitialInterpolatedLineSearch::search() -";
-      opserr << "the Integrator failed in update()\n";        
-      return -1;
-    }
-    
-    if (theIntegrator.formUnbalance() < 0) {
-      opserr << "WARNInG InitialInterpolatedLineSearch::search() -";
-      opserr << "the Integrator failed in formUnbalance()\n";        
-      return -2;
-    }        
-
-    //new residual
-    const Vector &ResidI = theSOE.getB();
-    
-    //new value of s
-    s = dU ^ ResidI;
+    int ok = this->evaluate(eta, s, theSOE, theIntegrator);
+    if (ok < 0)
+      return ok;
 
     //new value of r 
     r = fabs( s / s0 ); 
@@ -149,21 +111,12 @@ InitialInterpolatedLineSearch::search(double s0,
            << " , Ratio |sj/s0| = " << r << endln;
     }    
 
-    // reset the variables, also check not just hitting bounds over and over
-    if (eta == etaPrev)
-      count = maxIter;
-    else
-      etaPrev = eta;
+    etaPrev = eta;
 
   } //end while
 
   // set X in the SOE for the revised dU, needed for convergence tests
-  *x = dU;
-
-  if (eta != 0.0)
-    *x *= eta;
-
-  theSOE.setX(*x);
+  this->setStep(eta != 0.0 ? eta : 1.0, theSOE);
 
   return 0;
 }
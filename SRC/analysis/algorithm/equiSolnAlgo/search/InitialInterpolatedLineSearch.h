@@ -48,7 +48,6 @@ class InitialInterpolatedLineSearch: public LineSearch
 
     ~InitialInterpolatedLineSearch();
 
-    int newStep(LinearSOE &theSOE);
     int search(double s0, 
 	       double s1, 
 	       LinearSOE &theSOE, 
@@ -61,7 +60,6 @@ class InitialInterpolatedLineSearch: public LineSearch
   protected:
     
   private:
-    Vector *x;
     double tolerance;
     int    maxIter;
     double minEta;
@@ -25,9 +25,12 @@
 // Created: 11/01
 //
 #include <LineSearch.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
 
 LineSearch::LineSearch(int clasTag)
-:MovableObject(clasTag)
+:MovableObject(clasTag),
+ etaTrial(1.0), numEvaluations(0)
 {
 
 }
@@ -38,3 +41,57 @@ LineSearch::~LineSearch()
 }
 
 
+int
+LineSearch::newStep(LinearSOE &theSOE)
+{
+  // size the workspaces once per step, not per search
+  const int n = theSOE.getX().Size();
+  direction.resize(n);
+  increment.resize(n);
+  return 0;
+}
+
+
+void
+LineSearch::startSearch(LinearSOE &theSOE)
+{
+  direction = theSOE.getX();
+  if (increment.Size() != direction.Size())
+    increment.resize(direction.Size());
+
+  etaTrial = 1.0;
+  numEvaluations = 0;
+}
+
+
+int
+LineSearch::evaluate(double eta, double &s,
+                     LinearSOE &theSOE, IncrementalIntegrator &theIntegrator)
+{
+  increment.addVector(0.0, direction, eta - etaTrial);
+  etaTrial = eta;
+
+  if (theIntegrator.update(increment) < 0) {
+    opserr << "WARNING LineSearch::evaluate() - ";
+    opserr << "the Integrator failed in update()\n";
+    return -1;
+  }
+
+  numEvaluations++;
+  if (theIntegrator.formUnbalance() < 0) {
+    opserr << "WARNING LineSearch::evaluate() - ";
+    opserr << "the Integrator failed in formUnbalance()\n";
+    return -2;
+  }
+
+  s = direction ^ theSOE.getB();
+  return 0;
+}
+
+
+void
+LineSearch::setStep(double eta, LinearSOE &theSOE)
+{
+  increment.addVector(0.0, direction, eta);
+  theSOE.setX(increment);
+}
@@ -34,6 +34,7 @@
 
 #include <MovableObject.h>
 #include <OPS_Globals.h>
+#include <Vector.h>
 
 class SolutionAlgorithm;
 class IncrementalIntegrator;
@@ -47,17 +48,39 @@ class LineSearch: public MovableObject
     virtual ~LineSearch();
 
     // virtual functions
-    virtual int newStep(LinearSOE &theSOE) =0;
+    virtual int newStep(LinearSOE &theSOE);
     virtual int search(double s0, 
 		       double s1, 
 		       LinearSOE &theSOE, 
 		       IncrementalIntegrator &theIntegrator) =0;
     virtual void Print(OPS_Stream &s, int flag =0) =0;
+
+    // number of residual evaluations made by the last search
+    int getNumEvaluations(void) const {return numEvaluations;}
+
   protected:
-    
+    // the search direction is the solution in theSOE, at which the
+    // trial state is taken to be eta = 1
+    void startSearch(LinearSOE &theSOE);
+
+    // moves the trial state to eta along the direction, forms the
+    // unbalance and sets s = dU ^ R(U + eta dU)
+    int evaluate(double eta, double &s,
+                 LinearSOE &theSOE, IncrementalIntegrator &theIntegrator);
+
+    // sets the solution in theSOE to eta times the direction, as needed
+    // by the convergence tests
+    void setStep(double eta, LinearSOE &theSOE);
+
+    double getTrialEta(void) const {return etaTrial;}
+
   private:
+    // workspaces kept from one search to the next
+    Vector direction;
+    Vector increment;
+
+    double etaTrial;      // eta of the current trial state
+    int    numEvaluations;
 };
 
 #endif
-
-
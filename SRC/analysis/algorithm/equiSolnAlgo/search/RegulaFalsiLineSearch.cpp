@@ -33,40 +33,25 @@
 
 RegulaFalsiLineSearch::RegulaFalsiLineSearch(double tol, int mIter, double mnEta, double mxEta, int pFlag)
 :LineSearch(LINESEARCH_TAGS_RegulaFalsiLineSearch),
- x(0), tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
+ tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
 {   
 
 }
 
 RegulaFalsiLineSearch::~RegulaFalsiLineSearch()
 {
-  if (x != 0)
-    delete x;
-}
-
-
-int 
-RegulaFalsiLineSearch::newStep(LinearSOE &theSOE)
-{
-  const Vector &dU = theSOE.getX();
-
-  if (x == 0)
-    x = new Vector(dU);
-
-  if (x->Size() != dU.Size()) {
-    delete x;
-    x = new Vector(dU);
-  }
 
-  return 0;
 }
 
+
 int 
 RegulaFalsiLineSearch::search(double s0, 
                               double s1, 
                               LinearSOE &theSOE, 
                               IncrementalIntegrator &theIntegrator)
 {
+  this->startSearch(theSOE);
+
   double r0 = 0.0;
 
   if ( s0 != 0.0 ) 
@@ -86,10 +71,6 @@ RegulaFalsiLineSearch::search(double s0,
   double sU     = s1;
   double sL     = s0;
   double r      = r0;
-  double etaJ   = 1.0;
-  double compoundFactor = 0.0;
-
-  const Vector &dU = theSOE.getX();
 
   if (printFlag == 0) {
     opserr << "RegulaFalsi Line Search - initial: "
@@ -102,38 +83,12 @@ RegulaFalsiLineSearch::search(double s0,
 
     count++;
 
-    /*
-    if (count == 1)
-      etaU = 0.5;
-    else
-    */
-    etaU = etaJ * 4.0;
+    etaU = this->getTrialEta() * 4.0;
 
     //update the incremental difference in response and determine new unbalance
-    *x = dU;
-    double factor = etaU - etaJ;
-    compoundFactor += factor;
-    *x *= factor;
-
-    etaJ = etaU;
-
-    if (theIntegrator.update(*x) < 0) {
-      opserr << "WARNING BisectionLineSearch::search() -";
-      opserr << "the Integrator failed in update()\n";        
-      return -1;
-    }
-    
-    if (theIntegrator.formUnbalance() < 0) {
-      opserr << "WARNING BisectionLineSearch::search() -";
-      opserr << "the Integrator failed in formUnbalance()\n";        
-      return -2;
-    }        
-  
-    //new residual
-    const Vector &ResidJ = theSOE.getB();
-    
-    //new value of sU
-    sU = dU ^ ResidJ;
+    int ok = this->evaluate(etaU, sU, theSOE, theIntegrator);
+    if (ok < 0)
+      return ok;
 
     // check if we have a solution we are happy with
     r = fabs( sU / s0 ); 
@@ -141,19 +96,15 @@ RegulaFalsiLineSearch::search(double s0,
       return 0;
 
     if (printFlag == 0) {
-      opserr << "Bisection Line Search - bracketing: " << count 
+      opserr << "RegulaFalsi Line Search - bracketing: " << count 
            << " , eta(j) : " << etaU << " , Ratio |sj/s0| = " << r << endln;
     }
   }
 
   // return if no bracket for a solution found, resetting to initial values
   if (sU * sL > 0.0) {
-    *x = dU;
-    theSOE.setX(*x);
-    *x *= -compoundFactor;
-    theIntegrator.update(*x);
-    theIntegrator.formUnbalance();
-    return 0; 
+    this->setStep(1.0, theSOE);
+    return this->evaluate(1.0, s, theSOE, theIntegrator);
   }
 
   // perform the secant iterations:
@@ -175,31 +126,14 @@ RegulaFalsiLineSearch::search(double s0,
     if (  r >  r0   )  eta =  1.0;
     if (eta < minEta)  eta = minEta;
 
-    if (eta == etaJ) // break if going to have a zero *x
+    if (eta == this->getTrialEta()) // break if no change in response
       break;
     
     //update the incremental difference in response and determine new unbalance
-    *x = dU;
-    *x *= eta-etaJ;
-            
-    if (theIntegrator.update(*x) < 0) {
-      opserr << "WARNING RegulaFalsiLineSearch::search() -";
-      opserr << "the Integrator failed in update()\n";        
-      return -1;
-    }
-    
-    if (theIntegrator.formUnbalance() < 0) {
-      opserr << "WARNING RegulaFalsiLineSearch::search() -";
-      opserr << "the Integrator failed in formUnbalance()\n";        
-      return -2;
-    }        
-
-    //new residual
-    const Vector &ResidJ = theSOE.getB();
-    
-    //new value of s
-    s = dU ^ ResidJ;
-    
+    int ok = this->evaluate(eta, s, theSOE, theIntegrator);
+    if (ok < 0)
+      return ok;
+
     //new value of r 
     r = fabs( s / s0 ); 
 
@@ -209,13 +143,7 @@ RegulaFalsiLineSearch::search(double s0,
            << " , eta(j) : " << eta << " , Ratio |sj/s0| = " << r << endln;
     }
     
-
-    if (etaJ == eta)
-      count = maxIter;
-
     // set variables for next iteration
-    etaJ = eta;
-    
     if (s*sU < 0.0) {
       etaL = eta;
       sL   = s;
@@ -232,10 +160,7 @@ RegulaFalsiLineSearch::search(double s0,
   } //end while
 
   // set X in the SOE for the revised dU, needed for convergence tests
-  *x = dU;
-  if (eta != 0.0)
-    *x *= eta;
-  theSOE.setX(*x);
+  this->setStep(eta != 0.0 ? eta : 1.0, theSOE);
   
   return 0;
 }
@@ -59,7 +59,6 @@ class RegulaFalsiLineSearch: public LineSearch
 
     ~RegulaFalsiLineSearch();
 
-    int newStep(LinearSOE &theSOE);
     int search(double s0, 
 	       double s1, 
 	       LinearSOE &theSOE, 
@@ -72,7 +71,6 @@ class RegulaFalsiLineSearch: public LineSearch
   protected:
     
   private:
-    Vector *x;
     double tolerance;
     int    maxIter;
     double minEta;
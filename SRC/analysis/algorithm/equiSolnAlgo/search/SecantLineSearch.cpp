@@ -31,40 +31,25 @@
 
 SecantLineSearch::SecantLineSearch(double tol, int mIter, double mnEta, double mxEta, int pFlag)
 :LineSearch(LINESEARCH_TAGS_SecantLineSearch),
- x(0), tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
+ tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag)
 {   
 
 }
 
 SecantLineSearch::~SecantLineSearch()
 {
-  if (x != 0)
-    delete x;
-}
-
-
-int 
-SecantLineSearch::newStep(LinearSOE &theSOE)
-{
-  const Vector &dU = theSOE.getX();
 
-  if (x == 0)
-    x = new Vector(dU);
-
-  if (x->Size() != dU.Size()) {
-    delete x;
-    x = new Vector(dU);
-  }
-
-  return 0;
 }
 
+
 int 
 SecantLineSearch::search(double s0, 
                                  double s1, 
                                  LinearSOE &theSOE, 
                                  IncrementalIntegrator &theIntegrator)
 {
+  this->startSearch(theSOE);
+
   double r0 = 0.0;
 
   if ( s0 != 0.0 ) 
@@ -85,8 +70,6 @@ SecantLineSearch::search(double s0,
   double sJm1   = s0;
   double r = r0;
 
-  const Vector &dU = theSOE.getX();
-
   if (printFlag == 0) {
     opserr << "Secant Line Search - initial: "
          << "      eta(0) : " << eta << " , Ratio |s/s0| = " << r0 << endln;
@@ -114,26 +97,9 @@ SecantLineSearch::search(double s0,
     if (eta == etaJ) 
       break; // no change in response
 
-    *x = dU;
-    *x *= eta-etaJ;
-            
-    if (theIntegrator.update(*x) < 0) {
-      opserr << "WARNING SecantLineSearch::search() -";
-      opserr << "the Integrator failed in update()\n";        
-      return -1;
-    }
-    
-    if (theIntegrator.formUnbalance() < 0) {
-      opserr << "WARNING SecantLineSearch::search() -";
-      opserr << "the Integrator failed in formUnbalance()\n";        
-      return -2;
-    }        
-
-    //new residual
-    const Vector &ResidJ = theSOE.getB();
-    
-    // new value of s
-    s = dU ^ ResidJ;
+    int ok = this->evaluate(eta, s, theSOE, theIntegrator);
+    if (ok < 0)
+      return ok;
     
     // new value of r 
     r = fabs( s / s0 ); 
@@ -143,9 +109,6 @@ SecantLineSearch::search(double s0,
            << " , eta(j) : " << eta << " , Ratio |sj/s0| = " << r << endln;
     }
 
-    if (etaJ == eta)
-      count = maxIter;
-
     // set variables for next iteration
     etaJm1 = etaJ;
     etaJ = eta;
@@ -158,10 +121,7 @@ SecantLineSearch::search(double s0,
   } // end while
 
   // set X in the SOE for the revised dU, needed for convergence tests
-  *x = dU;
-  if (eta != 0.0)
-    *x *= eta;
-  theSOE.setX(*x);
+  this->setStep(eta != 0.0 ? eta : 1.0, theSOE);
 
   return 0;
 }
@@ -53,7 +53,6 @@ class SecantLineSearch: public LineSearch
 
     ~SecantLineSearch();
 
-    int newStep(LinearSOE &theSOE);
     int search(double s0, 
                double s1, 
                LinearSOE &theSOE, 
@@ -66,7 +65,6 @@ class SecantLineSearch: public LineSearch
   protected:
     
   private:
-    Vector *x;
     double tolerance;
     int    maxIter;
     double minEta;
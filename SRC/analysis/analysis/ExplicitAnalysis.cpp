@@ -0,0 +1,701 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Implementation of ExplicitAnalysis, an element-by-element
+// central difference engine with lumped mass and nodal subcycling.
+//
+// Written: cmp
+//
+#include <cmath>
+#include <float.h>
+#include <unordered_map>
+#include <algorithm>
+
+#include <ExplicitAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <EarthquakePattern.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+#include <threads/thread_pool.hpp>
+#include <logging/Profiler.h>
+
+ExplicitAnalysis::ExplicitAnalysis(Domain &theDomain,
+                                   double alpha,
+                                   int nThreads,
+                                   int levels,
+                                   double factor)
+  : Analysis(theDomain),
+    alphaM(alpha), numThreads(nThreads), maxLevels(levels), safety(factor),
+    domainStamp(0), loadStamp(-1), isSetup(false), initialized(false),
+    currentDt(0.0), numLevels(0),
+    threads(nullptr),
+    numEqn(0), hasElementMass(false)
+{
+  if (numThreads < 1)
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+  if (maxLevels < 0)
+    maxLevels = 0;
+
+  // limit the ratio of the finest to coarsest step to 2^16
+  if (maxLevels > 16)
+    maxLevels = 16;
+
+  if (numThreads > 1)
+    threads = new OpenSees::thread_pool{static_cast<OpenSees::concurrency_t>(numThreads)};
+}
+
+ExplicitAnalysis::~ExplicitAnalysis()
+{
+  if (threads != nullptr)
+    delete threads;
+}
+
+int
+ExplicitAnalysis::domainChanged()
+{
+  isSetup     = false;
+  initialized = false;
+  return 0;
+}
+
+int
+ExplicitAnalysis::revertToStart()
+{
+  initialized = false;
+  return 0;
+}
+
+int
+ExplicitAnalysis::getNumLevels() const
+{
+  return numLevels;
+}
+
+//
+// Collect the nodes, elements and constraints of the domain into
+// contiguous arrays and form the lumped mass.
+//
+int
+ExplicitAnalysis::setup()
+{
+  Domain *theDomain = this->getDomainPtr();
+
+  domainStamp = theDomain->hasDomainChanged();
+  loadStamp   = -1;
+
+  if (theDomain->getNumMPs() > 0) {
+    opserr << "ExplicitAnalysis::setup() - MP_Constraints are not supported\n";
+    return -1;
+  }
+
+  //
+  // Number the node DOFs contiguously
+  //
+  nodes.clear();
+  nodeOffset.clear();
+  std::unordered_map<int, int> nodeIndex;
+  nodeIndex.reserve(theDomain->getNumNodes());
+  nodes.reserve(theDomain->getNumNodes());
+  nodeOffset.reserve(theDomain->getNumNodes() + 1);
+
+  numEqn = 0;
+  {
+    Node *theNode;
+    NodeIter &theNodes = theDomain->getNodes();
+    while ((theNode = theNodes()) != nullptr) {
+      nodeIndex[theNode->getTag()] = static_cast<int>(nodes.size());
+      nodes.push_back(theNode);
+      nodeOffset.push_back(numEqn);
+      numEqn += theNode->getNumberDOF();
+    }
+    nodeOffset.push_back(numEqn);
+  }
+
+  mass.assign(numEqn, 0.0);
+  invMass.assign(numEqn, 0.0);
+  U.assign(numEqn, 0.0);
+  Vhalf.assign(numEqn, 0.0);
+  A.assign(numEqn, 0.0);
+  Fext.assign(numEqn, 0.0);
+  Fint.assign(numEqn, 0.0);
+  V.assign(numEqn, 0.0);
+  stableStep.assign(numEqn, DBL_MAX);
+  dofStep.assign(numEqn, 0.0);
+  dofStride.assign(numEqn, 1);
+  fixed.assign(numEqn, 0);
+
+  //
+  // Nodal masses, lumped by row sums
+  //
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const Matrix &M = nodes[i]->getMass();
+    const int n = nodeOffset[i+1] - nodeOffset[i];
+    if (M.noRows() != n)
+      continue;
+    for (int r = 0; r < n; r++)
+      for (int c = 0; c < n; c++)
+        mass[nodeOffset[i] + r] += M(r, c);
+  }
+
+  //
+  // Map each element to the DOF numbering and add its lumped mass
+  //
+  elements.clear();
+  eleOffset.clear();
+  eleDOF.clear();
+  eleReentrant.clear();
+  hasElementMass = false;
+  elements.reserve(theDomain->getNumElements());
+  eleOffset.reserve(theDomain->getNumElements() + 1);
+  {
+    Element *theEle;
+    ElementIter &theEles = theDomain->getElements();
+    while ((theEle = theEles()) != nullptr) {
+      if (theEle->isSubdomain()) {
+        opserr << "ExplicitAnalysis::setup() - Subdomains are not supported\n";
+        return -1;
+      }
+      elements.push_back(theEle);
+      eleOffset.push_back(static_cast<int>(eleDOF.size()));
+      eleReentrant.push_back(theEle->isReentrant() ? 1 : 0);
+
+      const ID &eleNodes = theEle->getExternalNodes();
+      for (int j = 0; j < eleNodes.Size(); j++) {
+        auto found = nodeIndex.find(eleNodes(j));
+        if (found == nodeIndex.end()) {
+          opserr << "ExplicitAnalysis::setup() - element " << theEle->getTag()
+                 << " references node " << eleNodes(j) << " which is not in the domain\n";
+          return -1;
+        }
+        const int i = found->second;
+        for (int k = nodeOffset[i]; k < nodeOffset[i+1]; k++)
+          eleDOF.push_back(k);
+      }
+
+      const int *dof = &eleDOF[eleOffset.back()];
+      const int n    = static_cast<int>(eleDOF.size()) - eleOffset.back();
+      const Matrix &M = theEle->getMass();
+      if (M.noRows() == n) {
+        for (int r = 0; r < n; r++)
+          for (int c = 0; c < n; c++) {
+            mass[dof[r]] += M(r, c);
+            if (M(r, c) != 0.0)
+              hasElementMass = true;
+          }
+      }
+    }
+    eleOffset.push_back(static_cast<int>(eleDOF.size()));
+  }
+  eleStride.assign(elements.size(), 1);
+  active.reserve(elements.size());
+  serial.reserve(elements.size());
+
+  //
+  // Single point constraints
+  //
+  prescribed.clear();
+  {
+    SP_Constraint *theSP;
+    SP_ConstraintIter &theSPs = theDomain->getSPs();
+    while ((theSP = theSPs()) != nullptr) {
+      auto found = nodeIndex.find(theSP->getNodeTag());
+      if (found == nodeIndex.end())
+        continue;
+      const int i   = found->second;
+      const int dof = theSP->getDOF_Number();
+      if (dof < 0 || dof >= nodeOffset[i+1] - nodeOffset[i])
+        continue;
+      fixed[nodeOffset[i] + dof] = 1;
+      if (!theSP->isHomogeneous())
+        prescribed.push_back({theSP, nodeOffset[i] + dof, 0.0});
+    }
+  }
+
+  for (int i = 0; i < numEqn; i++) {
+    if (fixed[i])
+      continue;
+    if (mass[i] <= 0.0) {
+      // find the node for the message
+      int n = static_cast<int>(std::upper_bound(nodeOffset.begin(), nodeOffset.end(), i)
+                               - nodeOffset.begin()) - 1;
+      opserr << "ExplicitAnalysis::setup() - no mass at unconstrained DOF "
+             << i - nodeOffset[n] + 1 << " of node " << nodes[n]->getTag() << "\n";
+      return -2;
+    }
+    invMass[i] = 1.0/mass[i];
+  }
+
+  forceBuffers.resize(numThreads > 1 ? numThreads : 0);
+  for (auto &buffer : forceBuffers)
+    buffer.assign(numEqn, 0.0);
+  threadStatus.assign(forceBuffers.size(), 0);
+
+  if (this->estimateStableSteps() < 0)
+    return -3;
+
+  isSetup = true;
+  return 0;
+}
+
+//
+// Estimate the stable step of each DOF from the Gershgorin bound on
+// the assembled M^-1 K, i.e. omega_i^2 <= sum_j |K_ij| / m_i. When all of
+// the mass is carried by the elements, the element frequencies of
+// Element::getMaxFrequency() also bound the response of their DOFs,
+// and the larger of the two stable steps is used.
+//
+int
+ExplicitAnalysis::estimateStableSteps()
+{
+  std::vector<double> rowSum(numEqn, 0.0);
+
+  for (size_t e = 0; e < elements.size(); e++) {
+    const Matrix &K = elements[e]->getTangentStiff();
+    const int *dof = &eleDOF[eleOffset[e]];
+    const int n    = eleOffset[e+1] - eleOffset[e];
+    if (K.noRows() != n || K.noCols() != n) {
+      opserr << "ExplicitAnalysis::estimateStableSteps() - element "
+             << elements[e]->getTag() << " stiffness has incorrect size\n";
+      return -1;
+    }
+    for (int r = 0; r < n; r++) {
+      double sum = 0.0;
+      for (int c = 0; c < n; c++)
+        sum += std::fabs(K(r, c));
+      rowSum[dof[r]] += sum;
+    }
+  }
+
+  for (int i = 0; i < numEqn; i++) {
+    if (fixed[i] || rowSum[i] <= 0.0)
+      stableStep[i] = DBL_MAX;
+    else
+      stableStep[i] = 2.0/std::sqrt(rowSum[i]*invMass[i]);
+  }
+
+  // element-by-element bound, valid only without nodal mass
+  for (Node *node : nodes) {
+    const Matrix &M = node->getMass();
+    for (int r = 0; r < M.noRows(); r++)
+      for (int c = 0; c < M.noCols(); c++)
+        if (M(r, c) != 0.0)
+          return 0;
+  }
+
+  std::vector<double> omegaMax(numEqn, 0.0);
+  for (size_t e = 0; e < elements.size(); e++) {
+    const double omega = elements[e]->getMaxFrequency();
+    if (omega <= 0.0)
+      return 0;
+    for (int k = eleOffset[e]; k < eleOffset[e+1]; k++)
+      omegaMax[eleDOF[k]] = std::max(omegaMax[eleDOF[k]], omega);
+  }
+
+  for (int i = 0; i < numEqn; i++) {
+    if (stableStep[i] != DBL_MAX && omegaMax[i] > 0.0)
+      stableStep[i] = std::max(stableStep[i], 2.0/omegaMax[i]);
+  }
+  return 0;
+}
+
+double
+ExplicitAnalysis::getCriticalStep()
+{
+  Domain *theDomain = this->getDomainPtr();
+  if (!isSetup || theDomain->hasDomainChanged() != domainStamp) {
+    initialized = false;
+    if (this->setup() < 0)
+      return 0.0;
+  }
+
+  double dtCrit = DBL_MAX;
+  for (int i = 0; i < numEqn; i++)
+    dtCrit = std::min(dtCrit, stableStep[i]);
+  return dtCrit;
+}
+
+//
+// Assign each node to the coarsest level k for which dT/2^k is stable;
+// elements are evaluated at the rate of their finest node.
+//
+int
+ExplicitAnalysis::assignLevels(double dT)
+{
+  const int numNodes = static_cast<int>(nodes.size());
+  nodeLevel.assign(numNodes, 0);
+
+  int numUnstable = 0;
+  numLevels = 0;
+  for (int i = 0; i < numNodes; i++) {
+    double nodeStep = DBL_MAX;
+    for (int k = nodeOffset[i]; k < nodeOffset[i+1]; k++)
+      nodeStep = std::min(nodeStep, stableStep[k]);
+
+    int level = 0;
+    while (dT/double(1<<level) > safety*nodeStep && level < maxLevels)
+      level++;
+
+    if (dT/double(1<<level) > safety*nodeStep)
+      numUnstable++;
+
+    nodeLevel[i] = level;
+    numLevels = std::max(numLevels, level);
+  }
+
+  if (numUnstable > 0) {
+    opserr << "WARNING ExplicitAnalysis - time step " << dT << " exceeds the estimated stable step at "
+           << numUnstable << " nodes";
+    if (maxLevels > 0)
+      opserr << " with " << maxLevels << " subcycling levels";
+    opserr << "\n";
+  }
+
+  const int numSub = 1 << numLevels;
+  for (int i = 0; i < numNodes; i++) {
+    const int stride = numSub >> nodeLevel[i];
+    const double h   = dT/double(1 << nodeLevel[i]);
+    for (int k = nodeOffset[i]; k < nodeOffset[i+1]; k++) {
+      dofStride[k] = stride;
+      dofStep[k]   = h;
+    }
+  }
+
+  for (size_t e = 0; e < elements.size(); e++) {
+    int stride = numSub;
+    for (int k = eleOffset[e]; k < eleOffset[e+1]; k++)
+      stride = std::min(stride, dofStride[eleDOF[k]]);
+    eleStride[e] = stride;
+  }
+
+  return 0;
+}
+
+//
+// Start the leapfrog scheme from the committed state of the domain
+//
+int
+ExplicitAnalysis::initialize(double dT)
+{
+  Domain *theDomain = this->getDomainPtr();
+
+  if (!isSetup || theDomain->hasDomainChanged() != domainStamp) {
+    if (this->setup() < 0)
+      return -1;
+  }
+
+  if (dT <= 0.0) {
+    double dtCrit = DBL_MAX;
+    for (int i = 0; i < numEqn; i++)
+      dtCrit = std::min(dtCrit, stableStep[i]);
+    if (dtCrit == DBL_MAX) {
+      opserr << "ExplicitAnalysis::initialize() - could not estimate a stable time step\n";
+      return -2;
+    }
+    dT = safety*dtCrit;
+  }
+
+  currentDt = dT;
+  this->assignLevels(dT);
+
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const Vector &u = nodes[i]->getDisp();
+    const Vector &v = nodes[i]->getVel();
+    for (int k = nodeOffset[i]; k < nodeOffset[i+1]; k++) {
+      U[k]     = u(k - nodeOffset[i]);
+      Vhalf[k] = v(k - nodeOffset[i]);
+    }
+  }
+
+  // accelerations at the committed state; the domain reports no time
+  // increment here, so elements see the step about to be taken
+  if (this->applyLoad(theDomain->getCurrentTime()) < 0)
+    return -3;
+  ops_Dt = dT;
+  this->setNodalTrialDisp();
+  if (this->formInternalForce(0) < 0) {
+    opserr << "ExplicitAnalysis::initialize() - failed to form the resisting force\n";
+    return -3;
+  }
+
+  for (int i = 0; i < numEqn; i++) {
+    if (fixed[i]) {
+      A[i] = 0.0;
+      Vhalf[i] = 0.0;
+      continue;
+    }
+    A[i] = invMass[i]*(Fext[i] - Fint[i]) - alphaM*Vhalf[i];
+    Vhalf[i] += 0.5*dofStep[i]*A[i];
+  }
+
+  initialized = true;
+  return 0;
+}
+
+//
+// Apply the load patterns at the given time, gather the nodal loads
+// and impose non-homogeneous single point constraints. The inertia
+// loads of a ground motion reach the nodal loads through the nodal
+// masses only; the element share is returned by
+// getResistingForceIncInertia(), which also holds the element inertia
+// and damping forces of an implicit analysis, so models with element
+// mass are rejected.
+//
+int
+ExplicitAnalysis::applyLoad(double time)
+{
+  Domain *theDomain = this->getDomainPtr();
+
+  // the patterns are only checked again after a load change
+  if (hasElementMass && theDomain->hasLoadChanged() != loadStamp) {
+    LoadPattern *thePattern;
+    LoadPatternIter &thePatterns = theDomain->getLoadPatterns();
+    while ((thePattern = thePatterns()) != nullptr) {
+      if (dynamic_cast<EarthquakePattern *>(thePattern) != nullptr) {
+        opserr << "ExplicitAnalysis - load pattern " << thePattern->getTag()
+               << " imposes a ground motion, which requires all of the mass to be"
+                  " assigned to the nodes\n";
+        return -1;
+      }
+    }
+    loadStamp = theDomain->hasLoadChanged();
+  }
+
+  theDomain->applyLoad(time);
+
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const Vector &p = nodes[i]->getUnbalancedLoad();
+    const int n = nodeOffset[i+1] - nodeOffset[i];
+    double *f = &Fext[nodeOffset[i]];
+    if (p.Size() == n)
+      for (int k = 0; k < n; k++)
+        f[k] = p(k);
+    else
+      for (int k = 0; k < n; k++)
+        f[k] = 0.0;
+  }
+
+  for (const Prescribed &p : prescribed)
+    U[p.dof] = p.sp->getValue();
+
+  return 0;
+}
+
+void
+ExplicitAnalysis::setNodalTrialDisp()
+{
+  for (size_t i = 0; i < nodes.size(); i++) {
+    Vector u(&U[nodeOffset[i]], nodeOffset[i+1] - nodeOffset[i]);
+    nodes[i]->setTrialDisp(u);
+  }
+}
+
+void
+ExplicitAnalysis::setNodalTrialResponse()
+{
+  for (int i = 0; i < numEqn; i++)
+    V[i] = Vhalf[i] - 0.5*dofStep[i]*A[i];
+
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const int n = nodeOffset[i+1] - nodeOffset[i];
+    Vector ui(&U[nodeOffset[i]], n);
+    Vector vi(&V[nodeOffset[i]], n);
+    Vector ai(&A[nodeOffset[i]], n);
+    nodes[i]->setTrialDisp(ui);
+    nodes[i]->setTrialVel(vi);
+    nodes[i]->setTrialAccel(ai);
+  }
+}
+
+//
+// Update the elements that are active at the given substep and
+// assemble their resisting forces into Fint. A substep of 0
+// activates every element. This takes the place of Domain::update()
+// and is profiled as such. Reentrant elements are distributed over
+// the threads while the others are evaluated on the calling thread,
+// which alone sets ops_TheActiveElement.
+//
+int
+ExplicitAnalysis::formInternalForce(int substep)
+{
+  OpenSees::ProfileScope scope(OpenSees::Profiler::DomainUpdate);
+  ops_TheActiveDomain = this->getDomainPtr();
+
+  // the element timers of the profiler are not thread safe
+  const bool threaded = threads != nullptr && !OpenSees::Profiler::isTimingElements();
+
+  active.clear();
+  serial.clear();
+  for (size_t e = 0; e < elements.size(); e++) {
+    if (substep % eleStride[e] != 0)
+      continue;
+    if (threaded && eleReentrant[e])
+      active.push_back(static_cast<int>(e));
+    else
+      serial.push_back(static_cast<int>(e));
+  }
+
+  if (active.size() < 2*static_cast<size_t>(numThreads)) {
+    serial.insert(serial.end(), active.begin(), active.end());
+    active.clear();
+  }
+
+  std::fill(Fint.begin(), Fint.end(), 0.0);
+
+  auto assemble = [&](int e, const Vector &f, double *F) {
+    const int *dof = &eleDOF[eleOffset[e]];
+    const int n    = eleOffset[e+1] - eleOffset[e];
+    for (int k = 0; k < n; k++)
+      F[dof[k]] += f(k);
+  };
+
+  // each batch of reentrant elements assembles into its own buffer
+  const int numActive = static_cast<int>(active.size());
+  const int numBatch  = numActive > 0 ? numThreads : 0;
+  std::vector<int> &status = threadStatus;
+  const int batch = numActive > 0 ? (numActive + numThreads - 1)/numThreads : 0;
+  for (int b = 0; b < numBatch; b++) {
+    threads->detach_task([&, b]() {
+      std::vector<double> &F = forceBuffers[b];
+      std::fill(F.begin(), F.end(), 0.0);
+      int ok = 0;
+      for (int a = std::min(b*batch, numActive); a < std::min((b+1)*batch, numActive); a++) {
+        Element *theEle = elements[active[a]];
+        ok += theEle->update();
+        assemble(active[a], theEle->getResistingForce(), F.data());
+      }
+      status[b] = ok;
+    });
+  }
+
+  int ok = 0;
+  for (int e : serial) {
+    Element *theEle = elements[e];
+    ops_TheActiveElement = theEle;
+    {
+      OpenSees::ProfileElementScope<Element> timer(OpenSees::Profiler::ElementUpdate, *theEle);
+      ok += theEle->update();
+    }
+    assemble(e, theEle->getResistingForce(), Fint.data());
+  }
+
+  if (numBatch == 0)
+    return ok < 0 ? -1 : 0;
+
+  threads->wait();
+
+  // reduce the buffers over DOF ranges
+  threads->submit_blocks<int>(0, numEqn, [&](int begin, int end) {
+    for (const auto &F : forceBuffers)
+      for (int i = begin; i < end; i++)
+        Fint[i] += F[i];
+  }, numThreads).wait();
+
+  for (int b = 0; b < numBatch; b++)
+    if (status[b] < 0)
+      ok = -1;
+
+  return ok < 0 ? -1 : 0;
+}
+
+int
+ExplicitAnalysis::analyze(int numSteps, double dT)
+{
+  Domain *theDomain = this->getDomainPtr();
+
+  if (theDomain->hasDomainChanged() != domainStamp)
+    isSetup = initialized = false;
+
+  if (!initialized || (dT > 0.0 && dT != currentDt)) {
+    if (this->initialize(dT) < 0)
+      return -1;
+  }
+
+  const int    numSub = 1 << numLevels;
+  const double h      = currentDt/double(numSub);
+
+  for (int step = 0; step < numSteps; step++) {
+    const double t0 = theDomain->getCurrentTime();
+
+    for (int s = 1; s <= numSub; s++) {
+
+      // displacements at the end of the substep; DOFs of coarser
+      // levels move with their constant half-step velocity
+      for (int i = 0; i < numEqn; i++)
+        if (!fixed[i])
+          U[i] += h*Vhalf[i];
+
+      // prescribed motions are differenced over the substep
+      for (Prescribed &p : prescribed)
+        p.previous = U[p.dof];
+
+      if (this->applyLoad(t0 + s*h) < 0) {
+        theDomain->revertToLastCommit();
+        initialized = false;
+        return -2;
+      }
+
+      for (const Prescribed &p : prescribed)
+        Vhalf[p.dof] = (U[p.dof] - p.previous)/h;
+
+      this->setNodalTrialDisp();
+
+      if (this->formInternalForce(s) < 0) {
+        opserr << "ExplicitAnalysis::analyze() - failed to form the resisting force";
+        opserr << " at time " << t0 + s*h << "\n";
+        theDomain->revertToLastCommit();
+        initialized = false;
+        return -2;
+      }
+
+      // central difference update of the DOFs that complete a step
+      for (int i = 0; i < numEqn; i++) {
+        if (fixed[i] || s % dofStride[i] != 0)
+          continue;
+        A[i] = invMass[i]*(Fext[i] - Fint[i]) - alphaM*Vhalf[i];
+        Vhalf[i] += dofStep[i]*A[i];
+      }
+    }
+
+    this->setNodalTrialResponse();
+
+    theDomain->setCurrentTime(t0 + currentDt);
+    if (theDomain->commit() < 0) {
+      opserr << "ExplicitAnalysis::analyze() - failed to commit the domain";
+      opserr << " at time " << t0 + currentDt << "\n";
+      initialized = false;
+      return -3;
+    }
+  }
+
+  return 0;
+}
+
+void
+ExplicitAnalysis::Print(OPS_Stream &s, int flag)
+{
+  s << "ExplicitAnalysis\n";
+  s << "  alphaM: " << alphaM << "  threads: " << numThreads
+    << "  safety: " << safety << "\n";
+  if (initialized) {
+    s << "  dT: " << currentDt << "  levels: " << numLevels << "\n";
+    std::vector<int> count(numLevels + 1, 0);
+    for (int level : nodeLevel)
+      count[level]++;
+    for (int k = 0; k <= numLevels; k++)
+      s << "    level " << k << " (dT/" << (1 << k) << "): " << count[k] << " nodes\n";
+  }
+}
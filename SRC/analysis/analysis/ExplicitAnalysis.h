@@ -0,0 +1,135 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: ExplicitAnalysis is a self-contained explicit dynamics
+// engine. It advances the Domain with the central difference (leapfrog)
+// method using a lumped mass, without an AnalysisModel, ConstraintHandler,
+// DOF_Numberer or LinearSOE. Nodal masses and response quantities are
+// held in flat arrays indexed by a contiguous numbering of the node DOFs,
+// and the resisting forces of elements that report Element::isReentrant()
+// are evaluated in batches which may be distributed over a pool of
+// threads; all other elements are evaluated serially.
+//
+// Nodes are optionally partitioned into levels by their stable time step,
+// estimated from a Gershgorin bound on the assembled M^-1 K and, when all
+// mass is carried by the elements, from Element::getMaxFrequency(). A node at
+// level k is advanced with a step of dT/2^k, and each element is evaluated
+// at the rate of its finest node (nodal subcycling).
+//
+// Restrictions:
+//  - Only single-point constraints are supported.
+//  - Damping is limited to mass-proportional Rayleigh damping, alphaM.
+//  - Ground motion patterns (e.g. UniformExcitation) are supported only
+//    when all of the mass is assigned to the nodes, as the inertia loads
+//    of the elements are not included in the applied load.
+//
+// Written: cmp
+//
+#ifndef ExplicitAnalysis_h
+#define ExplicitAnalysis_h
+
+#include <vector>
+#include <Analysis.h>
+
+class Domain;
+class Element;
+class Node;
+class SP_Constraint;
+class OPS_Stream;
+
+namespace OpenSees {
+  class thread_pool;
+}
+
+class ExplicitAnalysis : public Analysis
+{
+public:
+  ExplicitAnalysis(Domain &theDomain,
+                   double alphaM     = 0.0,
+                   int    numThreads = 1,
+                   int    maxLevels  = 0,
+                   double safety     = 0.9);
+  ~ExplicitAnalysis();
+
+  // Advance numSteps steps of size dT; if dT <= 0 the step is
+  // taken as safety times the estimated critical step.
+  int analyze(int numSteps, double dT);
+
+  int domainChanged();
+  int revertToStart();
+
+  // Estimated critical time step of the whole mesh,
+  // i.e. 2/omega_max without the safety factor
+  double getCriticalStep();
+  int    getNumLevels() const;
+
+  void Print(OPS_Stream &s, int flag = 0);
+
+private:
+  int  setup();
+  int  initialize(double dT);
+  int  estimateStableSteps();
+  int  assignLevels(double dT);
+  int  formInternalForce(int substep);
+  int  applyLoad(double time);
+  void setNodalTrialDisp();
+  void setNodalTrialResponse();
+
+  // options
+  double alphaM;
+  int    numThreads;
+  int    maxLevels;
+  double safety;
+
+  // analysis state
+  int    domainStamp;
+  int    loadStamp;      // load stamp at which the patterns were last checked
+  bool   isSetup;
+  bool   initialized;
+  double currentDt;
+  int    numLevels;
+  OpenSees::thread_pool *threads;
+
+  // node data; DOFs of node i occupy [nodeOffset[i], nodeOffset[i+1])
+  std::vector<Node*>    nodes;
+  std::vector<int>      nodeOffset;
+  std::vector<int>      nodeLevel;
+
+  // DOF data, all of size numEqn
+  int numEqn;
+  std::vector<double> mass;           // lumped mass
+  std::vector<double> invMass;        // inverse lumped mass, 0 at fixed DOFs
+  std::vector<double> U;              // displacement at current substep
+  std::vector<double> Vhalf;          // velocity at the half step
+  std::vector<double> A;              // acceleration at the last update
+  std::vector<double> Fext;           // applied load
+  std::vector<double> Fint;           // resisting force
+  std::vector<double> V;              // velocity at the end of the step
+  std::vector<double> stableStep;     // estimated stable step of each DOF
+  std::vector<double> dofStep;        // step size used by each DOF
+  std::vector<int>    dofStride;      // substeps between updates of each DOF
+  std::vector<char>   fixed;          // DOF subject to an SP_Constraint
+
+  // prescribed, non-homogeneous constraints
+  struct Prescribed {SP_Constraint *sp; int dof; double previous;};
+  std::vector<Prescribed> prescribed;
+
+  // element data; element e maps to DOFs eleDOF[eleOffset[e]...eleOffset[e+1]]
+  std::vector<Element*> elements;
+  std::vector<int>      eleOffset;
+  std::vector<int>      eleDOF;
+  std::vector<int>      eleStride;
+  std::vector<char>     eleReentrant; // element may be updated on any thread
+  std::vector<int>      active;       // reentrant elements updated at the current substep
+  std::vector<int>      serial;       // other elements updated at the current substep
+  bool                  hasElementMass;
+
+  // per-thread resisting force buffers and status
+  std::vector<std::vector<double>> forceBuffers;
+  std::vector<int>      threadStatus;
+};
+
+#endif
@@ -0,0 +1,271 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of CTestCombined.
+//
+// Written: cmp
+//
+#include <CTestCombined.h>
+#include <Vector.h>
+#include <Channel.h>
+#include <EquiSolnAlgo.h>
+#include <LinearSOE.h>
+#include <Logging.h>
+#include <classTags.h>
+#include <math.h>
+
+CTestCombined::CTestCombined()
+  : ConvergenceTest(CONVERGENCE_TEST_CTestCombined),
+    theSOE(0), tolDisp(0), tolUnbalance(0), tolEnergy(0), any(false),
+    maxNumIter(0), currentIter(0), printFlag(0),
+    nType(2), norms(3*25)
+{
+
+}
+
+
+CTestCombined::CTestCombined(double theTolDisp, double theTolUnbalance, double theTolEnergy,
+                             int maxIter, int printIt, int normType, bool anyCriterion)
+  : ConvergenceTest(CONVERGENCE_TEST_CTestCombined),
+    theSOE(0), tolDisp(theTolDisp), tolUnbalance(theTolUnbalance), tolEnergy(theTolEnergy),
+    any(anyCriterion), maxNumIter(maxIter), currentIter(0), printFlag(printIt),
+    nType(normType), norms(3*maxIter)
+{
+
+}
+
+
+CTestCombined::~CTestCombined()
+{
+
+}
+
+
+ConvergenceTest *
+CTestCombined::getCopy(int iterations)
+{
+  CTestCombined *theCopy = new CTestCombined(tolDisp, tolUnbalance, tolEnergy,
+                                             iterations, printFlag, nType, any);
+  theCopy->theSOE = theSOE;
+  return theCopy;
+}
+
+
+void
+CTestCombined::setTolerance(double newTol)
+{
+  tolDisp = newTol;
+}
+
+
+int
+CTestCombined::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
+{
+  theSOE = theAlgo.getLinearSOEptr();
+  return 0;
+}
+
+
+int
+CTestCombined::test(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING: CTestCombined::test() - no SOE set.\n";
+    return -2;
+  }
+
+  if (currentIter == 0) {
+    opserr << "WARNING: CTestCombined::test() - start() was never invoked.\n";
+    return -2;
+  }
+
+  // one pass over X and B for all the criteria
+  const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
+  const double normX = soeNorms.normX;
+  const double normB = soeNorms.normB;
+  const double energy = 0.5*fabs(soeNorms.dotXB);
+
+  if (currentIter <= maxNumIter) {
+    norms(currentIter-1) = normX;
+    norms(maxNumIter+currentIter-1) = normB;
+    norms(2*maxNumIter+currentIter-1) = energy;
+  }
+
+  int numChecked = 0;
+  int numMet = 0;
+  if (tolDisp > 0.0) {
+    numChecked++;
+    if (normX <= tolDisp)
+      numMet++;
+  }
+  if (tolUnbalance > 0.0) {
+    numChecked++;
+    if (normB <= tolUnbalance)
+      numMet++;
+  }
+  if (tolEnergy > 0.0) {
+    numChecked++;
+    if (energy <= tolEnergy)
+      numMet++;
+  }
+  const bool converged = numChecked > 0 && (any ? numMet > 0 : numMet == numChecked);
+
+  if (printFlag & ConvergenceTest::PrintTest) {
+    opserr << LOG_ITERATE
+           << "Iter: "         << pad(currentIter)
+           << ", Norm deltaX: " << pad(normX)
+           << ", Norm deltaR: " << pad(normB)
+           << ", EnergyIncr: "  << pad(energy)
+           << endln;
+  }
+  if (printFlag & ConvergenceTest::PrintTest02) {
+    opserr << "\tdeltaX: " << theSOE->getX()
+           << "\tdeltaR: " << theSOE->getB();
+  }
+
+  if (converged) {
+    if (printFlag & ConvergenceTest::PrintTest || printFlag & ConvergenceTest::PrintTest02)
+      opserr << endln;
+
+    if (printFlag & ConvergenceTest::PrintSuccess) {
+      opserr << LOG_SUCCESS
+             << "Iter: "          << pad(currentIter)
+             << ", Norm deltaX: " << pad(normX)
+             << ", Norm deltaR: " << pad(normB)
+             << ", EnergyIncr: "  << pad(energy)
+             << endln;
+    }
+    return currentIter;
+  }
+
+  // failed to converge after specified number of iterations - but RETURN OK
+  else if ((printFlag & ConvergenceTest::AlwaysSucceed) && currentIter >= maxNumIter) {
+    if (printFlag & ConvergenceTest::PrintFailure) {
+      opserr << LOG_FAILURE
+             << "Iter: "          << pad(currentIter)
+             << ", Norm deltaX: " << pad(normX)
+             << ", Norm deltaR: " << pad(normB)
+             << ", EnergyIncr: "  << pad(energy)
+             << LOG_CONTINUE
+             << "failed to converge but going on - "
+             << endln;
+    }
+    return currentIter;
+  }
+
+  // failed to converge after specified number of iterations - return FAILURE -2
+  else if (currentIter >= maxNumIter) {
+    if (printFlag & ConvergenceTest::PrintFailure) {
+      opserr << LOG_FAILURE
+             << "Iter: "          << pad(currentIter)
+             << ", Norm deltaX: " << pad(normX)
+             << ", Norm deltaR: " << pad(normB)
+             << ", EnergyIncr: "  << pad(energy)
+             << endln;
+    }
+    currentIter++;
+    return ConvergenceTest::Failure;
+  }
+
+  // not yet converged - increment counter and return -1
+  else {
+    currentIter++;
+    return ConvergenceTest::Continue;
+  }
+}
+
+
+int
+CTestCombined::start(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING: CTestCombined::start() - no SOE returning true\n";
+    return -1;
+  }
+
+  norms.Zero();
+  currentIter = 1;
+  return 0;
+}
+
+
+int
+CTestCombined::getNumTests(void)
+{
+  return currentIter;
+}
+
+
+int
+CTestCombined::getMaxNumTests(void)
+{
+  return maxNumIter;
+}
+
+
+double
+CTestCombined::getRatioNumToMax(void)
+{
+  double div = maxNumIter;
+  return currentIter/div;
+}
+
+
+const Vector &
+CTestCombined::getNorms(void)
+{
+  return norms;
+}
+
+
+int
+CTestCombined::sendSelf(int cTag, Channel &theChannel)
+{
+  Vector x(7);
+  x(0) = tolDisp;
+  x(1) = tolUnbalance;
+  x(2) = tolEnergy;
+  x(3) = maxNumIter;
+  x(4) = printFlag;
+  x(5) = nType;
+  x(6) = any ? 1.0 : 0.0;
+
+  int res = theChannel.sendVector(this->getDbTag(), cTag, x);
+  if (res < 0)
+    opserr << "CTestCombined::sendSelf() - failed to send data\n";
+
+  return res;
+}
+
+
+int
+CTestCombined::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  Vector x(7);
+  int res = theChannel.recvVector(this->getDbTag(), cTag, x);
+
+  if (res < 0) {
+    opserr << "CTestCombined::recvSelf() - failed to receive data\n";
+    tolDisp = 1.0e-8;
+    tolUnbalance = 0.0;
+    tolEnergy = 0.0;
+    maxNumIter = 25;
+    printFlag = 0;
+    nType = 2;
+    any = false;
+  } else {
+    tolDisp = x(0);
+    tolUnbalance = x(1);
+    tolEnergy = x(2);
+    maxNumIter = (int)x(3);
+    printFlag = (int)x(4);
+    nType = (int)x(5);
+    any = x(6) != 0.0;
+  }
+  norms.resize(3*maxNumIter);
+
+  return res;
+}
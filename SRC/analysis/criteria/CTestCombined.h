@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: A CTestCombined object tests for convergence using the norm
+// of the solution vector, the norm of the unbalance and the energy
+// increment together, all formed in one pass over the vectors of the
+// LinearSOE. A criterion with a tolerance <= 0 is not checked; the test
+// passes when all the checked criteria are met, or any of them if so set.
+// The norms of each iteration are stored as the displacement norms, then
+// the unbalance norms, then the energy increments.
+//
+// Written: cmp
+//
+#ifndef CTestCombined_h
+#define CTestCombined_h
+
+#include <ConvergenceTest.h>
+class EquiSolnAlgo;
+class LinearSOE;
+
+class CTestCombined: public ConvergenceTest
+{
+public:
+    CTestCombined();
+    CTestCombined(double tolDisp, double tolUnbalance, double tolEnergy,
+                  int maxNumIter, int printFlag, int normType = 2,
+                  bool any = false);
+    ~CTestCombined();
+
+    ConvergenceTest *getCopy(int iterations);
+
+    void setTolerance(double newTol);
+    int setEquiSolnAlgo(EquiSolnAlgo &theAlgo);
+
+    int test(void);
+    int start(void);
+
+    int getNumTests(void);
+    int getMaxNumTests(void);
+    double getRatioNumToMax(void);
+    const Vector &getNorms(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+private:
+    LinearSOE *theSOE;
+    double tolDisp;      // tol on the norm of the solution, <= 0 if not checked
+    double tolUnbalance; // tol on the norm of the unbalance, <= 0 if not checked
+    double tolEnergy;    // tol on the energy increment, <= 0 if not checked
+    bool any;            // converged when any checked criterion is met
+
+    int maxNumIter;      // max number of iterations
+    int currentIter;     // number of times test() has been invokes since last start()
+    int printFlag;       // a flag indicating if to print on test
+
+    int nType;           // type of norm to use (1-norm, 2-norm, p-norm, max-norm)
+    Vector norms;        // vector to hold the norms
+};
+
+#endif
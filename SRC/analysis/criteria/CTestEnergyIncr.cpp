@@ -98,9 +98,10 @@ int CTestEnergyIncr::test(void)
     }
 
     // determine the energy & save value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();
-    double product = x ^ b;
+    double product = soeNorms.dotXB;
     if (product < 0.0)
         product *= -0.5;
     else
@@ -121,8 +122,8 @@ int CTestEnergyIncr::test(void)
                << "Iter: "          << pad(currentIter)
                << ", EnergyIncr: "  << pad(product)
                << LOG_CONTINUE
-               << "Norm deltaX: "   << pad(x.pNorm(nType))
-               << ", Norm deltaR: " << pad(b.pNorm(nType))
+               << "Norm deltaX: "   << pad(soeNorms.normX)
+               << ", Norm deltaR: " << pad(soeNorms.normB)
                << LOG_CONTINUE
                << "deltaX: " << x
                << "\tdeltaR: " << b;
@@ -157,8 +158,8 @@ int CTestEnergyIncr::test(void)
                  << "failed to converge but goin on -"
                  << ", EnergyIncr: "  << pad(product)
                  << endln
-                 << ", Norm deltaX: " << pad(x.pNorm(nType))
-                 << ", Norm deltaR: " << pad(b.pNorm(nType))
+                 << ", Norm deltaX: " << pad(soeNorms.normX)
+                 << ", Norm deltaR: " << pad(soeNorms.normB)
                  << endln;
         }
         return currentIter;
@@ -173,8 +174,8 @@ int CTestEnergyIncr::test(void)
                    << "Iter: "      << pad(currentIter)
                    << ", EnergyIncr: "   << pad(product)
                    // << LOG_CONTINUE
-                   << ", Norm deltaX: "  << pad(x.pNorm(nType))
-                   << ", Norm deltaR: "  << pad(b.pNorm(nType))
+                   << ", Norm deltaX: "  << pad(soeNorms.normX)
+                   << ", Norm deltaR: "  << pad(soeNorms.normB)
                    << endln;
         }
         currentIter++;
@@ -92,9 +92,8 @@ int CTestFixedNumIter::test(void)
     }
 
     // determine the energy & save value in norms vector
-    const Vector &b = theSOE->getB();
-    const Vector &x = theSOE->getX();
-    double product = x ^ b;
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
+    double product = soeNorms.dotXB;
     if (product < 0.0)
         product *= -0.5;
     else
@@ -107,14 +106,14 @@ int CTestFixedNumIter::test(void)
     if (printFlag & ConvergenceTest::PrintTest)  {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", EnergyIncr: " << product;
-        opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+        opserr << " (Norm deltaX: " << soeNorms.normX << ", Norm deltaR: " << soeNorms.normB << ")\n";
     }
 
     if (printFlag & ConvergenceTest::PrintTest02)  {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", EnergyIncr: " << product;
-        opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
-        opserr << "\tdeltaX: " << x << "\tdeltaR: " << b;
+        opserr << " (Norm deltaX: " << soeNorms.normX << ", Norm deltaR: " << soeNorms.normB << ")\n";
+        opserr << "\tdeltaX: " << theSOE->getX() << "\tdeltaR: " << theSOE->getB();
     }
 
     //
@@ -129,7 +128,7 @@ int CTestFixedNumIter::test(void)
         if (printFlag & ConvergenceTest::PrintSuccess)  {
             opserr << LOG_SUCCESS << "Iter: " << pad(currentIter);
             opserr << " last EnergyIncr: " << product;
-            opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+            opserr << " (Norm deltaX: " << soeNorms.normX << ", Norm deltaR: " << soeNorms.normB << ")\n";
         }
 
         // return the number of times test has been called
@@ -92,8 +92,9 @@ int CTestNormDispIncr::test(void)
     }
 
     // get the X vector & determine it's norm & save the value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &x = theSOE->getX();
-    double norm = x.pNorm(nType);
+    double norm = soeNorms.normX;
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -102,7 +103,7 @@ int CTestNormDispIncr::test(void)
         opserr << LOG_ITERATE 
                << "Iter: "           << pad(currentIter)
                << ", Norm: "         << pad(norm) 
-               << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: "  << pad(soeNorms.normB)
                << endln;
     }
     else if (printFlag & ConvergenceTest::PrintTest02) {
@@ -111,7 +112,7 @@ int CTestNormDispIncr::test(void)
                << ", Norm: "         << pad(norm) 
                << endln;
         opserr << "\tNorm deltaX: "  << pad(norm) 
-               << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: "  << pad(soeNorms.normB)
                << endln
                << "\tdeltaX: "       << x
                << "\tdeltaR: "       << theSOE->getB();
@@ -132,7 +133,7 @@ int CTestNormDispIncr::test(void)
             opserr << LOG_SUCCESS 
                    << "Iter: "          << pad(currentIter)
                    << ", Norm: "        << pad(norm)
-                   << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+                   << ", Norm deltaR: " << pad(soeNorms.normB)
                    << endln;
         }
 
@@ -145,7 +146,7 @@ int CTestNormDispIncr::test(void)
         if (printFlag & ConvergenceTest::PrintFailure) {
             opserr << LOG_FAILURE
                    << ", Norm: " << pad(norm)  // << " (max: " << tol;
-                   << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+                   << ", Norm deltaR: " << pad(soeNorms.normB)
                    << LOG_CONTINUE
                    << "failed to converge but going on - "
                    << endln;
@@ -161,7 +162,7 @@ int CTestNormDispIncr::test(void)
                  // << LOG_CONTINUE
                  << "Iter: "             << pad(currentIter)
                  << ", Norm: "           << pad(norm)
-                 << ", Norm deltaR: "    << pad(theSOE->getB().pNorm(nType))
+                 << ", Norm deltaR: "    << pad(soeNorms.normB)
                  << endln;
         }
         currentIter++;
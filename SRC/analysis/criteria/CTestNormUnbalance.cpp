@@ -95,8 +95,9 @@ int CTestNormUnbalance::test(void)
     }
 
     // get the B vector & determine it's norm & save the value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &x = theSOE->getB();
-    double norm = x.pNorm(nType);
+    double norm = soeNorms.normB;
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -110,12 +111,12 @@ int CTestNormUnbalance::test(void)
     if (printFlag & ConvergenceTest::PrintTest) {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", Norm: " << pad(norm) << " (max: " << tol;
-        opserr << ", Norm deltaX: " << theSOE->getX().pNorm(nType) << ")\n";
+        opserr << ", Norm deltaX: " << soeNorms.normX << ")\n";
     }
     if (printFlag & ConvergenceTest::PrintTest02) {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", Norm: " << pad(norm) << " (max: " << tol << ")\n";
-        opserr << "\tNorm deltaX: " << theSOE->getX().pNorm(nType) << ", Norm deltaR: " << pad(norm) << "\n";
+        opserr << "\tNorm deltaX: " << soeNorms.normX << ", Norm deltaR: " << pad(norm) << "\n";
         opserr << "\tdeltaX: " << theSOE->getX() << "\tdeltaR: " << x;
     }
 
@@ -155,7 +156,7 @@ int CTestNormUnbalance::test(void)
         if (printFlag & ConvergenceTest::PrintSuccess || printFlag == 7) {
             opserr << LOG_SUCCESS << "Iter: " << pad(currentIter);
             opserr << ", Norm: " << pad(norm) << " (max: " << tol;
-            opserr << ", Norm deltaX: " << theSOE->getX().pNorm(nType) << ")\n";
+            opserr << ", Norm deltaX: " << soeNorms.normX << ")\n";
         }
 
         // return the number of times test has been called
@@ -168,7 +169,7 @@ int CTestNormUnbalance::test(void)
             opserr << LOG_FAILURE
                    //<< "criteria CTestNormUnbalance but going on -";
                    << ", Norm: " << pad(norm) 
-                   << ", Norm deltaX: " << pad(theSOE->getX().pNorm(nType))
+                   << ", Norm deltaX: " << pad(soeNorms.normX)
                    << "\n";
         }
         return currentIter;
@@ -182,7 +183,7 @@ int CTestNormUnbalance::test(void)
                    // << LOG_CONTINUE
                    << "Iter: "           << pad(currentIter)
                    << ", Norm: "         << pad(norm)
-                   << ", Norm deltaX: "  << pad(theSOE->getX().pNorm(nType)) 
+                   << ", Norm deltaX: "  << pad(soeNorms.normX) 
                    << "\n";
         }
         currentIter++;  // we increment in case analysis does not check for convergence
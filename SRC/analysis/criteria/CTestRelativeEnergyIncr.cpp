@@ -95,9 +95,10 @@ int CTestRelativeEnergyIncr::test(void)
 
 
     // determine the energy & save value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();
-    double product = x ^ b;
+    double product = soeNorms.dotXB;
     if (product < 0.0)
         product *= -0.5;
     else
@@ -127,8 +128,8 @@ int CTestRelativeEnergyIncr::test(void)
                << "Iter: "            << pad(currentIter)
                << ", dX*dR/dX1*dR1: " << pad(product)
                << endln
-               << ", Norm deltaX: "   << pad(x.pNorm(nType))
-               << ", Norm deltaR: "   << pad(b.pNorm(nType)) 
+               << ", Norm deltaX: "   << pad(soeNorms.normX)
+               << ", Norm deltaR: "   << pad(soeNorms.normB) 
                << endln
                << "\tdeltaX: "        << x 
                << "\tdeltaR: "        << b;
@@ -162,8 +163,8 @@ int CTestRelativeEnergyIncr::test(void)
                    //<< "criteria CTestRelativeEnergyIncr but goin on -"
                    << "Iter: "            << pad(currentIter)
                    << ", dX*dR/dX1*dR1: " << pad(product)
-                   << ", Norm deltaX: "  << pad(x.pNorm(nType))
-                   << ", Norm deltaR: "  << pad(b.pNorm(nType))
+                   << ", Norm deltaX: "  << pad(soeNorms.normX)
+                   << ", Norm deltaR: "  << pad(soeNorms.normB)
                    << endln;
         }
         return currentIter;
@@ -177,9 +178,9 @@ int CTestRelativeEnergyIncr::test(void)
                    // << LOG_CONTINUE
                    << "Iter: "           << pad(currentIter)
                    << ", dX*dR/dX1*dR1: " << pad(product)
-                   << ", Norm deltaX: "  << pad(x.pNorm(nType))
+                   << ", Norm deltaX: "  << pad(soeNorms.normX)
                    // << LOG_CONTINUE
-                   <<   "Norm deltaR: "  << pad(b.pNorm(nType))
+                   <<   "Norm deltaR: "  << pad(soeNorms.normB)
                    << endln;
         }
         currentIter++;
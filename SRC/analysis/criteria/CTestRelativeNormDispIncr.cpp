@@ -93,8 +93,9 @@ int CTestRelativeNormDispIncr::test(void)
     }
 
     // get the X vector & determine it's norm & save the value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &x = theSOE->getX();
-    double norm = x.pNorm(nType);
+    double norm = soeNorms.normX;
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -120,7 +121,7 @@ int CTestRelativeNormDispIncr::test(void)
                << " |dR|/|dR1|: "   << pad(norm)
                << endln;
         opserr << "\tNorm deltaX: " << pad(norm)
-               << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: " << pad(soeNorms.normB)
                << endln;
         opserr << "\tdeltaX: " << x
                << "\tdeltaR: " << theSOE->getB();
@@ -153,7 +154,7 @@ int CTestRelativeNormDispIncr::test(void)
             opserr << LOG_FAILURE
                    << "Iter: "        << pad(currentIter)
                    << " |dR|/|dR1|: "   << pad(norm)
-                   << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+                   << ", Norm deltaR: " << pad(soeNorms.normB)
                    //<< "criteria CTestRelativeNormDispIncr but going on -"
                    << endln;
         }
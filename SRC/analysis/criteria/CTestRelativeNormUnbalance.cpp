@@ -92,8 +92,9 @@ int CTestRelativeNormUnbalance::test(void)
     }
 
     // get the B vector & determine it's norm & save the value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &x = theSOE->getB();
-    double norm = x.pNorm(nType);
+    double norm = soeNorms.normB;
     if (currentIter <= maxNumIter)
         norms(currentIter) = norm;
 
@@ -113,7 +114,7 @@ int CTestRelativeNormUnbalance::test(void)
                << "Iter: "     << pad(currentIter)
                << ", |dR|/|dR0|: "  << pad(norm) 
                << endln //" (max: " << tol << ")\n"
-               << "\tNorm deltaX: " << pad(theSOE->getX().pNorm(nType)) 
+               << "\tNorm deltaX: " << pad(soeNorms.normX) 
                << ", Norm deltaR: " << pad(norm) 
                << endln
                << "\tdeltaX: "      << theSOE->getX() 
@@ -148,7 +149,7 @@ int CTestRelativeNormUnbalance::test(void)
             opserr << LOG_FAILURE 
                    //<< "criteria CTestRelativeNormUnbalance but going on -"
                    << ", dR/dR0: "       << pad(norm)
-                   << ", Norm deltaX: "  << pad(theSOE->getX().pNorm(nType)) 
+                   << ", Norm deltaX: "  << pad(soeNorms.normX) 
                    << endln;
         }
         return currentIter;
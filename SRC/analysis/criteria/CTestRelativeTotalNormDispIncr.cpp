@@ -97,8 +97,9 @@ int CTestRelativeTotalNormDispIncr::test(void)
     }
 
     // get the X vector & determine it's norm & save the value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &x = theSOE->getX();
-    double norm = x.pNorm(nType);
+    double norm = soeNorms.normX;
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -122,7 +123,7 @@ int CTestRelativeTotalNormDispIncr::test(void)
         opserr << ", |dR|/|dRtot|: " << pad(norm) 
                << endln;
         opserr << "\tNorm deltaX: "  << pad(norm) 
-               << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: "  << pad(soeNorms.normB)
                << endln;
         opserr << "\tdeltaX: "       << x 
                << "\tdeltaR: "       << theSOE->getB();
@@ -159,7 +160,7 @@ int CTestRelativeTotalNormDispIncr::test(void)
                    << ", |dR|/|dRtot|: " << pad(norm) 
                    << endln
                    << "\tNorm deltaX: "  << pad(norm)
-                   << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType)) 
+                   << ", Norm deltaR: "  << pad(soeNorms.normB) 
                    << endln;
         }
         return currentIter;
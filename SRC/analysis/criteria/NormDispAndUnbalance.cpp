@@ -98,11 +98,10 @@ int NormDispAndUnbalance::test(void)
     }
 
     // get the X vector & determine it's norm & save the value in norms vector
+    const LinearSOENorms &soeNorms = theSOE->formNorms(nType);
     const Vector &x = theSOE->getX();
-    double normX = x.pNorm(nType);
-
-    const Vector &b = theSOE->getB();
-    double normB = b.pNorm(nType);
+    double normX = soeNorms.normX;
+    double normB = soeNorms.normB;
 
     if ((currentIter>1 && norms(currentIter-2)<normX) || 
         (currentIter>1 && norms(maxNumIter+currentIter-2)<normB)) {
@@ -641,6 +641,13 @@ DOF_Group::getT(void)
 }
 
 
+bool
+DOF_Group::isTimeVaryingT(void) const
+{
+    return false;
+}
+
+
 
 void  
 DOF_Group::addLocalM_Force(const Vector &accel, double fact)
@@ -101,6 +101,7 @@ class DOF_Group: public TaggedObject
 	
     // method added for TransformationDOF_Groups
     virtual Matrix *getT(void);
+    virtual bool isTimeVaryingT(void) const;
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addM_ForceSensitivity(const Vector &Udotdot, double fact = 1.0);        
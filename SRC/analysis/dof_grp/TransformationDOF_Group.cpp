@@ -882,6 +882,13 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
 }
 
 
+bool
+TransformationDOF_Group::isTimeVaryingT(void) const
+{
+    return theMP != 0 && theMP->isTimeVarying();
+}
+
+
 Matrix *
 TransformationDOF_Group::getT(void)
 {
@@ -65,6 +65,7 @@ class TransformationDOF_Group: public DOF_Group
     const ID &getID(void) const; 
     virtual void setID(int dof, int value);    
     Matrix *getT(void);
+    bool isTimeVaryingT(void) const;
     virtual int getNumDOF(void) const;    
     virtual int getNumFreeDOF(void) const;
     virtual int getNumConstrainedDOF(void) const;
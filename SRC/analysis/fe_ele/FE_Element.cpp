@@ -38,6 +38,7 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <logging/Profiler.h>
 
 #define MAX_NUM_DOF 64
 
@@ -239,8 +240,10 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
   assert(myEle != nullptr);
 
   if (myEle->isSubdomain() == false) {
-    if (theNewIntegrator != nullptr)
+    if (theNewIntegrator != nullptr) {
+      OpenSees::ProfileElementScope<Element> scope(OpenSees::Profiler::ElementTangent, *myEle);
       theNewIntegrator->formEleTangent(this);
+    }
 
     return *theTangent;
 
@@ -377,6 +380,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     assert(myEle != nullptr);
 
     if (myEle->isSubdomain() == false) {
+      OpenSees::ProfileElementScope<Element> scope(OpenSees::Profiler::ElementResidual, *myEle);
       theNewIntegrator->formEleResidual(this);
       return *theResidual;
 
@@ -78,6 +78,12 @@ PenaltySP_FE::~PenaltySP_FE()
 
 }    
 
+SP_Constraint *
+PenaltySP_FE::getSP_Constraint(void) const
+{
+    return theSP;
+}
+
 // void setID(int index, int value);
 //	Method to set the corresponding index of the ID to value.
 
@@ -65,6 +65,8 @@ class PenaltySP_FE: public FE_Element
     virtual const Vector &getC_Force(const Vector &x, double fact = 1.0);
     virtual const Vector &getM_Force(const Vector &x, double fact = 1.0);    
 
+    SP_Constraint *getSP_Constraint(void) const;
+
   protected:
     
   private:
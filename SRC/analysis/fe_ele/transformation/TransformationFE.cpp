@@ -43,20 +43,17 @@
 // static variables initialisation
 Matrix **TransformationFE::modMatrices; 
 Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
 int TransformationFE::numTransFE(0);           
 int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
 double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
 int TransformationFE::sizeBuffer(0);            
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
 TransformationFE::TransformationFE(int tag, Element *ele)
 :FE_Element(tag, ele), theDOFs(0), numSPs(0), theSPs(0), modID(0), 
-  modTangent(0), modResidual(0), numGroups(0), numTransformedDOF(0)
+  modTangent(0), modResidual(0), numGroups(0), numTransformedDOF(0),
+  transformationsFormed(false), transformationsVary(false), anyTransformation(false)
 {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -91,22 +88,6 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	theDOFs[i] = theDofGroup;
     }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new one
-    if (numNodes > sizeTransformations) {
-	if (theTransformations != 0) 
-	    delete [] theTransformations;
-	
-	theTransformations = new Matrix *[numNodes];
-	if (theTransformations == 0) {
-	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
-	    opserr << "for array of pointers for Transformation matrices of size ";
-	    opserr << numNodes;
-	    exit(-1);
-	}		    
-	sizeTransformations = numNodes;
-    }	
-
     // if this is the first element of this type create the arrays for 
     // modified tangent and residual matrices
     if (numTransFE == 0) {
@@ -114,12 +95,9 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	modMatrices = new Matrix *[MAX_NUM_DOF+1];
 	modVectors  = new Vector *[MAX_NUM_DOF+1];
 	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
 	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
 	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
+	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0) {
 	    opserr << "TransformationFE::TransformationFE(Element *) ";
 	    opserr << " ran out of memory";	    
 	}
@@ -172,17 +150,10 @@ TransformationFE::~TransformationFE()
 	}
 	delete [] modMatrices;
 	delete [] modVectors;
-	delete [] theTransformations;
 	delete [] dataBuffer;
-	delete [] localKbuffer;
-	delete [] dofData;
 	modMatrices = 0;
 	modVectors = 0;
-	theTransformations = 0;
 	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
-	sizeTransformations = 0;
 	sizeBuffer = 0;
 	transCounter = 0;
     }
@@ -247,6 +218,9 @@ TransformationFE::setID(void)
 		return -3;
 	    }		
     }
+
+    // the transformations are formed again when next needed
+    transformationsFormed = false;
     
     // set the pointers to the modified tangent matrix and residual vector
     if (numTransformedDOF <= MAX_NUM_DOF) {
@@ -289,94 +263,138 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
-    
     // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for (int a = 0; a<numNode; a++) {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if (theT != 0)
-	numDOFs[a] = theT->noRows(); // T^ 
-      else
-	numDOFs[a] = theDOFs[a]->getNumDOF();
+
+    return this->transformTangent(theTangent);
+}
+
+
+//
+// Forms the nonzeros of the transformation of each node, by column. The
+// pattern is formed once after setID(), and again only if a node has a
+// transformation that varies in time.
+//
+void
+TransformationFE::formTransformations(void)
+{
+    if (transformationsFormed && !transformationsVary)
+	return;
+
+    transformations.resize(numGroups);
+    anyTransformation = false;
+    transformationsVary = false;
+
+    for (int a=0; a<numGroups; a++) {
+	NodeTransformation &theT = transformations[a];
+	const Matrix *T = theDOFs[a]->getT();
+	theT.start.clear();
+	theT.row.clear();
+	theT.value.clear();
+
+	if (T == 0) {
+	    theT.identity = true;
+	    theT.numOriginal = theDOFs[a]->getNumDOF();
+	    theT.numTransformed = theT.numOriginal;
+	    continue;
+	}
+
+	theT.identity = false;
+	theT.numOriginal = T->noRows();
+	theT.numTransformed = T->noCols();
+	for (int c=0; c<theT.numTransformed; c++) {
+	    theT.start.push_back((int)theT.row.size());
+	    for (int r=0; r<theT.numOriginal; r++)
+		if ((*T)(r,c) != 0.0) {
+		    theT.row.push_back(r);
+		    theT.value.push_back((*T)(r,c));
+		}
+	}
+	theT.start.push_back((int)theT.row.size());
+
+	anyTransformation = true;
+	if (theDOFs[a]->isTimeVaryingT())
+	    transformationsVary = true;
     }
 
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
+    transformationsFormed = true;
+}
+
+
+//
+// Forms T^t K T. As T is block diagonal this is T(i)^T K(i,j) T(j), where
+// the blocks are the dof of the nodes; the blocks of nodes without a
+// transformation are copied, and the others use the nonzeros of T only.
+// If no node is transformed the tangent is returned as it is.
+//
+const Matrix &
+TransformationFE::transformTangent(const Matrix &theTangent)
+{
+    this->formTransformations();
+    if (!anyTransformation)
+	return theTangent;
 
     int startRow = 0;
-    int noRowsTransformed = 0;
     int noRowsOriginal = 0;
 
-    static Matrix localK;
-
     // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
+    for (int i=0; i<numGroups; i++) {
+	const NodeTransformation &Ti = transformations[i];
+	int numDOFi = Ti.numOriginal;
 
 	int startCol = 0;
-	int numDOFi = numDOFs[i];	
 	int noColsOriginal = 0;
 
-	for (int j=0; j<numNode; j++) {
+	for (int j=0; j<numGroups; j++) {
+	    const NodeTransformation &Tj = transformations[j];
 
-	    const Matrix *Ti = theTransformations[i];
-	    const Matrix *Tj = theTransformations[j];
-	    int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer, numDOFi, numDOFj);
+	    if (Ti.identity && Tj.identity) {
+		for (int d=0; d<Tj.numOriginal; d++)
+		    for (int c=0; c<numDOFi; c++)
+			(*modTangent)(startRow+c, startCol+d) = theTangent(noRowsOriginal+c, noColsOriginal+d);
 
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFER	    
-	    for (int a=0; a<numDOFi; a++)
-		for (int b=0; b<numDOFj; b++)
-		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	    // now perform the matrix computation T(i)^T localK T(j)
-	    // note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-	    
-	    if (Ti != 0 && Tj != 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	    } else if (Ti == 0 && Tj != 0) {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	    } else if (Ti != 0 && Tj == 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
 	    } else {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
+		// K(i,j) T(j), by column
+		double *KT = dataBuffer;
+		for (int d=0; d<Tj.numTransformed; d++) {
+		    double *KTd = KT + d*numDOFi;
+		    if (Tj.identity) {
+			for (int c=0; c<numDOFi; c++)
+			    KTd[c] = theTangent(noRowsOriginal+c, noColsOriginal+d);
+		    } else {
+			for (int c=0; c<numDOFi; c++)
+			    KTd[c] = 0.0;
+			for (int p=Tj.start[d]; p<Tj.start[d+1]; p++) {
+			    int col = noColsOriginal + Tj.row[p];
+			    double t = Tj.value[p];
+			    for (int c=0; c<numDOFi; c++)
+				KTd[c] += t*theTangent(noRowsOriginal+c, col);
+			}
+		    }
+		}
+
+		// T(i)^T K(i,j) T(j)
+		for (int d=0; d<Tj.numTransformed; d++) {
+		    const double *KTd = KT + d*numDOFi;
+		    if (Ti.identity) {
+			for (int c=0; c<numDOFi; c++)
+			    (*modTangent)(startRow+c, startCol+d) = KTd[c];
+		    } else {
+			for (int c=0; c<Ti.numTransformed; c++) {
+			    double sum = 0.0;
+			    for (int p=Ti.start[c]; p<Ti.start[c+1]; p++)
+				sum += Ti.value[p]*KTd[Ti.row[p]];
+			    (*modTangent)(startRow+c, startCol+d) = sum;
+			}
+		    }
+		}
 	    }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-	    
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
+
+	    startCol += Tj.numTransformed;
+	    noColsOriginal += Tj.numOriginal;
 	}
 
 	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
+	startRow += Ti.numTransformed;
     }
 
     return *modTangent;
@@ -389,49 +407,32 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 {
     const Vector &theResidual = this->FE_Element::getResidual(theNewIntegrator);
     // DO THE SP STUFF TO THE TANGENT
-    
+
+    this->formTransformations();
+    if (!anyTransformation)
+	return theResidual;
+
     // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
     // where blocks are of size equal to num ele dof at a node
 
     int startRowTransformed = 0;
     int startRowOriginal = 0;
-    int numNode = numGroups;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-	int noRows = 0;
-	int noCols = 0;
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	  noRows = Ti->noCols(); // T^
-	  noCols = Ti->noRows();
-
-	  /*
-	  Vector orig(noCols);
-	  Vector mod(noRows);
-	  for (int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-	    orig(k-startRowOriginal)= theResidual(k);
-	  mod = (*Ti)^orig;
-	  for (int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-	    (*modResidual)(k) = mod (k-startRowTransformed);
-
-	  */
-
-	  for (int j=0; j<noRows; j++) {
-	    double sum = 0.0;
-	    for (int k=0; k<noCols; k++)
-	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-	    (*modResidual)(startRowTransformed +j) = sum;
-	  }
 
+    for (int i=0; i<numGroups; i++) {
+	const NodeTransformation &Ti = transformations[i];
+	if (Ti.identity) {
+	    for (int j=0; j<Ti.numOriginal; j++)
+		(*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
 	} else {
-	  noCols = theDOFs[i]->getNumDOF();
-	  noRows = noCols;
-	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
+	    for (int j=0; j<Ti.numTransformed; j++) {
+		double sum = 0.0;
+		for (int p=Ti.start[j]; p<Ti.start[j+1]; p++)
+		    sum += Ti.value[p] * theResidual(startRowOriginal + Ti.row[p]);
+		(*modResidual)(startRowTransformed +j) = sum;
+	    }
 	}
-	startRowTransformed += noRows;
-	startRowOriginal += noCols;
+	startRowTransformed += Ti.numTransformed;
+	startRowOriginal += Ti.numOriginal;
     }
 
     return *modResidual;
@@ -453,99 +454,8 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addKtToTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
+  const Matrix &theTangent = this->transformTangent(this->FE_Element::getTangent(0));
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
   // get the components we need out of the vector
   // and place in a temporary vector
   Vector tmp(numTransformedDOF);
@@ -557,7 +467,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  modResidual->addMatrixVector(0.0, theTangent, tmp, 1.0);
 
   return *modResidual;
 }
@@ -568,99 +478,8 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addKiToTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
+  const Matrix &theTangent = this->transformTangent(this->FE_Element::getTangent(0));
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
   // get the components we need out of the vector
   // and place in a temporary vector
   Vector tmp(numTransformedDOF);
@@ -672,7 +491,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  modResidual->addMatrixVector(0.0, theTangent, tmp, 1.0);
 
   return *modResidual;
 }
@@ -682,99 +501,8 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addMtoTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
+  const Matrix &theTangent = this->transformTangent(this->FE_Element::getTangent(0));
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
   // get the components we need out of the vector
   // and place in a temporary vector
   Vector tmp(numTransformedDOF);
@@ -786,7 +514,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  modResidual->addMatrixVector(0.0, theTangent, tmp, 1.0);
 
   return *modResidual;
 }
@@ -796,99 +524,8 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addCtoTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
+  const Matrix &theTangent = this->transformTangent(this->FE_Element::getTangent(0));
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
   // get the components we need out of the vector
   // and place in a temporary vector
   Vector tmp(numTransformedDOF);
@@ -900,7 +537,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  modResidual->addMatrixVector(0.0, theTangent, tmp, 1.0);
 
   return *modResidual;
 }
@@ -977,31 +614,27 @@ TransformationFE::transformResponse(const Vector &modResp,
     // perform T R  -- as T is block diagonal do T(i) R(i)
     // where blocks are of size equal to num ele dof at a node
 
+    this->formTransformations();
+
     int startRowOriginal = 0;
     int startRowTransformed = 0;
-    int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
-
-    for (int i=0; i<numNode; i++) {
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	    noRows = Ti->noRows();
-	    noCols = Ti->noCols();
-	    for (int j=0; j<noRows; j++) {
-		double sum = 0.0;
-		for (int k=0; k<noCols; k++)
-		    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-		unmodResp(startRowOriginal + j) = sum;
-	    }
-	} else {
-	    noCols = theDOFs[i]->getNumDOF();
-	    noRows = noCols;
-	    for (int j=0; j<noCols; j++)
+
+    for (int i=0; i<numGroups; i++) {
+	const NodeTransformation &Ti = transformations[i];
+	if (Ti.identity) {
+	    for (int j=0; j<Ti.numOriginal; j++)
 		unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
+	} else {
+	    for (int j=0; j<Ti.numOriginal; j++)
+		unmodResp(startRowOriginal + j) = 0.0;
+	    for (int k=0; k<Ti.numTransformed; k++) {
+		double x = modResp(startRowTransformed + k);
+		for (int p=Ti.start[k]; p<Ti.start[k+1]; p++)
+		    unmodResp(startRowOriginal + Ti.row[p]) += Ti.value[p] * x;
+	    }
 	}
-	startRowOriginal += noRows;
-	startRowTransformed += noCols;
+	startRowOriginal += Ti.numOriginal;
+	startRowTransformed += Ti.numTransformed;
     }
 
     return 0;
@@ -37,6 +37,7 @@
 // What: "@(#) TransformationFE.h, revA"
 
 #include <FE_Element.h>
+#include <vector>
 class SP_Constraint;
 class DOF_Group;
 class TransformationConstraintHandler;
@@ -79,6 +80,16 @@ class TransformationFE: public FE_Element
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
     
   private:
+    void formTransformations(void);
+    const Matrix &transformTangent(const Matrix &theTangent);
+
+    // the nonzeros of the transformation of a node, stored by column
+    struct NodeTransformation {
+	int numOriginal, numTransformed;
+	bool identity;
+	std::vector<int> start, row;
+	std::vector<double> value;
+    };
     
     // private variables - a copy for each object of the class        
     DOF_Group **theDOFs;
@@ -90,17 +101,18 @@ class TransformationFE: public FE_Element
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
+
+    std::vector<NodeTransformation> transformations;
+    bool transformationsFormed; // set until the ID changes
+    bool transformationsVary;   // a node has a time varying transformation
+    bool anyTransformation;     // a node has a transformation
     
     // static variables - single copy for all objects of the class	
     static Matrix **modMatrices; // array of pointers to class wide matrices
     static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
     static int numTransFE;     // number of objects    
     static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
     static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
     static int sizeBuffer;
 };
 
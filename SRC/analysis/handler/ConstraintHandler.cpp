@@ -36,6 +36,8 @@
 #include <Integrator.h>
 #include <FE_EleIter.h>
 #include <FE_Element.h>
+#include <Element.h>
+#include <unordered_set>
 
 ConstraintHandler::ConstraintHandler(int clasTag)
 :MovableObject(clasTag),
@@ -77,6 +79,69 @@ ConstraintHandler::update(void)
   return 0;
 }
 
+int
+ConstraintHandler::handleElements(const std::vector<Element*> &added,
+                                  const std::vector<Element*> &removed)
+{
+  return -1;
+}
+
+int
+ConstraintHandler::handleSP_Constraints(const std::vector<SP_Constraint*> &added,
+                                        const std::vector<SP_Constraint*> &removed)
+{
+  return (added.empty() && removed.empty()) ? 0 : -1;
+}
+
+// Replace the FE_Elements of the removed elements and create plain 
+// FE_Elements for the added ones. Suitable for handlers that wrap
+// every element in an FE_Element regardless of its constraints.
+int
+ConstraintHandler::updateElementFEs(const std::vector<Element*> &added,
+                                    const std::vector<Element*> &removed)
+{
+  if (theAnalysisModelPtr == 0)
+    return -1;
+
+  for (Element *elePtr : added)
+    if (elePtr->isSubdomain())
+      return -1;
+
+  // find the FE_Elements of the removed elements; the elements
+  // themselves may have been deleted so only the address is used
+  std::unordered_set<Element*> gone(removed.begin(), removed.end());
+  std::vector<int> removeTags;
+  int nextTag = 0;
+
+  FE_EleIter &theEle = theAnalysisModelPtr->getFEs();
+  FE_Element *fePtr;
+  while ((fePtr = theEle()) != 0) {
+    if (fePtr->getTag() >= nextTag)
+      nextTag = fePtr->getTag() + 1;
+    if (gone.count(fePtr->getElement()) != 0)
+      removeTags.push_back(fePtr->getTag());
+  }
+
+  if (removeTags.size() != gone.size())
+    return -1;
+
+  for (int tag : removeTags)
+    delete theAnalysisModelPtr->removeFE_Element(tag);
+
+  // the DOF_Groups are already numbered, so the new 
+  // FE_Elements can set their IDs right away
+  for (Element *elePtr : added) {
+    fePtr = new FE_Element(nextTag++, elePtr);
+    if (theAnalysisModelPtr->addFE_Element(fePtr) == false || fePtr->setID() < 0) {
+      opserr << "WARNING ConstraintHandler::updateElementFEs() - failed to add element " 
+             << elePtr->getTag() << endln;
+      return -2;
+    }
+  }
+
+  return 0;
+}
+
 int
 ConstraintHandler::applyLoad(void)
 {
@@ -38,6 +38,7 @@
 //
 // What: "@(#) ConstraintHandler.h, revA"
 
+#include <vector>
 #include <MovableObject.h>
 
 class AnalysisMethod;
@@ -45,6 +46,8 @@ class ID;
 class Domain;
 class AnalysisModel;
 class Integrator;
+class Element;
+class SP_Constraint;
 class FEM_ObjectBroker;
 
 class ConstraintHandler : public MovableObject
@@ -62,9 +65,22 @@ class ConstraintHandler : public MovableObject
     virtual int update(void);
     virtual int applyLoad(void);
     virtual int doneNumberingDOF(void);
+
+    // patch the FE_Elements after elements have been added to or removed
+    // from the Domain with no other change since the last handle(); the
+    // DOF_Groups and their numbering are kept. A negative return means
+    // the handler does not support this and handle() must be invoked.
+    virtual int handleElements(const std::vector<Element*> &added,
+                               const std::vector<Element*> &removed);
+    // likewise for SP_Constraints added to or removed from nodes that
+    // already have a DOF_Group
+    virtual int handleSP_Constraints(const std::vector<SP_Constraint*> &added,
+                                     const std::vector<SP_Constraint*> &removed);
     virtual void clearAll(void) =0;    
 
   protected:
+    int updateElementFEs(const std::vector<Element*> &added,
+                         const std::vector<Element*> &removed);
     Domain *getDomainPtr(void) const;
     AnalysisModel *getAnalysisModelPtr(void) const;
     Integrator *getIntegratorPtr(void) const;
@@ -222,6 +222,15 @@ LagrangeConstraintHandler::handle(const ID *nodesLast)
 }
 
 
+int
+LagrangeConstraintHandler::handleElements(const std::vector<Element*> &added,
+                                          const std::vector<Element*> &removed)
+{
+  // elements are wrapped in plain FE_Elements whatever their constraints
+  return this->updateElementFEs(added, removed);
+}
+
+
 void 
 LagrangeConstraintHandler::clearAll(void)
 {
@@ -51,6 +51,8 @@ class LagrangeConstraintHandler : public ConstraintHandler
     ~LagrangeConstraintHandler();
 
     int handle(const ID *nodesNumberedLast =0);
+    int handleElements(const std::vector<Element*> &added,
+                       const std::vector<Element*> &removed);
     void clearAll(void);    
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
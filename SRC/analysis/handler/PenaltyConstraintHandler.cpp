@@ -27,6 +27,7 @@
 #include <AnalysisModel.h>
 #include <Domain.h>
 #include <FE_Element.h>
+#include <FE_EleIter.h>
 #include <DOF_Group.h>
 #include <Node.h>
 #include <Element.h>
@@ -44,6 +45,7 @@
 #include <PenaltySP_FE.h>
 #include <PenaltyMP_FE.h>
 #include <elementAPI.h>
+#include <unordered_set>
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_PenaltyConstraintHandler)
@@ -202,6 +204,68 @@ PenaltyConstraintHandler::handle(const ID *nodesLast)
 }
 
 
+int
+PenaltyConstraintHandler::handleElements(const std::vector<Element*> &added,
+                                         const std::vector<Element*> &removed)
+{
+  // elements are wrapped in plain FE_Elements whatever their constraints
+  return this->updateElementFEs(added, removed);
+}
+
+
+int
+PenaltyConstraintHandler::handleSP_Constraints(const std::vector<SP_Constraint*> &added,
+                                               const std::vector<SP_Constraint*> &removed)
+{
+  Domain *theDomain = this->getDomainPtr();
+  AnalysisModel *theModel = this->getAnalysisModelPtr();
+  if (theDomain == nullptr || theModel == nullptr)
+    return -1;
+
+  // the new constraints must restrain DOFs that are already numbered
+  for (SP_Constraint *spPtr : added) {
+    Node *nodPtr = theDomain->getNode(spPtr->getNodeTag());
+    if (nodPtr == nullptr || nodPtr->getDOF_GroupPtr() == nullptr)
+      return -1;
+  }
+
+  // find the PenaltySP_FEs of the removed constraints; the constraints
+  // themselves may have been deleted so only the address is used
+  std::unordered_set<SP_Constraint*> gone(removed.begin(), removed.end());
+  std::vector<int> removeTags;
+  int nextTag = 0;
+
+  FE_EleIter &theFEs = theModel->getFEs();
+  FE_Element *fePtr;
+  while ((fePtr = theFEs()) != nullptr) {
+    if (fePtr->getTag() >= nextTag)
+      nextTag = fePtr->getTag() + 1;
+    PenaltySP_FE *spFE = dynamic_cast<PenaltySP_FE *>(fePtr);
+    if (spFE != nullptr && gone.count(spFE->getSP_Constraint()) != 0)
+      removeTags.push_back(fePtr->getTag());
+  }
+
+  if (removeTags.size() != gone.size())
+    return -1;
+
+  for (int tag : removeTags)
+    delete theModel->removeFE_Element(tag);
+
+  // a penalty only adds to the diagonal of the restrained DOF, 
+  // so the sparsity of the system of equations is unchanged
+  for (SP_Constraint *spPtr : added) {
+    fePtr = new PenaltySP_FE(nextTag++, *theDomain, *spPtr, alphaSP);
+    if (theModel->addFE_Element(fePtr) == false || fePtr->setID() < 0) {
+      opserr << "WARNING PenaltyConstraintHandler::handleSP_Constraints() - failed to add "
+             << "the constraint at node " << spPtr->getNodeTag() << endln;
+      return -2;
+    }
+  }
+
+  return 0;
+}
+
+
 void 
 PenaltyConstraintHandler::clearAll(void)
 {
@@ -51,6 +51,10 @@ class PenaltyConstraintHandler : public ConstraintHandler
     ~PenaltyConstraintHandler();
 
     int handle(const ID *nodesNumberedLast =0);
+    int handleElements(const std::vector<Element*> &added,
+                       const std::vector<Element*> &removed);
+    int handleSP_Constraints(const std::vector<SP_Constraint*> &added,
+                             const std::vector<SP_Constraint*> &removed);
     void clearAll(void);    
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
@@ -247,6 +247,15 @@ PlainHandler::handle(const ID *nodesLast)
 }
 
 
+int
+PlainHandler::handleElements(const std::vector<Element*> &added,
+                             const std::vector<Element*> &removed)
+{
+  // elements are wrapped in plain FE_Elements whatever their constraints
+  return this->updateElementFEs(added, removed);
+}
+
+
 void 
 PlainHandler::clearAll(void)
 {
@@ -42,6 +42,8 @@ class PlainHandler : public ConstraintHandler
     ~PlainHandler();
 
     int handle(const ID *nodesNumberedLast =nullptr);
+    int handleElements(const std::vector<Element*> &added,
+                       const std::vector<Element*> &removed);
     void clearAll(void);    
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -31,6 +31,8 @@
 
 #include <TransformationConstraintHandler.h>
 #include <stdlib.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <AnalysisModel.h>
 #include <Domain.h>
@@ -103,12 +105,16 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	numSPConstraints++;
     
     numDOF = 0;
-    ID transformedNode(0, 64);
+
+    // the constrained nodes, and the first MP and SP_Constraint of each;
+    // the lookups are hashed as models may have many constrained nodes
+    std::unordered_set<int> transformedNode;
+    std::unordered_map<int, int> mpOfNode;
+    std::unordered_map<int, int> spOfNode;
 
     int i;
     
-    // create an ID of constrained node tags in MP_Constraints
-    ID constrainedNodesMP(0, numMPConstraints);
+    // create an array of the MP_Constraints
     MP_Constraint **mps =0;
     if (numMPConstraints != 0) {
 	mps = new MP_Constraint *[numMPConstraints];
@@ -123,16 +129,18 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int index = 0;
 	while ((theMP = theMPs()) != 0) {
 	  int nodeConstrained = theMP->getNodeConstrained();
-	  if (transformedNode.getLocation(nodeConstrained) < 0)
-	    transformedNode[numDOF++] = nodeConstrained;
-	  constrainedNodesMP[index] = nodeConstrained;
+	  if (transformedNode.insert(nodeConstrained).second)
+	    numDOF++;
+	  mpOfNode.emplace(nodeConstrained, index);
 	  mps[index] = theMP;
 	  index++;
 	}	
     }
 
-    // create an ID of constrained node tags in SP_Constraints
-    ID constrainedNodesSP(0, numSPConstraints);;
+    // create an array of the SP_Constraints, with the next
+    // SP_Constraint on the same node for each
+    ID nextSP(0, numSPConstraints);
+    std::unordered_map<int, int> lastSP;
     SP_Constraint **sps =0;
     if (numSPConstraints != 0) {
 	sps = new SP_Constraint *[numSPConstraints];
@@ -149,9 +157,17 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int index = 0;
 	while ((theSP = theSPs()) != 0) {
 	  int constrainedNode = theSP->getNodeTag();
-	  if (transformedNode.getLocation(constrainedNode) < 0)
-	    transformedNode[numDOF++] = constrainedNode;	    
-	  constrainedNodesSP[index] = constrainedNode;
+	  if (transformedNode.insert(constrainedNode).second)
+	    numDOF++;
+	  nextSP[index] = -1;
+	  auto last = lastSP.find(constrainedNode);
+	  if (last != lastSP.end()) {
+	    nextSP[last->second] = index;
+	    last->second = index;
+	  } else {
+	    spOfNode.emplace(constrainedNode, index);
+	    lastSP.emplace(constrainedNode, index);
+	  }
 	  sps[index] = theSP;
 	  index++;
 	}	
@@ -186,8 +202,9 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int loc = -1;
 	int createdDOF = 0;
 
-	loc = constrainedNodesMP.getLocation(nodeTag);
-	if (loc >= 0) {
+	auto mp = mpOfNode.find(nodeTag);
+	if (mp != mpOfNode.end()) {
+	  loc = mp->second;
 
 	  TransformationDOF_Group *tDofPtr = 
 	    new TransformationDOF_Group(numDofGrp++, nodPtr, mps[loc], this); 
@@ -197,13 +214,12 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	  
 	  // add any SPs
 	  if (numSPConstraints != 0) {
-	    loc = constrainedNodesSP.getLocation(nodeTag);
+	    auto sp = spOfNode.find(nodeTag);
+	    loc = (sp != spOfNode.end()) ? sp->second : -1;
 	    if (loc >= 0) {
 	      tDofPtr->addSP_Constraint(*(sps[loc]));
-	      for (int i = loc+1; i<numSPConstraints; i++) {
-		if (constrainedNodesSP(i) == nodeTag)
-		  tDofPtr->addSP_Constraint(*(sps[i]));
-	      }
+	      for (int i = nextSP(loc); i >= 0; i = nextSP(i))
+		tDofPtr->addSP_Constraint(*(sps[i]));
 	    }
 	    // add the DOF to the array	    
 	    theDOFs[numDOF++] = dofPtr;	    	    
@@ -212,7 +228,8 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	}
 	
 	if (createdDOF == 0) {
-	  loc = constrainedNodesSP.getLocation(nodeTag);
+	  auto sp = spOfNode.find(nodeTag);
+	  loc = (sp != spOfNode.end()) ? sp->second : -1;
 	  if (loc >= 0) {
 	    TransformationDOF_Group *tDofPtr = 
 	      new TransformationDOF_Group(numDofGrp++, nodPtr, this);
@@ -223,11 +240,9 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	    tDofPtr->addSP_Constraint(*(sps[loc]));
 	
 	    // check for more SP_constraints acting on node and add them
-	    for (int i = loc+1; i<numSPConstraints; i++) {
-	      if (constrainedNodesSP(i) == nodeTag) {
-		tDofPtr->addSP_Constraint(*(sps[i]));
-		numSPs++;
-	      }
+	    for (int i = nextSP(loc); i >= 0; i = nextSP(i)) {
+	      tDofPtr->addSP_Constraint(*(sps[i]));
+	      numSPs++;
 	    }
 	    // add the DOF to the array
 	    theDOFs[numDOF++] = dofPtr;	    	    
@@ -263,7 +278,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
     FE_Element *fePtr;
 
     numFE = 0;
-    ID transformedEle(0, 64);
+    std::unordered_set<int> transformedEle;
 
     while ((elePtr = theEle()) != 0) {
       int flag = 0;
@@ -279,25 +294,15 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int nodesSize = nodes.Size();
 	int isConstrainedNode = 0;
 	for (int i=0; i<nodesSize; i++) {
-	  int nodeTag = nodes(i);
-	  if (numMPConstraints != 0) {
-	    int loc = constrainedNodesMP.getLocation(nodeTag);
-	    if (loc >= 0) {
-	      isConstrainedNode = 1;
-	      i = nodesSize;
-	    }
-	  } 
-	  if (numSPConstraints != 0 && isConstrainedNode == 0) {
-	    int loc = constrainedNodesSP.getLocation(nodeTag);
-	    if (loc >= 0) {
-	      isConstrainedNode = 1;		    
-	      i = nodesSize;
-	    }
+	  if (transformedNode.count(nodes(i)) != 0) {
+	    isConstrainedNode = 1;
+	    break;
 	  }
 	}
 	
 	if (isConstrainedNode == 1) {
-	  transformedEle[numFE++] = elePtr->getTag();
+	  transformedEle.insert(elePtr->getTag());
+	  numFE++;
 	}
       }
     }
@@ -324,7 +329,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	Subdomain *theSub = (Subdomain *)elePtr;
 	if (theSub->doesIndependentAnalysis() == false) {
 	  
-	  if (transformedEle.getLocation(tag) < 0) {
+	  if (transformedEle.count(tag) == 0) {
 	    if ((fePtr = new FE_Element(numFeEle, elePtr)) == 0) {
 	      opserr << "WARNING TransformationConstraintHandler::handle()";
 	      opserr << " - ran out of memory";
@@ -350,7 +355,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	  theSub->setFE_ElementPtr(fePtr);
 	}
       } else {
-	if (transformedEle.getLocation(tag) < 0) {
+	if (transformedEle.count(tag) == 0) {
 	  if ((fePtr = new FE_Element(numFeEle, elePtr)) == 0) {
 	    opserr << "WARNING TransformationConstraintHandler::handle()";
 	    opserr << " - ran out of memory";
@@ -36,6 +36,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <Domain.h>
 #define OPS_Export 
 
 
@@ -57,7 +58,7 @@ OPS_ADD_RUNTIME_VPV(OPS_CentralDifferenceNoDamping)
 CentralDifferenceNoDamping::CentralDifferenceNoDamping()
 :TransientIntegrator(INTEGRATOR_TAGS_CentralDifferenceNoDamping),
  updateCount(0), 
- U(0), Udot(0), Udotdot(0), deltaT(0)
+ U(0), Udot(0), Udotdot(0), deltaT(0), criticalStep(-1.0), criticalStepBound(0.0)
 {
     
 }
@@ -86,6 +87,8 @@ CentralDifferenceNoDamping::newStep(double _deltaT)
     return -2;	
   }
 
+  this->checkTimeStep(deltaT);
+
   AnalysisModel *theModel = this->getAnalysisModel();
   double time = theModel->getCurrentDomainTime();
   theModel->applyLoadDomain(time);
@@ -93,6 +96,25 @@ CentralDifferenceNoDamping::newStep(double _deltaT)
   return 0;
 }
 
+double
+CentralDifferenceNoDamping::getCriticalTimeStep()
+{
+  if (criticalStep < 0.0) {
+    AnalysisModel *theModel = this->getAnalysisModel();
+    if (theModel == 0)
+      return 0.0;
+    criticalStep = theModel->getDomainPtr()->getCriticalTimeStep(&criticalStepBound);
+  }
+  return criticalStep;
+}
+
+double
+CentralDifferenceNoDamping::getCriticalTimeStepBound()
+{
+  this->getCriticalTimeStep();
+  return criticalStepBound;
+}
+
 int
 CentralDifferenceNoDamping::formEleTangent(FE_Element *theEle)
 {
@@ -130,6 +152,7 @@ CentralDifferenceNoDamping::formNodUnbalance(DOF_Group *theDof)
 int 
 CentralDifferenceNoDamping::domainChanged()
 {
+  criticalStep = -1.0;
   AnalysisModel *myModel = this->getAnalysisModel();
   LinearSOE *theLinSOE = this->getLinearSOE();
   const Vector &x = theLinSOE->getX();
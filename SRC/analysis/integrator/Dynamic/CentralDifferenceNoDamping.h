@@ -56,6 +56,8 @@ class CentralDifferenceNoDamping : public TransientIntegrator
 
     int domainChanged();    
     int newStep(double deltaT);    
+    double getCriticalTimeStep();
+    double getCriticalTimeStepBound();
     int update(const Vector &deltaU);
 
     int commit();
@@ -76,6 +78,8 @@ class CentralDifferenceNoDamping : public TransientIntegrator
     Vector *Udot;       // vel response quantity at time t-1/2 delta t
     Vector *Udotdot;    // accel response at time t
     double deltaT;
+    double criticalStep;  // estimated critical step, < 0 if not yet estimated
+    double criticalStepBound;
 };
 
 #endif
@@ -10,6 +10,13 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <Domain.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <math.h>
+#include <algorithm>
 #define OPS_Export 
 
 
@@ -32,7 +39,8 @@ ExplicitDifference::ExplicitDifference()
 	alphaM(0.0), betaK(0.0), betaKi(0.0), betaKc(0.0),
 	updateCount(0), c2(0.0), c3(0.0),
     Ut(0), Utdot(0), Utdotdot(0),
-	Udot(0), Utdotdot1(0), U(0), Utdot1(0)
+	Udot(0), Utdotdot1(0), U(0), Utdot1(0),
+	criticalStep(-1.0), criticalStepBound(0.0)
 {
 
 }
@@ -45,7 +53,8 @@ ExplicitDifference::ExplicitDifference(
 	alphaM(_alphaM), betaK(_betaK), betaKi(_betaKi), betaKc(_betaKc),
 	updateCount(0), c2(0.0), c3(0.0),
 	Ut(0), Utdot(0), Utdotdot(0),
-	Udot(0), Utdotdot1(0), U(0), Utdot1(0)
+	Udot(0), Utdotdot1(0), U(0), Utdot1(0),
+	criticalStep(-1.0), criticalStepBound(0.0)
 {
 
 }
@@ -85,6 +94,8 @@ int ExplicitDifference::newStep(double _deltaT)
 		return -1;
 	}
 
+	this->checkTimeStep(deltaT);
+
 	// get a pointer to the AnalysisModel
 	AnalysisModel *theModel = this->getAnalysisModel();
 
@@ -121,6 +132,64 @@ int ExplicitDifference::newStep(double _deltaT)
 }
 
 
+double ExplicitDifference::getCriticalTimeStep(void)
+{
+	// central difference limit 2/omega_max, reduced for the Rayleigh
+	// damping ratio at omega_max to 2/omega_max (sqrt(1+xi^2) - xi)
+	if (criticalStep < 0.0) {
+		AnalysisModel *theModel = this->getAnalysisModel();
+		if (theModel == 0)
+			return 0.0;
+		criticalStep = theModel->getDomainPtr()->getCriticalTimeStep(&criticalStepBound);
+		criticalStep = this->getDampedStep(criticalStep);
+		criticalStepBound = this->getDampedStep(criticalStepBound);
+	}
+	return criticalStep;
+}
+
+
+double ExplicitDifference::getDampedStep(double undampedStep)
+{
+	if (undampedStep <= 0.0)
+		return undampedStep;
+
+	// the largest Rayleigh factors of the integrator, the elements and
+	// the nodes, as set e.g. by the rayleigh command
+	double a = alphaM;
+	double b = betaK + betaKi + betaKc;
+	AnalysisModel *theModel = this->getAnalysisModel();
+	if (theModel != 0) {
+		Domain *theDomain = theModel->getDomainPtr();
+		double eleAlphaM, eleBetaK, eleBetaK0, eleBetaKc;
+		Element *theEle;
+		ElementIter &theEles = theDomain->getElements();
+		while ((theEle = theEles()) != 0) {
+			theEle->getRayleighDampingFactors(eleAlphaM, eleBetaK, eleBetaK0, eleBetaKc);
+			a = std::max(a, eleAlphaM);
+			b = std::max(b, eleBetaK + eleBetaK0 + eleBetaKc);
+		}
+		Node *theNode;
+		NodeIter &theNodes = theDomain->getNodes();
+		while ((theNode = theNodes()) != 0)
+			a = std::max(a, theNode->getRayleighDampingFactor());
+	}
+
+	double omega = 2.0/undampedStep;
+	double xi = 0.5*a/omega + 0.5*b*omega;
+	if (xi <= 0.0)
+		return undampedStep;
+
+	return undampedStep*(sqrt(1.0 + xi*xi) - xi);
+}
+
+
+double ExplicitDifference::getCriticalTimeStepBound(void)
+{
+	this->getCriticalTimeStep();
+	return criticalStepBound;
+}
+
+
 int ExplicitDifference::formEleTangent(FE_Element *theEle)
 {
 	theEle->zeroTangent();
@@ -143,6 +212,7 @@ int ExplicitDifference::formNodTangent(DOF_Group *theDof)
 
 int ExplicitDifference::domainChanged()
 {
+	criticalStep = -1.0;
 
 	AnalysisModel *theModel = this->getAnalysisModel();
 	LinearSOE *theLinSOE = this->getLinearSOE();
@@ -26,6 +26,8 @@ public:
 
 	int domainChanged(void);
 	int newStep(double deltaT);
+	double getCriticalTimeStep(void);
+	double getCriticalTimeStepBound(void);
 	int update(const Vector &U);
 
 	int commit(void);
@@ -38,6 +40,8 @@ public:
 
 protected:
 private:
+	double getDampedStep(double undampedStep);
+
 	double deltaT;
 	static double deltaT1;
 	double alphaM;
@@ -50,6 +54,8 @@ private:
 	Vector *U, *Ut;
 	Vector  *Utdotdot, *Utdotdot1;
 	Vector *Udot, *Utdot, *Utdot1;
+	double criticalStep;  // estimated critical step, < 0 if not yet estimated
+	double criticalStepBound;
 
 };
 
@@ -961,7 +961,7 @@ GeneralizedNewmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads
 
     const ID &id = dofPtr->getID();
     int idSize = id.Size();
-    const Vector &dispSens = dofPtr->getDispSensitivity(gradNumber);
+    const Vector &dispSens = dofPtr->getDispSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -969,7 +969,7 @@ GeneralizedNewmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads
       }
     }
 
-    const Vector &velSens = dofPtr->getVelSensitivity(gradNumber);
+    const Vector &velSens = dofPtr->getVelSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -977,7 +977,7 @@ GeneralizedNewmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads
       }
     }
 
-    const Vector &accelSens = dofPtr->getAccSensitivity(gradNumber);
+    const Vector &accelSens = dofPtr->getAccSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -1044,56 +1044,6 @@ GeneralizedNewmark::getCFactor()
 int 
 GeneralizedNewmark::computeSensitivities()
 {
-
-  LinearSOE *theSOE = this->getLinearSOE();
-
-  // Zero out the old right-hand side of the SOE
-  theSOE->zeroB();
-  
-  // Form the part of the RHS which are indepent of parameter
-  this->formIndependentSensitivityRHS();
-  AnalysisModel *theModel = this->getAnalysisModel();  //Abbas 
-  Domain *theDomain=theModel->getDomainPtr();//Abbas
-  ParameterIter &paramIter = theDomain->getParameters();
-
-  Parameter *theParam;
-  // De-activate all parameters
-  while ((theParam = paramIter()) != nullptr)
-    theParam->activate(false);
-  
-  // Now, compute sensitivity wrt each parameter
-  int numGrads = theDomain->getNumParameters();
-
-  paramIter = theDomain->getParameters();
-  
-  while ((theParam = paramIter()) != nullptr) {
-    
-    // Activate this parameter
-    theParam->activate(true);
-    
-    // Zero the RHS vector
-    theSOE->zeroB();
-    
-    // Get the grad index for this parameter
-    int gradIndex = theParam->getGradIndex();
-
-    // Form the RHS
-    this->formSensitivityRHS(gradIndex);
-    
-    // Solve for displacement sensitivity 
-    theSOE->solve();
-
-    // Save sensitivity to nodes
-    this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-    
-
-    // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-    this->commitSensitivity(gradIndex, numGrads);
-    
-    // De-activate this parameter for next parameter sensitivity
-    theParam->activate(false);
-  }
-  
-  return 0;
+  return this->computeParameterSensitivities();
 }
 
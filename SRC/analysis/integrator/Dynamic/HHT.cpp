@@ -34,6 +34,7 @@
 #include <AnalysisModel.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <math.h>
 #include <elementAPI.h>
 
 
@@ -417,6 +418,16 @@ HHT::getVel()
   return *Udot;
 }
 
+//
+// The displacements are updated as by Newmark, so the estimate of
+// Zienkiewicz and Xie (1991) holds: e = dT^2 (beta - 1/6) (A_{n+1} - A_n)
+//
+double
+HHT::getLocalErrorConstant(void) const
+{
+  return fabs(beta - 1.0/6.0);
+}
+
 int HHT::sendSelf(int cTag, Channel &theChannel)
 {
     Vector data(3);
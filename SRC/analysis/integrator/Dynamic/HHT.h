@@ -57,6 +57,7 @@ public:
     int commit(void);
 
     const Vector &getVel(void);
+    double getLocalErrorConstant(void) const;
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -40,6 +40,8 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <Domain.h>
+#include <math.h>
 #define OPS_Export
 
 
@@ -100,7 +102,7 @@ HHTExplicit::HHTExplicit()
     alpha(1.0), gamma(0.5), updElemDisp(false),
     deltaT(0.0), updateCount(0), c2(0.0), c3(0.0), 
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-    Ualpha(0), Ualphadot(0)
+    Ualpha(0), Ualphadot(0), criticalStep(-1.0), criticalStepBound(0.0)
 {
     
 }
@@ -112,7 +114,7 @@ HHTExplicit::HHTExplicit(double _alpha,
     alpha(_alpha), gamma(0.5), updElemDisp(updelemdisp),
     deltaT(0.0), updateCount(0), c2(0.0), c3(0.0), 
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-    Ualpha(0), Ualphadot(0)
+    Ualpha(0), Ualphadot(0), criticalStep(-1.0), criticalStepBound(0.0)
 {
     
 }
@@ -124,7 +126,7 @@ HHTExplicit::HHTExplicit(double _alpha, double _gamma,
     alpha(_alpha), gamma(_gamma), updElemDisp(updelemdisp),
     deltaT(0.0), updateCount(0), c2(0.0), c3(0.0), 
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-    Ualpha(0), Ualphadot(0)
+    Ualpha(0), Ualphadot(0), criticalStep(-1.0), criticalStepBound(0.0)
 {
     
 }
@@ -168,6 +170,8 @@ int HHTExplicit::newStep(double _deltaT)
         opserr << "dT = " << deltaT << endln;
         return -2;
     }
+
+    this->checkTimeStep(deltaT);
     
     // get a pointer to the AnalysisModel
     AnalysisModel *theModel = this->getAnalysisModel();
@@ -231,6 +235,28 @@ int HHTExplicit::revertToLastStep()
 }
 
 
+double HHTExplicit::getCriticalTimeStep(void)
+{
+    // for beta = 0 the limit is Omega = omega*dT <= sqrt(2/gamma),
+    // i.e. the central difference limit 2/omega scaled by 1/sqrt(2*gamma)
+    if (criticalStep < 0.0) {
+        AnalysisModel *theModel = this->getAnalysisModel();
+        if (theModel == 0 || gamma <= 0.0)
+            return 0.0;
+        criticalStep = theModel->getDomainPtr()->getCriticalTimeStep(&criticalStepBound)/sqrt(2.0*gamma);
+        criticalStepBound /= sqrt(2.0*gamma);
+    }
+    return criticalStep;
+}
+
+
+double HHTExplicit::getCriticalTimeStepBound(void)
+{
+    this->getCriticalTimeStep();
+    return criticalStepBound;
+}
+
+
 int HHTExplicit::formEleTangent(FE_Element *theEle)
 {
     theEle->zeroTangent();
@@ -255,6 +281,7 @@ int HHTExplicit::formNodTangent(DOF_Group *theDof)
 
 int HHTExplicit::domainChanged()
 {
+    criticalStep = -1.0;
     AnalysisModel *theModel = this->getAnalysisModel();
     LinearSOE *theLinSOE = this->getLinearSOE();
     const Vector &x = theLinSOE->getX();
@@ -56,6 +56,8 @@ public:
     
     int domainChanged(void);
     int newStep(double deltaT);
+    double getCriticalTimeStep(void);
+    double getCriticalTimeStepBound(void);
     int revertToLastStep(void);
     int update(const Vector &aiPlusOne);
     int commit(void);
@@ -80,6 +82,8 @@ private:
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
     Vector *U, *Udot, *Udotdot;     // response quantities at time t + deltaT
     Vector *Ualpha, *Ualphadot;     // response quantities at time t+alpha*deltaT
+    double criticalStep;            // estimated critical step, < 0 if not yet estimated
+    double criticalStepBound;
 };
 
 #endif
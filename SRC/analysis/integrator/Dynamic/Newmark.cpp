@@ -38,6 +38,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <string.h>
+#include <math.h>
 #include <NodeIter.h>
 #include <Domain.h>
 #include <Node.h> // for sensitivity
@@ -245,6 +246,15 @@ Newmark::getVel()
   return *Udot;
 }
 
+//
+// Zienkiewicz and Xie (1991): e = dT^2 (beta - 1/6) (A_{n+1} - A_n)
+//
+double
+Newmark::getLocalErrorConstant(void) const
+{
+  return fabs(beta - 1.0/6.0);
+}
+
 int Newmark::revertToLastStep()
 {
   // set response at t+deltaT to be that at t .. for next newStep
@@ -818,7 +828,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
 
     const ID &id = dofPtr->getID();
     int idSize = id.Size();
-    const Vector &dispSens = dofPtr->getDispSensitivity(gradNumber);
+    const Vector &dispSens = dofPtr->getDispSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -826,7 +836,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
       }
     }
 
-    const Vector &velSens = dofPtr->getVelSensitivity(gradNumber);
+    const Vector &velSens = dofPtr->getVelSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -834,7 +844,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
       }
     }
 
-    const Vector &accelSens = dofPtr->getAccSensitivity(gradNumber);
+    const Vector &accelSens = dofPtr->getAccSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -903,57 +913,6 @@ Newmark::getCFactor(void) {
 int 
 Newmark::computeSensitivities(void)
 {
-
-  LinearSOE *theSOE = this->getLinearSOE();
-
-  // Zero out the old right-hand side of the SOE
-  theSOE->zeroB();
-  
-  // Form the part of the RHS which are indepent of parameter
-  this->formIndependentSensitivityRHS();
-  AnalysisModel *theModel = this->getAnalysisModel();  //Abbas 
-  Domain *theDomain=theModel->getDomainPtr();//Abbas
-  ParameterIter &paramIter = theDomain->getParameters();
-
-  Parameter *theParam;
-
-  // De-activate all parameters
-  while ((theParam = paramIter()) != 0)
-    theParam->activate(false);
-  
-  // Now, compute sensitivity wrt each parameter
-  int numGrads = theDomain->getNumParameters();
-
-  paramIter = theDomain->getParameters();
-
-  while ((theParam = paramIter()) != 0) {
-    
-    // Activate this parameter
-    theParam->activate(true);
-    
-    // Zero the RHS vector
-    theSOE->zeroB();
-    
-    // Get the grad index for this parameter
-    int gradIndex = theParam->getGradIndex();
-
-    // Form the RHS
-    this->formSensitivityRHS(gradIndex);
-    
-    // Solve for displacement sensitivity
-    
-    theSOE->solve();
-    // Save sensitivity to nodes
-    this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-    
-
-    // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-    this->commitSensitivity(gradIndex, numGrads);
-    
-    // De-activate this parameter for next sensitivity calc
-    theParam->activate(false);
-  }
-  
-  return 0;
+  return this->computeParameterSensitivities();
 }
 
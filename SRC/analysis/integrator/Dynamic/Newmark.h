@@ -67,6 +67,7 @@ public:
     double getCFactor();
 
     const Vector &getVel();
+    double getLocalErrorConstant(void) const;
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
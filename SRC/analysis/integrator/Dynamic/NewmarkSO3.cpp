@@ -777,7 +777,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
 
     const ID &id = dofPtr->getID();
     int idSize = id.Size();
-    const Vector &dispSens = dofPtr->getDispSensitivity(gradNumber);
+    const Vector &dispSens = dofPtr->getDispSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -785,7 +785,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
       }
     }
 
-    const Vector &velSens = dofPtr->getVelSensitivity(gradNumber);
+    const Vector &velSens = dofPtr->getVelSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -793,7 +793,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
       }
     }
 
-    const Vector &accelSens = dofPtr->getAccSensitivity(gradNumber);
+    const Vector &accelSens = dofPtr->getAccSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -28,13 +28,22 @@
 #include <FE_Element.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
+#include <logging/Profiler.h>
 #include <Matrix.h>
 #include <Vector.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Domain.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
+#include <vector>
+#include <algorithm>
 #include <cmath>
 
+// the number of parameters whose right-hand sides are held at once
+static constexpr int maxSensitivityBlock = 16;
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), //theEigenSOE(0), 
@@ -82,6 +91,8 @@ IncrementalIntegrator::formTangent(int statFlag)
         return -1;
     }
 
+    OpenSees::ProfileScope scope(OpenSees::Profiler::FormTangent);
+
     // zero the A matrix of the linearSOE
     theSOE->zeroA();
 
@@ -217,6 +228,86 @@ IncrementalIntegrator::formNodalUnbalance(void)
     return res;
 }
 
+//
+// The right-hand side for each parameter is formed with only that
+// parameter active, as Parameter::activate() marks the elements and
+// materials it maps to. The right-hand sides of a block of parameters are
+// then solved together, and the sensitivities are saved and committed
+// with each parameter active again; the right-hand side of one parameter
+// does not depend on the sensitivities of another.
+//
+int
+IncrementalIntegrator::computeParameterSensitivities()
+{
+    if (theAnalysisModel == nullptr || theSOE == nullptr) {
+        opserr << "WARNING IncrementalIntegrator::computeSensitivities() -";
+        opserr << " no AnalysisModel or LinearSOE have been set\n";
+        return -1;
+    }
+
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+
+    // Zero out the old right-hand side of the SOE
+    theSOE->zeroB();
+
+    // Form the part of the RHS which are independent of parameter
+    this->formIndependentSensitivityRHS();
+
+    // De-activate all parameters
+    std::vector<Parameter *> params;
+    Parameter *theParam;
+    ParameterIter &paramIter = theDomain->getParameters();
+    while ((theParam = paramIter()) != nullptr) {
+        theParam->activate(false);
+        params.push_back(theParam);
+    }
+
+    const int numGrads = theDomain->getNumParameters();
+    const int numEqn = theSOE->getNumEqn();
+    const int numParams = (int)params.size();
+
+    Vector x(numEqn);
+    for (int first=0; first<numParams; first+=maxSensitivityBlock) {
+        const int numBlock = std::min(maxSensitivityBlock, numParams - first);
+        Matrix B(numEqn, numBlock);
+        Matrix X(numEqn, numBlock);
+
+        for (int j=0; j<numBlock; j++) {
+            Parameter *param = params[first + j];
+            param->activate(true);
+            theSOE->zeroB();
+            this->formSensitivityRHS(param->getGradIndex());
+            const Vector &b = theSOE->getB();
+            for (int i=0; i<numEqn; i++)
+                B(i,j) = b(i);
+            param->activate(false);
+        }
+
+        if (theSOE->solveMultiple(B, X) < 0) {
+            opserr << "WARNING IncrementalIntegrator::computeSensitivities() -";
+            opserr << " failed to solve for the sensitivities\n";
+            return -2;
+        }
+
+        for (int j=0; j<numBlock; j++) {
+            Parameter *param = params[first + j];
+            const int gradIndex = param->getGradIndex();
+            param->activate(true);
+            for (int i=0; i<numEqn; i++)
+                x(i) = X(i,j);
+
+            // Save sensitivity to nodes
+            this->saveSensitivity(x, gradIndex, numGrads);
+
+            // Commit unconditional history variables
+            this->commitSensitivity(gradIndex, numGrads);
+            param->activate(false);
+        }
+    }
+
+    return 0;
+}
+
 int 
 IncrementalIntegrator::formElementResidual(void)
 {
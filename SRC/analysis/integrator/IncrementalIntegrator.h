@@ -104,6 +104,10 @@ class IncrementalIntegrator : public Integrator
     virtual int  formNodalUnbalance();
     virtual int  formElementResidual();
 
+    // sensitivities by direct differentiation, solving for a block of
+    // parameters at a time with one factorization of the tangent
+    int computeParameterSensitivities();
+
     LinearSOE       *getLinearSOE() const;
     AnalysisModel   *getAnalysisModel() const;
     ConvergenceTest *getConvergenceTest() const;
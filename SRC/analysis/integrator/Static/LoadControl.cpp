@@ -278,55 +278,7 @@ LoadControl::computeSensitivityAtEachIteration()
 int 
 LoadControl::computeSensitivities()
 {
-  LinearSOE *theSOE = this->getLinearSOE();
-      AnalysisModel *theModel = this->getAnalysisModel();
-      Domain *theDomain=theModel->getDomainPtr();
-
-
-      // Zero out the old right-hand side of the SOE
-      theSOE->zeroB();
-
-      // Form the part of the RHS which are indepent of parameter
-      this->formIndependentSensitivityRHS();
-
-      ParameterIter &paramIter = theDomain->getParameters();      
-      Parameter *theParam;
-      // De-activate all parameters
-      while ((theParam = paramIter()) != nullptr)
-        theParam->activate(false);
-      
-      // compute sensitivity wrt each parameter
-      int numGrads = theDomain->getNumParameters();
-      paramIter = theDomain->getParameters();      
-      while ((theParam = paramIter()) != nullptr) {
-
-        // Activate this parameter
-        theParam->activate(true);
-
-        // Zero the RHS vector
-        theSOE->zeroB();
-
-        // Get the grad index for this parameter
-        int gradIndex = theParam->getGradIndex();
-
-        // Form the RHS
-        this->formSensitivityRHS(gradIndex);
-         
-        // Solve for displacement sensitivity
-       
-        theSOE->solve();
-
-        // Save sensitivity to nodes
-        this->saveSensitivity( theSOE->getX(), gradIndex, numGrads);
-       
-        // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-        this->commitSensitivity(gradIndex, numGrads);
-        
-        // De-activate this parameter for next sensitivity calc
-        theParam->activate(false);
-      }
-
-      return 0;
+  return this->computeParameterSensitivities();
 }
 
 
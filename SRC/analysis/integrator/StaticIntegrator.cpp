@@ -35,6 +35,7 @@
 #include <FE_EleIter.h>
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
+#include <logging/Profiler.h>
 
 StaticIntegrator::StaticIntegrator(int clasTag)
  : IncrementalIntegrator(clasTag)
@@ -57,6 +58,8 @@ StaticIntegrator::formUnbalance()
       opserr << " no LinearSOE has been set\n";
       return -1;
   }
+
+  OpenSees::ProfileScope scope(OpenSees::Profiler::FormUnbalance);
   
   theLinSOE->zeroB();
 
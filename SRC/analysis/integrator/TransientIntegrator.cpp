@@ -35,9 +35,10 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <logging/Profiler.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
- : IncrementalIntegrator(clasTag)
+ : IncrementalIntegrator(clasTag), warnedStep(0.0)
 {
 
 }
@@ -47,6 +48,20 @@ TransientIntegrator::~TransientIntegrator()
 
 }
 
+void
+TransientIntegrator::checkTimeStep(double dT)
+{
+  // the conservative estimate of getCriticalTimeStep() would warn
+  // of steps that are stable, so only the bound is checked
+  double dtMax = this->getCriticalTimeStepBound();
+  if (dtMax <= 0.0 || dT <= dtMax || dtMax == warnedStep)
+    return;
+
+  warnedStep = dtMax;
+  opserr << "WARNING TransientIntegrator - time step " << dT
+         << " exceeds the critical time step, which is at most " << dtMax << "\n";
+}
+
 #if 1
 int 
 TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
@@ -127,6 +142,8 @@ TransientIntegrator::formUnbalance()
       return -1;
     }
 
+    OpenSees::ProfileScope scope(OpenSees::Profiler::FormUnbalance);
+
     theLinSOE->zeroB();
 
     // do modal damping
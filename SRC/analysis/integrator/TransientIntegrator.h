@@ -65,10 +65,24 @@ class TransientIntegrator : public IncrementalIntegrator
     virtual const Vector& getVel(void) = 0; // For modal damping  
     virtual int initialize(void) {return 0;};
 
+    // Estimated critical time step of conditionally stable schemes,
+    // or 0 if the scheme imposes no stability limit on dT. The estimate
+    // is conservative; getCriticalTimeStepBound() returns a step that
+    // the critical step cannot exceed, or 0 if none is known.
+    virtual double getCriticalTimeStep(void) {return 0.0;};
+    virtual double getCriticalTimeStepBound(void) {return 0.0;};
+
+    // Constant C of the local truncation error of the displacements,
+    // e = C dT^2 (A_{n+1} - A_n), used to adapt the step; 0 if the
+    // scheme provides no such estimate.
+    virtual double getLocalErrorConstant(void) const {return 0.0;};
 
   protected:
+    // Warn, once per estimate, if dT exceeds getCriticalTimeStepBound()
+    void checkTimeStep(double dT);
     
   private:
+    double warnedStep;
 };
 
 #endif
@@ -164,6 +164,23 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
 
 
 
+FE_Element *
+AnalysisModel::removeFE_Element(int tag)
+{
+  if (theFEs == 0)
+    return 0;
+
+  TaggedObject *removed = theFEs->removeComponent(tag);
+  if (removed == 0)
+    return 0;
+
+  // any graph built from the FE_Elements is no longer valid
+  this->clearDOFGraph();
+  numFE_Ele--;
+  return (FE_Element *)removed;
+}
+
+
 // void addDOF_Group(DOF_Group *);
 //        Method to add an element to the model.
 
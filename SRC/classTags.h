@@ -74,6 +74,7 @@
 #define CONVERGENCE_TEST_NormDispAndUnbalance               9
 #define CONVERGENCE_TEST_NormDispOrUnbalance               10
 #define CONVERGENCE_TEST_CTestPFEM                         11
+#define CONVERGENCE_TEST_CTestCombined                     12
 
 
 #define GRND_TAG_ElCentroGroundMotion                 1
@@ -999,6 +1000,8 @@ enum {
 #define GraphNUMBERER_TAG_MyRCM   		3
 #define GraphNUMBERER_TAG_Metis   		4
 #define GraphNUMBERER_TAG_AMD   		5
+#define GraphNUMBERER_TAG_NestedDissection   6
+#define GraphNUMBERER_TAG_ThreadedRCM   	7
 
 
 #define AnaMODEL_TAGS_AnalysisModel 	1
@@ -1019,6 +1022,7 @@ enum {
 #define EquiALGORITHM_TAGS_ElasticAlgorithm 14
 #define EquiALGORITHM_TAGS_NewtonHallM 15
 #define EquiALGORITHM_TAGS_ExpressNewton 16
+#define EquiALGORITHM_TAGS_LimitedMemoryNewton 17
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -1126,6 +1130,8 @@ enum {
 #define LinSOE_TAGS_PFEMCompressibleLinSOE 28
 #define LinSOE_TAGS_PFEMQuasiLinSOE 29
 #define LinSOE_TAGS_PFEMDiaLinSOE 30
+#define LinSOE_TAGS_SubstructureLinSOE 31
+#define LinSOE_TAGS_NeighborDiagonalSOE 32
 #define LinSOE_TAGS_PARDISOGenLinSOE 99990
 
 
@@ -1162,6 +1168,8 @@ enum {
 #define SOLVER_TAGS_CuSP                                31
 #define SOLVER_TAGS_PFEMQuasiSolver                     32
 #define SOLVER_TAGS_PFEMDiaSolver                       33
+#define SOLVER_TAGS_SubstructureLinSolver               34
+#define SOLVER_TAGS_NeighborDiagonalSolver              35
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -0,0 +1,188 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of RigidBody.
+//
+// Written: cmp
+//
+#include <RigidBody.h>
+#include <Domain.h>
+#include <Node.h>
+#include <MP_Constraint.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+namespace {
+
+// component t of e_p x d, the displacement of a point at offset d for a
+// unit rotation about axis p
+double
+rotationTerm(int p, const double *d, int t)
+{
+  if (t == (p+1)%3)
+    return -d[(p+2)%3];
+  if (t == (p+2)%3)
+    return d[(p+1)%3];
+  return 0.0;
+}
+
+}
+
+
+RigidBody::RigidBody(int retained, const ID &constrained, int perp)
+:retainedNode(retained), constrainedNodes(constrained), perpDirn(perp),
+ numDOF(0), dimension(0)
+{
+
+}
+
+
+int
+RigidBody::formOffsets(Domain &theDomain)
+{
+  Node *nodeR = theDomain.getNode(retainedNode);
+  if (nodeR == nullptr) {
+    opserr << "WARNING RigidBody - retained node " << retainedNode << " not in domain\n";
+    return -1;
+  }
+
+  if (constrainedNodes.getLocation(retainedNode) >= 0) {
+    opserr << "WARNING RigidBody - retained node " << retainedNode
+           << " is in the constrained node list\n";
+    return -1;
+  }
+
+  const Vector &crdR = nodeR->getCrds();
+  dimension = crdR.Size();
+  numDOF = nodeR->getNumberDOF();
+
+  if (perpDirn >= 0) {
+    if (perpDirn > 2) {
+      opserr << "WARNING RigidBody - the direction " << perpDirn
+             << " normal to the plane is not valid\n";
+      return -1;
+    }
+    if (numDOF != 6 || dimension != 3) {
+      opserr << "WARNING RigidBody - retained node " << retainedNode
+             << " not in 3d space with 6 dof\n";
+      return -1;
+    }
+  } else if (numDOF != dimension && !(dimension == 2 && numDOF == 3)
+                                 && !(dimension == 3 && numDOF == 6)) {
+    opserr << "WARNING RigidBody - retained node " << retainedNode
+           << " does not have valid numDOF for its dimension\n";
+    return -1;
+  }
+
+  const int numConstrained = constrainedNodes.Size();
+  offsets.assign(3*numConstrained, 0.0);
+
+  for (int i=0; i<numConstrained; i++) {
+    Node *nodeC = theDomain.getNode(constrainedNodes(i));
+    if (nodeC == nullptr) {
+      opserr << "WARNING RigidBody - constrained node " << constrainedNodes(i)
+             << " not in domain\n";
+      return -1;
+    }
+
+    const Vector &crdC = nodeC->getCrds();
+    if (crdC.Size() != dimension || nodeC->getNumberDOF() != numDOF) {
+      opserr << "WARNING RigidBody - mismatch in dimension or numDOF between constrained node "
+             << constrainedNodes(i) << " and retained node " << retainedNode << "\n";
+      return -1;
+    }
+
+    double *d = &offsets[3*i];
+    for (int j=0; j<dimension; j++)
+      d[j] = crdC(j) - crdR(j);
+
+    if (perpDirn >= 0 && d[perpDirn] != 0.0) {
+      opserr << "WARNING RigidBody - constrained node " << constrainedNodes(i)
+             << " not in the plane of the diaphragm\n";
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+int
+RigidBody::addConstraints(Domain &theDomain)
+{
+  if (this->formOffsets(theDomain) != 0)
+    return -1;
+
+  // the constrained dof, the translations and the rotations they follow
+  ID dofs(numDOF);
+  ID translations(3);
+  ID rotations(3);
+  int numTranslations = 0;
+  int numRotations = 0;
+
+  if (perpDirn >= 0) {
+    // the in-plane translations in dof order, and the rotation about the normal
+    dofs.resize(3);
+    for (int j=0; j<3; j++)
+      if (j != perpDirn)
+        translations[numTranslations++] = j;
+    rotations[numRotations++] = perpDirn;
+    dofs(0) = translations(0);
+    dofs(1) = translations(1);
+    dofs(2) = 3 + perpDirn;
+
+  } else {
+    for (int j=0; j<numDOF; j++)
+      dofs(j) = j;
+    if (numDOF != dimension) {
+      numTranslations = dimension;
+      for (int j=0; j<dimension; j++)
+        translations[j] = j;
+      if (dimension == 2)
+        rotations[numRotations++] = 2;
+      else
+        for (int p=0; p<3; p++)
+          rotations[numRotations++] = p;
+    }
+  }
+
+  const int n = dofs.Size();
+  Matrix Ccr(n, n);
+  std::vector<int> added;
+  added.reserve(constrainedNodes.Size());
+  for (int i=0; i<constrainedNodes.Size(); i++) {
+    const double *d = &offsets[3*i];
+
+    Ccr.Zero();
+    for (int j=0; j<n; j++)
+      Ccr(j,j) = 1.0;
+
+    // the translations follow the rotations of the retained node through
+    // the offset; the columns of the rotations follow the translations
+    for (int r=0; r<numRotations; r++) {
+      const int p = rotations(r);
+      const int col = numTranslations + r;
+      for (int t=0; t<numTranslations; t++)
+        Ccr(t, col) = rotationTerm(p, d, translations(t));
+    }
+
+    MP_Constraint *theMP = new MP_Constraint(retainedNode, constrainedNodes(i), Ccr, dofs, dofs);
+    if (theDomain.addMP_Constraint(theMP) == false) {
+      opserr << "WARNING RigidBody - could not add the constraint of node "
+             << constrainedNodes(i) << " to the domain\n";
+      delete theMP;
+
+      // remove the constraints of the nodes already added
+      for (int tag : added)
+        delete theDomain.removeMP_Constraint(tag);
+      return -2;
+    }
+    added.push_back(theMP->getTag());
+  }
+
+  return 0;
+}
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: RigidBody ties any number of constrained nodes to the
+// motion of one retained node, assuming small rotations. The body is
+// either rigid in space, when all the dof of the constrained nodes follow
+// the retained node, or a diaphragm rigid in its plane, when only the
+// in-plane translations and the rotation about the normal do.
+//
+// RigidBody is not a constraint itself, it builds one ordinary
+// MP_Constraint per constrained node so that every constraint handler can
+// enforce them; with the TransformationConstraintHandler the constrained
+// dof are eliminated and the constrained nodes only add the dof of the
+// retained node to the system. The nodes of the body are checked together
+// before any constraint is added, the constraint of each constrained node
+// is formed from its offset to the retained node, and if the domain
+// rejects one of them those already added are removed again.
+//
+// Written: cmp
+//
+#ifndef RigidBody_h
+#define RigidBody_h
+
+#include <vector>
+#include <ID.h>
+
+class Domain;
+
+class RigidBody
+{
+  public:
+    // perpDirn is -1 for a body rigid in space, and the axis normal to
+    // the plane (0, 1 or 2) for a diaphragm
+    RigidBody(int retainedNode, const ID &constrainedNodes, int perpDirn = -1);
+
+    int addConstraints(Domain &theDomain);
+
+  private:
+    int formOffsets(Domain &theDomain);
+
+    int retainedNode;
+    ID constrainedNodes;
+    int perpDirn;
+
+    int numDOF;                  // dof at the nodes of the body
+    int dimension;               // dimension of the node coordinates
+    std::vector<double> offsets; // offset of each constrained node, 3 per node
+};
+
+#endif
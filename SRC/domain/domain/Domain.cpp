@@ -29,6 +29,10 @@
 #include <stdlib.h>
 #include <math.h>
 #include <map>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
 #include <OPS_Globals.h>
 #include <Domain.h>
 #include <DummyStream.h>
@@ -69,6 +73,11 @@
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <logging/Profiler.h>
+
+struct Domain::ElementCosts {
+  std::unordered_map<int, double> seconds;
+};
 
 //
 // global variables
@@ -276,6 +285,8 @@ Domain::~Domain()
   // delete the objects in the domain
   this->Domain::clearAll();
 
+  delete elementCosts;
+
   // delete all the storage objects
   // SEGMENT FAULT WILL OCCUR IF THESE OBJECTS WERE NOT CONSTRUCTED
   // USING NEW
@@ -404,7 +415,7 @@ Domain::addElement(Element *element)
 #endif
 
     // mark the Domain as having been changed
-    this->domainChange();
+    this->elementChange(element, true);
 
   } else 
     opserr << "Domain::addElement - element " << eleTag << "could not be added to container\n";      
@@ -482,6 +493,58 @@ Domain::addNode(Node * node)
 }
 
 
+//	Method to add a batch of Nodes to the model. The bounds are
+//	recomputed lazily and the domain is marked as changed once.
+int
+Domain::addNodes(Node **nodes, int numNodes)
+{
+  for (int i=0; i<numNodes; i++) {
+    if (theNodes->addComponent(nodes[i]) == false) {
+      opserr << "Domain::addNodes - node with tag " << nodes[i]->getTag() 
+             << " could not be added to container\n";
+      for (int j=0; j<i; j++)
+        theNodes->removeComponent(nodes[j]->getTag());
+      return -1;
+    }
+  }
+
+  for (int i=0; i<numNodes; i++)
+    nodes[i]->setDomain(this);
+
+  if (numNodes > 0) {
+    resetBounds = true;
+    this->domainChange();
+  }
+  return 0;
+}
+
+
+//	Method to add a batch of Elements whose external nodes have
+//	already been checked to exist in the domain.
+int
+Domain::addElements(Element **elements, int numElements)
+{
+  for (int i=0; i<numElements; i++) {
+    if (theElements->addComponent(elements[i]) == false) {
+      opserr << "Domain::addElements - element with tag " << elements[i]->getTag() 
+             << " could not be added to container\n";
+      for (int j=0; j<i; j++)
+        theElements->removeComponent(elements[j]->getTag());
+      return -1;
+    }
+  }
+
+  for (int i=0; i<numElements; i++) {
+    ops_TheActiveElement = elements[i];
+    elements[i]->setDomain(this);
+    elements[i]->update();
+    this->elementChange(elements[i], true);
+  }
+
+  return 0;
+}
+
+
 // void addSP_Constraint(SP_Constraint *);
 //	Method to add a constraint to the model.
 //
@@ -546,7 +609,7 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
   } 
 
   spConstraint->setDomain(this);
-  this->domainChange();  
+  this->spChange(spConstraint, true);
 
   return true;
 }
@@ -727,6 +790,7 @@ Domain::addLoadPattern(LoadPattern *load)
 	load->setDomain(this);
 	if (numSPs > 0)
 	  this->domainChange();
+	this->loadChange();
     }
     else 
       opserr << "Domain::addLoadPattern - cannot add LoadPattern with tag " <<
@@ -837,7 +901,7 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint, int pattern)
   }
 
   spConstraint->setDomain(this);
-  this->domainChange();  
+  this->spChange(spConstraint, true);
 
   return true;
 }
@@ -875,6 +939,7 @@ Domain::addNodalLoad(NodalLoad *load, int pattern)
 
     load->setDomain(this);    // done in LoadPattern::addNodalLoad()
     //this->domainChange(); // a nodal load does not change the domain
+    this->loadChange();
 
     return result;
 }    
@@ -902,7 +967,8 @@ Domain::addElementalLoad(ElementalLoad *load, int pattern)
 
 
     // load->setDomain(this); // done in LoadPattern::addElementalLoad()
-    this->domainChange();
+    // an elemental load does not change the domain
+    this->loadChange();
     return result;
 }
 
@@ -983,6 +1049,10 @@ Domain::clearAll(void) {
   lastGeoSendTag = -1;
   lastChannel    =  0;
 
+  changeLog.clear();
+  changeLogStart = 1;
+  this->loadChange();
+
   if (theNodeGraph != nullptr)
     delete theNodeGraph;
   theNodeGraph = nullptr;
@@ -1005,12 +1075,12 @@ Domain::removeElement(int tag)
   if (mc == nullptr)
       return nullptr;
 
-  // otherwise mark the domain as having changed
-  this->domainChange();
-  
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
   Element *result = (Element *)mc;
+
+  // otherwise mark the domain as having changed
+  this->elementChange(result, false);
   //  result->setDomain(0);
   return result;
 }
@@ -1074,12 +1144,14 @@ Domain::removeSP_Constraint(int theNode, int theDOF, int loadPatternTag)
     }
   }
 
-  if (found == true)
-    theSP = this->removeSP_Constraint(spTag);
-
-  // mark the domain has having changed regardless if SP constraint
-  // was there or not
-  this->domainChange();
+  // the domain is marked as changed when the constraint is removed
+  theSP = nullptr;
+  if (found == true) {
+    if (loadPatternTag == -1)
+      theSP = this->removeSP_Constraint(spTag);
+    else
+      theSP = this->removeSP_Constraint(spTag, loadPatternTag);
+  }
 
   if (theSP != nullptr) {
     delete theSP;
@@ -1099,14 +1171,14 @@ Domain::removeSP_Constraint(int tag)
     if (mc == nullptr) 
 	return nullptr;
 
-    // mark the domain as having changed    
-    this->domainChange();
-    
     // perform a downward cast, set the objects domain pointer to 0
     // and return the result of the cast    
     SP_Constraint *result = (SP_Constraint *)mc;
     // result->setDomain(0);
 
+    // mark the domain as having changed    
+    this->spChange(result, false);
+
     // should check that theLoad and result are the same    
     return result;
 }
@@ -1279,6 +1351,7 @@ Domain::removeLoadPattern(int tag)
     // as the constraint handlers have to be redone
     if (numSPs > 0)
       this->domainChange();
+    this->loadChange();
 
     // finally return the load pattern
     return result;    
@@ -1295,6 +1368,7 @@ Domain::removeNodalLoad(int tag, int loadPattern)
   if (theLoadPattern == nullptr)
     return nullptr;
     
+  this->loadChange();
   return theLoadPattern->removeNodalLoad(tag);
 }    
 
@@ -1309,6 +1383,7 @@ Domain::removeElementalLoad(int tag, int loadPattern)
   if (theLoadPattern == nullptr)
     return nullptr;
     
+  this->loadChange();
   return theLoadPattern->removeElementalLoad(tag);
 }    
 
@@ -1325,7 +1400,7 @@ Domain::removeSP_Constraint(int tag, int loadPattern)
     
   SP_Constraint *theSP = theLoadPattern->removeSP_Constraint(tag);
   if (theSP != 0)
-    this->domainChange();
+    this->spChange(theSP, false);
 
   return theSP;
 }    
@@ -1894,9 +1969,12 @@ Domain::record(bool fromAnalysis)
   int res = 0;
 
   // invoke record on all recorders
-  for (int i=0; i<numRecorders; i++)
-    if (theRecorders[i] != 0)
-      res += theRecorders[i]->record(commitTag, currentTime);
+  {
+    OpenSees::ProfileScope scope(OpenSees::Profiler::Record);
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != 0)
+        res += theRecorders[i]->record(commitTag, currentTime);
+  }
   
   // update the commitTag
   commitTag++;
@@ -1910,16 +1988,19 @@ Domain::commit(void)
     // 
     // first invoke commit on all nodes and elements in the domain
     //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != nullptr) {
-      nodePtr->commitState();
-    }
+    {
+      OpenSees::ProfileScope scope(OpenSees::Profiler::DomainCommit);
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != nullptr) {
+        nodePtr->commitState();
+      }
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != nullptr) {
-      elePtr->commitState();
+      Element *elePtr;
+      ElementIter &theElemIter = this->getElements();    
+      while ((elePtr = theElemIter()) != nullptr) {
+        elePtr->commitState();
+      }
     }
 
     // set the new committed time in the domain
@@ -1927,9 +2008,12 @@ Domain::commit(void)
     dT = 0.0;
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    {
+      OpenSees::ProfileScope scope(OpenSees::Profiler::Record);
+      for (int i=0; i<numRecorders; i++)
+        if (theRecorders[i] != 0)
+          theRecorders[i]->record(commitTag, currentTime);
+    }
 
     // update the commitTag
     commitTag++;
@@ -2007,20 +2091,81 @@ Domain::update(void)
   ops_TheActiveDomain = this;
 
   int ok = 0;
+  OpenSees::ProfileScope scope(OpenSees::Profiler::DomainUpdate);
 
   // invoke update on all the ele's
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
+  const bool profiling = OpenSees::Profiler::isTimingElements();
+  if (elementCosts == nullptr && !profiling) {
+    while ((theEle = theEles()) != nullptr) {
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
+    return ok;
+  }
+
   while ((theEle = theEles()) != nullptr) {
     ops_TheActiveElement = theEle;
+    auto start = std::chrono::steady_clock::now();
     ok += theEle->update();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    // a Subdomain times its own elements
+    if (theEle->isSubdomain())
+      continue;
+    if (elementCosts != nullptr)
+      elementCosts->seconds[theEle->getTag()] += std::chrono::duration<double>(elapsed).count();
+    if (profiling)
+      OpenSees::Profiler::addElement(theEle->getClassTag(), theEle->getClassType(),
+                                     OpenSees::Profiler::ElementUpdate, elapsed);
   }
 
   return ok;
 }
 
 
+void
+Domain::setElementTiming(bool onOff)
+{
+  if (onOff == false) {
+    delete elementCosts;
+    elementCosts = nullptr;
+  } else if (elementCosts == nullptr)
+    elementCosts = new ElementCosts();
+}
+
+
+int
+Domain::getElementCosts(ID &eleTags, Vector &costs, bool reset)
+{
+  if (elementCosts == nullptr) {
+    eleTags.resize(0);
+    costs.resize(0);
+    return 0;
+  }
+
+  // elements removed since the last reset are not reported
+  std::unordered_map<int, double> &seconds = elementCosts->seconds;
+  int numEle = 0;
+  eleTags.resize(seconds.size());
+  costs.resize(seconds.size());
+  for (const auto &entry : seconds)
+    if (this->getElement(entry.first) != nullptr) {
+      eleTags(numEle) = entry.first;
+      costs(numEle)   = entry.second;
+      numEle++;
+    }
+  eleTags.resize(numEle);
+  costs.resize(numEle);
+
+  if (reset)
+    seconds.clear();
+
+  return numEle;
+}
+
+
 int
 Domain::update(double newTime, double dT)
 {
@@ -2192,10 +2337,147 @@ Domain::inclModalDampingMatrix(void)
   return inclModalMatrix;
 }
 
+//
+// Estimate the critical time step of an explicit central difference
+// scheme on the lumped mass system. Two upper bounds on omega_max are
+// formed and the smaller is used:
+//  - the Gershgorin bound on the assembled M^-1 K of the free DOFs,
+//    omega^2 <= sum_j |K_ij|/m_i over the free j,
+//    which holds for any mix of nodal and element mass;
+//  - the element-by-element bound max_e Element::getMaxFrequency(), which
+//    only holds when all of the mass is carried by the elements.
+// The estimate is therefore conservative, and may be well below the true
+// critical step. If upperBound is given, it is set from the lower bound
+// omega^2 >= max_i K_ii/M_ii of the Rayleigh quotient, to a step that
+// the true critical step cannot exceed.
+// Returns 0 if no estimate can be made, e.g. a free DOF has no mass.
+//
+double
+Domain::getCriticalTimeStep(double *upperBound)
+{
+  if (upperBound != nullptr)
+    *upperBound = 0.0;
+
+  // number the node DOFs contiguously
+  std::unordered_map<int, int> offset;
+  int numDOF = 0;
+  Node *theNode;
+  NodeIter &theNodes = this->getNodes();
+  while ((theNode = theNodes()) != nullptr) {
+    offset[theNode->getTag()] = numDOF;
+    numDOF += theNode->getNumberDOF();
+  }
+
+  std::vector<double> mass(numDOF, 0.0);
+  std::vector<double> rowSum(numDOF, 0.0);
+  std::vector<double> massDiag(numDOF, 0.0);
+  std::vector<double> stiffDiag(numDOF, 0.0);
+  std::vector<char>   fixed(numDOF, 0);
+
+  bool elementMassOnly = true;
+  NodeIter &theNodes2 = this->getNodes();
+  while ((theNode = theNodes2()) != nullptr) {
+    const Matrix &M = theNode->getMass();
+    const int n = theNode->getNumberDOF();
+    if (M.noRows() != n)
+      continue;
+    const int start = offset[theNode->getTag()];
+    for (int i=0; i<n; i++) {
+      for (int j=0; j<n; j++)
+        mass[start+i] += M(i,j);
+      massDiag[start+i] += M(i,i);
+    }
+  }
+  for (int i=0; i<numDOF; i++)
+    if (mass[i] != 0.0)
+      elementMassOnly = false;
+
+  SP_Constraint *theSP;
+  SP_ConstraintIter &theSPs = this->getSPs();
+  while ((theSP = theSPs()) != nullptr) {
+    auto found = offset.find(theSP->getNodeTag());
+    if (found != offset.end() && theSP->getDOF_Number() >= 0 && found->second + theSP->getDOF_Number() < numDOF)
+      fixed[found->second + theSP->getDOF_Number()] = 1;
+  }
+
+  double omegaEle = 0.0;
+  std::vector<int> dof;
+  Element *theEle;
+  ElementIter &theEles = this->getElements();
+  while ((theEle = theEles()) != nullptr) {
+    const ID &eleNodes = theEle->getExternalNodes();
+    Node **nodePtrs = theEle->getNodePtrs();
+    dof.clear();
+    for (int i=0; i<eleNodes.Size(); i++) {
+      auto found = offset.find(eleNodes(i));
+      if (found == offset.end() || nodePtrs[i] == nullptr)
+        return 0.0;
+      for (int j=0; j<nodePtrs[i]->getNumberDOF(); j++)
+        dof.push_back(found->second + j);
+    }
+
+    const int n = static_cast<int>(dof.size());
+    const Matrix &K = theEle->getTangentStiff();
+    if (K.noRows() == n && K.noCols() == n) {
+      for (int i=0; i<n; i++) {
+        double sum = 0.0;
+        for (int j=0; j<n; j++)
+          if (!fixed[dof[j]])
+            sum += fabs(K(i,j));
+        rowSum[dof[i]] += sum;
+        stiffDiag[dof[i]] += K(i,i);
+      }
+    }
+    const Matrix &M = theEle->getMass();
+    if (M.noRows() == n && M.noCols() == n) {
+      for (int i=0; i<n; i++) {
+        for (int j=0; j<n; j++)
+          mass[dof[i]] += M(i,j);
+        massDiag[dof[i]] += M(i,i);
+      }
+    }
+
+    if (elementMassOnly) {
+      double omega = theEle->getMaxFrequency();
+      if (omega > 0.0)
+        omegaEle = (omega > omegaEle) ? omega : omegaEle;
+      else
+        elementMassOnly = false;
+    }
+  }
+
+  double omega2 = 0.0;
+  double omega2Lower = 0.0;
+  for (int i=0; i<numDOF; i++) {
+    if (fixed[i] || rowSum[i] <= 0.0)
+      continue;
+    if (mass[i] <= 0.0)
+      return 0.0;
+    if (rowSum[i]/mass[i] > omega2)
+      omega2 = rowSum[i]/mass[i];
+    if (massDiag[i] > 0.0 && stiffDiag[i]/massDiag[i] > omega2Lower)
+      omega2Lower = stiffDiag[i]/massDiag[i];
+  }
+
+  double omega = sqrt(omega2);
+  if (elementMassOnly && omegaEle > 0.0 && omegaEle < omega)
+    omega = omegaEle;
+
+  if (omega <= 0.0)
+    return 0.0;
+
+  if (upperBound != nullptr && omega2Lower > 0.0)
+    *upperBound = 2.0/sqrt(omega2Lower);
+
+  return 2.0/omega;
+}
+
 void
 Domain::setDomainChangeStamp(int newStamp)
 {
     currentGeoTag = newStamp;
+    changeLog.clear();
+    changeLogStart = currentGeoTag + 1;
 }
 
 
@@ -2203,6 +2485,123 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+
+    // the change is not logged, so the log only 
+    // describes changes made after the next stamp
+    changeLog.clear();
+    changeLogStart = currentGeoTag + 1;
+}
+
+
+void
+Domain::elementChange(Element *element, bool added)
+{
+    hasDomainChangedFlag = true;
+
+    // nothing is logged once the log is invalid for the next stamp;
+    // otherwise every change is kept, however large the batch, and the
+    // log is trimmed by getElementChanges() and getSP_Changes()
+    if (changeLogStart > currentGeoTag)
+      return;
+
+    changeLog.push_back({currentGeoTag + 1, element, nullptr, added});
+}
+
+
+void
+Domain::spChange(SP_Constraint *sp, bool added)
+{
+    hasDomainChangedFlag = true;
+
+    if (changeLogStart > currentGeoTag)
+      return;
+
+    changeLog.push_back({currentGeoTag + 1, nullptr, sp, added});
+}
+
+
+// drop the changes up to `since`, which are no longer needed; returns
+// false if the log does not describe every change made after `since`
+bool
+Domain::trimChangeLog(int since)
+{
+    if (since < changeLogStart || since > currentGeoTag)
+      return false;
+
+    auto first = std::find_if(changeLog.begin(), changeLog.end(),
+                    [since](const ModelChange &change) {return change.stamp > since;});
+    changeLog.erase(changeLog.begin(), first);
+    changeLogStart = since;
+    return true;
+}
+
+
+bool
+Domain::getElementChanges(int since, std::vector<Element*> &added,
+                                     std::vector<Element*> &removed)
+{
+    added.clear();
+    removed.clear();
+    if (!this->trimChangeLog(since))
+      return false;
+
+    for (const ModelChange &change : changeLog) {
+      if (change.element == nullptr || change.stamp > currentGeoTag)
+        continue;
+
+      if (change.added)
+        added.push_back(change.element);
+      else {
+        // an element added and removed again cancels out
+        auto it = std::find(added.begin(), added.end(), change.element);
+        if (it != added.end())
+          added.erase(it);
+        else
+          removed.push_back(change.element);
+      }
+    }
+    return true;
+}
+
+
+bool
+Domain::getSP_Changes(int since, std::vector<SP_Constraint*> &added,
+                                 std::vector<SP_Constraint*> &removed)
+{
+    added.clear();
+    removed.clear();
+    if (!this->trimChangeLog(since))
+      return false;
+
+    for (const ModelChange &change : changeLog) {
+      if (change.sp == nullptr || change.stamp > currentGeoTag)
+        continue;
+
+      if (change.added)
+        added.push_back(change.sp);
+      else {
+        auto it = std::find(added.begin(), added.end(), change.sp);
+        if (it != added.end())
+          added.erase(it);
+        else
+          removed.push_back(change.sp);
+      }
+    }
+    return true;
+}
+
+
+int
+Domain::hasLoadChanged(void)
+{
+    return currentLoadTag;
+}
+
+
+void
+Domain::loadChange(void)
+{
+    currentLoadTag++;
 }
 
 
@@ -30,6 +30,7 @@
 #ifndef Domain_h
 #define Domain_h
 
+#include <vector>
 #include <OPS_Stream.h>
 #include <Vector.h>
 
@@ -92,6 +93,11 @@ class Domain
     // methods to populate a domain
     virtual  bool addElement(Element *);
     virtual  bool addNode(Node *);
+    // add a batch of objects with a single domain change; on failure
+    // the objects added by the call are removed and -1 is returned.
+    // addElements assumes the caller has checked the element nodes.
+    virtual  int  addNodes(Node **nodes, int numNodes);
+    virtual  int  addElements(Element **elements, int numElements);
     virtual  bool addSP_Constraint(SP_Constraint *);
     virtual  bool addPressure_Constraint(Pressure_Constraint *);
     virtual  int  addSP_Constraint(int axisDirn, 
@@ -190,6 +196,11 @@ class Domain
     
     virtual  int  analysisStep(double dT);
     virtual  int  eigenAnalysis(int numMode, bool generalized, bool findSmallest);
+
+    // methods to measure the time each element spends in update(), used
+    // by a LoadBalancer to weigh the elements of a partitioned model
+    virtual  void setElementTiming(bool onOff);
+    virtual  int  getElementCosts(ID &eleTags, Vector &costs, bool reset = true);
     
     // methods for eigenvalue analysis
     virtual int setEigenvalues(const Vector &theEigenvalues);
@@ -201,12 +212,31 @@ class Domain
     int setModalDampingFactors(Vector *, bool inclModalMatrix = false);
     const Vector *getModalDampingFactors(void);
     bool inclModalDampingMatrix(void);
+
+    // conservative estimate of the critical time step of explicit
+    // schemes, 2/omega_max, and optionally a step it cannot exceed
+    virtual double getCriticalTimeStep(double *upperBound = nullptr);
     
     // methods for other objects to determine if model has changed
     virtual int hasDomainChanged(void);
     virtual bool getDomainChangeFlag(void);
     virtual void domainChange(void);
     virtual void setDomainChangeStamp(int newStamp);
+    // elements and single point constraints added and removed after the
+    // stamp `since`; return false if any other change has been made to
+    // the domain since then. The removed objects may no longer exist and
+    // are for comparison only.
+    virtual bool getElementChanges(int since, 
+                                   std::vector<Element*> &added,
+                                   std::vector<Element*> &removed);
+    virtual bool getSP_Changes(int since, 
+                               std::vector<SP_Constraint*> &added,
+                               std::vector<SP_Constraint*> &removed);
+
+    // loads and load patterns added or removed through the Domain
+    // change this stamp but not the one of hasDomainChanged()
+    virtual int  hasLoadChanged(void);
+    virtual void loadChange(void);
 
 
     // methods for output
@@ -259,6 +289,21 @@ class Domain
     int    lastGeoSendTag;            // the value of currentGeoTag when sendSelf was last invoked
     int dbEle, dbNod, dbSPs, dbPCs, dbMPs, dbLPs, dbParam; // database tags for storing info
 
+    int    currentLoadTag = 0;        // changed by loadChange()
+
+    // log of the elements and SP_Constraints added and removed since 
+    // changeLogStart; each entry holds one of the two
+    struct ModelChange {int stamp; Element *element; SP_Constraint *sp; bool added;};
+    std::vector<ModelChange> changeLog;
+    int    changeLogStart = 1;
+    void   elementChange(Element *, bool added);
+    void   spChange(SP_Constraint *, bool added);
+    bool   trimChangeLog(int since);
+
+    // seconds spent in update() by each element since the last reset
+    struct ElementCosts;
+    ElementCosts *elementCosts = nullptr;
+
     bool eleGraphBuiltFlag;
     bool nodeGraphBuiltFlag;
     
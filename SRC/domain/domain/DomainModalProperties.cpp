@@ -34,7 +34,8 @@
 //#include <math.h>
 #include <cmath>
 #include <vector>
-#include <map>
+#include <unordered_map>
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
@@ -50,6 +51,7 @@
 #include <Node.h>
 #include <NodeIter.h>
 #include <elementAPI.h>
+#include <threads/thread_pool.hpp>
 
 #ifndef M_PI
 #  define M_PI 3.14159265358979323846
@@ -69,6 +71,10 @@
 
 #define DMP_DBL_LARGE 1.0e200
 
+// minimum number of modes assigned to each worker thread when the
+// modal quantities are computed in parallel over modes
+#define DMP_MIN_MODES_PER_THREAD 8
+
 // find domain size
 static int domainSize(Domain *domain) {
     int ndm = 0;
@@ -103,7 +109,7 @@ namespace
         // for each node, save a list of local DOF id (0 to ndf)
         std::vector<std::vector<int> > node_u_flags;
         // for each node, save the first position in the contiguos list of dofs, ndf for each node (3 in 2D and 6 in 3D)
-        std::map<int, size_t> pos;
+        std::unordered_map<int, size_t> pos;
 
         node_map_t(Domain* domain, int ndm, int ndf) {
             size_t n = static_cast<size_t>(domain->getNumNodes());
@@ -111,6 +117,7 @@ namespace
                 nodes.resize(n);
                 node_ids.resize(n);
                 node_u_flags.resize(n);
+                pos.reserve(n);
                 Node* nodePtr;
                 NodeIter& theNodes = domain->getNodes();
                 size_t counter = 0;
@@ -387,12 +394,9 @@ bool DomainModalProperties::compute(Domain* domain)
     Matrix ML(num_nodes, ndf);
     // the equivalent diagonalized masses for each node (only at free DOFs)
     Matrix MLfree(num_nodes, ndf);
-    // the array of eigenvectors
-    std::vector<Vector> V(num_eigen);
-    for (auto& iV : V) {
-        iV.resize(num_eq);
-        iV.Zero();
-    }
+    // the block of eigenvectors, stored row-major (num_eq x num_eigen) so that
+    // all modal components of a DOF are contiguous
+    std::vector<double> V(static_cast<size_t>(num_eq) * static_cast<size_t>(num_eigen), 0.0);
 
     // asseble in the sparse mass matrix
     Vector aux_MD; // auxiliary: sum of each row of iM
@@ -470,14 +474,14 @@ bool DomainModalProperties::compute(Domain* domain)
     // assemble in the array of eigenvectors
     auto addV = [&V, num_eigen](const Matrix& iV, const ID& iD) {
         int n = iD.Size();
-        if (iV.noRows() != n || iV.noCols() != static_cast<int>(V.size()))
+        if (iV.noRows() != n || iV.noCols() != num_eigen)
             DMP_ERR("Error: inconsistent eigenvector matrix and ID\n");
-        for (int j = 0; j < static_cast<int>(V.size()); ++j) {
-            auto& jV = V[static_cast<size_t>(j)];
-            for (int i = 0; i < n; ++i) {
-                int iloc = iD(i);
-                if (iloc >= 0)
-                    jV(iloc) = iV(i, j);
+        for (int i = 0; i < n; ++i) {
+            int iloc = iD(i);
+            if (iloc >= 0) {
+                double* row = &V[static_cast<size_t>(iloc) * static_cast<size_t>(num_eigen)];
+                for (int j = 0; j < num_eigen; ++j)
+                    row[j] = iV(i, j);
             }
         }
     };
@@ -522,15 +526,18 @@ bool DomainModalProperties::compute(Domain* domain)
     // if requested by the user
     m_unorm_scale_factors.resize(num_eigen);
     if (m_unorm) {
-        for (int imode = 0; imode < num_eigen; ++imode) {
-            Vector& iV = V[static_cast<size_t>(imode)];
-            double umax = 0.0;
-            for (int i = 0; i < iV.Size(); ++i)
-                umax = std::max(umax, std::abs(iV(i)));
-            double scale = umax == 0.0 ? DMP_DBL_LARGE : 1.0 / umax;
-            for (int i = 0; i < iV.Size(); ++i)
-                iV(i) *= scale;
-            m_unorm_scale_factors(imode) = scale;
+        std::vector<double> umax(static_cast<size_t>(num_eigen), 0.0);
+        for (int i = 0; i < num_eq; ++i) {
+            const double* row = &V[static_cast<size_t>(i) * static_cast<size_t>(num_eigen)];
+            for (int imode = 0; imode < num_eigen; ++imode)
+                umax[imode] = std::max(umax[imode], std::abs(row[imode]));
+        }
+        for (int imode = 0; imode < num_eigen; ++imode)
+            m_unorm_scale_factors(imode) = umax[imode] == 0.0 ? DMP_DBL_LARGE : 1.0 / umax[imode];
+        for (int i = 0; i < num_eq; ++i) {
+            double* row = &V[static_cast<size_t>(i) * static_cast<size_t>(num_eigen)];
+            for (int imode = 0; imode < num_eigen; ++imode)
+                row[imode] *= m_unorm_scale_factors(imode);
         }
     }
     else {
@@ -625,80 +632,93 @@ bool DomainModalProperties::compute(Domain* domain)
 
     // now we can compute all the modal masses and participation factors.
     // we can do it mode by mode due to their orthogonality.
-    
-    // a temporary to store the V'*M product
-    Vector jVTM(num_eq);
+
     // defines the magnitude of the rigid body response of a DOF 
     // to imposed rigid body motion (displacement or infinitesimal rotation) in the i-direction.
-    // each (ndf x 1) block correspond to a node (ordered sequentially as in nodemap), and it is defined as:
-    // | 1   0   0   0  dz -dz | |e1|
-    // | 0   1   0 -dz   0  dx | |e2|
-    // | 0   0   1  dy -dx   0 | |e3|
-    // | 0   0   0   1   0   0 | |e4|
-    // | 0   0   0   0   1   0 | |e5|
-    // | 0   0   0   0   0   1 | |e6|
-    // where ei is 1, and all the other are 0.
-    Vector R(num_eq);
-    // for each j mode...
-    for (int j = 0; j < num_eigen; ++j) {
-
-        // current mode eigenvector
-        const Vector& jV = V[j];
-
-        // compute [V' * M] : a temporary to avoid extra calculations
-        jVTM.Zero();
-        for (const auto& it : M.triplets) 
-            jVTM[it.j] += it.val * jV(it.i);
-
-        // compute [V' * M * V] : generalized mass matrix
-        double GM = jVTM ^ jV;
-        m_generalized_mass_matrix(j) = GM;
-        double invGM = GM == 0.0 ? DMP_DBL_LARGE : 1.0 / GM;
-
-        // for each DOF ...
-        for (int i = 0; i < ndf; ++i) {
-
-            // compute the rigid-body-mode vector R
-            R.Zero();
-            for (int inode = 0; inode < num_nodes; ++inode) {
-                int index = inode * ndf;
-                R(index + i) = 1.0; // one at the current DOF for direct translational or rotational effects
-                if (i >= ndm) {
-                    const Vector& pos = nodemap.nodes[static_cast<size_t>(inode)]->getCrds();
-                    double dx = pos(0) - m_center_of_mass(0);
-                    double dy = pos(1) - m_center_of_mass(1);
-                    if (ndf == 3) { // 2D case
-                        if(i == 2) {
-                            R(index + 0) = -dy;
-                            R(index + 1) = dx;
-                        }
-                    }
-                    else { // 3D case
-                        double dz = pos(2) - m_center_of_mass(2);
-                        if (i == 3) {
-                            R(index + 1) = -dz;
-                            R(index + 2) = dy;
-                        }
-                        else if (i == 4) {
-                            R(index + 0) = dz;
-                            R(index + 2) = -dx;
-                        }
-                        else if (i == 5) {
-                            R(index + 0) = -dy;
-                            R(index + 1) = dx;
-                        }
-                    }
-                }
-            }
-
-            // compute [V' * M * R] : generalized load vector
-            double L = jVTM ^ R;
+    // each (ndf x ndf) block correspond to a node (ordered sequentially as in nodemap), and it is defined as:
+    // | 1   0   0   0  dz -dz |
+    // | 0   1   0 -dz   0  dx |
+    // | 0   0   1  dy -dx   0 |
+    // | 0   0   0   1   0   0 |
+    // | 0   0   0   0   1   0 |
+    // | 0   0   0   0   0   1 |
+    // stored row-major (num_eq x ndf), one column for each direction.
+    std::vector<double> R(static_cast<size_t>(num_eq) * static_cast<size_t>(ndf), 0.0);
+    for (int inode = 0; inode < num_nodes; ++inode) {
+        double* Rn = &R[static_cast<size_t>(inode) * static_cast<size_t>(ndf * ndf)];
+        for (int i = 0; i < ndf; ++i)
+            Rn[i * ndf + i] = 1.0; // one at the current DOF for direct translational or rotational effects
+        const Vector& pos = nodemap.nodes[static_cast<size_t>(inode)]->getCrds();
+        double dx = pos(0) - m_center_of_mass(0);
+        double dy = pos(1) - m_center_of_mass(1);
+        if (ndf == 3) { // 2D case
+            Rn[0 * ndf + 2] = -dy;
+            Rn[1 * ndf + 2] = dx;
+        }
+        else { // 3D case
+            double dz = pos(2) - m_center_of_mass(2);
+            Rn[1 * ndf + 3] = -dz;
+            Rn[2 * ndf + 3] = dy;
+            Rn[0 * ndf + 4] = dz;
+            Rn[2 * ndf + 4] = -dx;
+            Rn[0 * ndf + 5] = -dy;
+            Rn[1 * ndf + 5] = dx;
+        }
+    }
 
-            // compute [(V' * M * R) / diag(V' * M * V)] : modal participation factors
-            m_modal_participation_factors(j, i) = L * invGM;
+    // compute, for the modes in [jbegin, jend), the generalized masses [V' * M * V]
+    // and the generalized load vectors [V' * M * R] in a single pass over the
+    // non-zero entries of M, without forming the (num_eq x num_eigen) product M*V.
+    // the innermost loops run over contiguous modal components, and different
+    // blocks of modes write to disjoint outputs, so they can run concurrently.
+    auto compute_modes = [&M, &V, &R, num_eigen, ndf, this](int jbegin, int jend) {
+        int nb = jend - jbegin;
+        if (nb < 1)
+            return;
+        std::vector<double> GM(static_cast<size_t>(nb), 0.0);
+        std::vector<double> L(static_cast<size_t>(nb * ndf), 0.0);
+        for (const auto& it : M.triplets) {
+            const double* Vi = &V[static_cast<size_t>(it.i) * static_cast<size_t>(num_eigen) + jbegin];
+            const double* Vj = &V[static_cast<size_t>(it.j) * static_cast<size_t>(num_eigen) + jbegin];
+            const double* Rj = &R[static_cast<size_t>(it.j) * static_cast<size_t>(ndf)];
+            const double val = it.val;
+            for (int k = 0; k < nb; ++k)
+                GM[k] += val * Vi[k] * Vj[k];
+            for (int i = 0; i < ndf; ++i) {
+                const double coeff = val * Rj[i];
+                if (coeff == 0.0)
+                    continue;
+                double* Li = &L[static_cast<size_t>(i * nb)];
+                for (int k = 0; k < nb; ++k)
+                    Li[k] += coeff * Vi[k];
+            }
+        }
+        for (int k = 0; k < nb; ++k) {
+            int j = jbegin + k;
+            m_generalized_mass_matrix(j) = GM[k];
+            double invGM = GM[k] == 0.0 ? DMP_DBL_LARGE : 1.0 / GM[k];
+            for (int i = 0; i < ndf; ++i) {
+                double Lji = L[static_cast<size_t>(i * nb + k)];
+                // compute [(V' * M * R) / diag(V' * M * V)] : modal participation factors
+                m_modal_participation_factors(j, i) = Lji * invGM;
+                // compute [(V' * M * R)^2 / diag(V' * M * V)] : effective modal masses
+                m_modal_participation_masses(j, i) = Lji * Lji * invGM;
+            }
+        }
+    };
 
-            // compute [(V' * M * R)^2 / diag(V' * M * V)] : effective modal masses
-            m_modal_participation_masses(j, i) = L * L * invGM;
+    // split the modes among worker threads only when there are enough of them
+    // to amortize the thread startup
+    {
+        unsigned int num_threads = std::thread::hardware_concurrency();
+        unsigned int num_blocks = static_cast<unsigned int>(num_eigen / DMP_MIN_MODES_PER_THREAD);
+        num_blocks = std::min(num_blocks, num_threads);
+        if (num_blocks > 1) {
+            OpenSees::thread_pool pool{num_blocks};
+            pool.submit_blocks<int>(0, num_eigen, compute_modes, num_blocks).wait();
+        }
+        else {
+            compute_modes(0, num_eigen);
         }
     }
 
@@ -864,6 +864,12 @@ Node::setRayleighDampingFactor(double alpham) {
   return 0;
 }
 
+double
+Node::getRayleighDampingFactor() const
+{
+  return alphaM;
+}
+
 
 const Matrix &
 Node::getDamp(void)
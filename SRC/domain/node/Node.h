@@ -123,6 +123,7 @@ class Node :
     VIRTUAL int setR(int row, int col, double Value);
     VIRTUAL const Vector &getRV(const Vector &V);
     VIRTUAL int setRayleighDampingFactor(double alphaM);
+    double getRayleighDampingFactor() const;
 
     // Eigen vectors
     VIRTUAL int setNumEigenvectors(int numVectorsToStore);
@@ -59,6 +59,7 @@
 #include <LoadPattern.h>
 
 #include <map>
+#include <vector>
 #include <MapOfTaggedObjects.h>
 
 #include <FileStream.h>
@@ -127,7 +128,8 @@ typedef MAP_ID::iterator     MAP_ID_ITERATOR;
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
   :  myDomain(0), thePartitioner(theGraphPartitioner), theBalancer(0),
  theElementGraph(0), theBoundaryElements(0), 
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ boundaryChanged(false)
 {
 
 }    
@@ -136,7 +138,8 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 				     LoadBalancer &theLoadBalancer)
   :  myDomain(0), thePartitioner(theGraphPartitioner), theBalancer(&theLoadBalancer),
  theElementGraph(0), theBoundaryElements(0),
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ boundaryChanged(false)
 {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -145,11 +148,14 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 
 DomainPartitioner::~DomainPartitioner()
 {
-  if (theBoundaryElements != 0) {
-    for (int i=0; i<numPartitions; i++)
-      if (theBoundaryElements[i] != 0)
-	delete theBoundaryElements[i];
-    delete []theBoundaryElements;
+  this->clearBoundaryElements();
+
+  if (theElementGraph != 0)
+    delete theElementGraph;
+
+  if (theNodeLocations != 0) {
+    theNodeLocations->clearAll();
+    delete theNodeLocations;
   }
 }
 
@@ -184,12 +190,9 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   }
 
   // we get the ele graph from the domain and partition it
-  //    Graph &theEleGraph = myDomain->getElementGraph();
-  //    theElementGraph = new Graph(myDomain->getElementGraph());
+  Graph &theDomainGraph = myDomain->getElementGraph();
 
-  theElementGraph = &(myDomain->getElementGraph());
-
-  int theError = thePartitioner.partition(*theElementGraph, numParts);
+  int theError = thePartitioner.partition(theDomainGraph, numParts);
 
   if (theError < 0) {
     opserr << "DomainPartitioner::partition";
@@ -200,11 +203,33 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     opserr << "DomainPartitioner::partition - Succesfull partition. Now redistributing data accordingly.\n";
   }
 
+  // we keep a copy of the colored graph for the load balancer, the
+  // domain clears its own once the elements have been moved
+  this->clearBoundaryElements();
+  if (theElementGraph != 0)
+    delete theElementGraph;
+  if (theNodeLocations != 0) {
+    theNodeLocations->clearAll();
+    delete theNodeLocations;
+  }
+  theElements.clear();
+  pinnedElements.clear();
+  pinnedNodes.clear();
+
+  theElementGraph = new Graph(theDomainGraph);
+
+  Vertex *vertexPtr = 0;
+  VertexIter &theColoredVertices = theDomainGraph.getVertices();
+  while ((vertexPtr = theColoredVertices()) != 0) {
+    Vertex *theCopy = theElementGraph->getVertexPtr(vertexPtr->getTag());
+    theCopy->setColor(vertexPtr->getColor());
+    theCopy->setWeight(vertexPtr->getWeight());
+  }
+
   /* print graph */
   opserr << "  * Identifying components to transfer.\n";
   
   VertexIter &theVertices1 = theElementGraph->getVertices();
-  Vertex *vertexPtr = 0;
   bool moreThanOne = false;
   
   vertexPtr = theVertices1();
@@ -233,6 +258,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
       int eleTag = vertexPtr->getRef();
       if (eleTag == specialElementTag) {
 	found = true;
+	pinnedElements.insert(eleTag);
 	int vertexColor = vertexPtr->getColor();
 	if (vertexColor != 1)
 	  //	  specialElementColor = vertexColor;
@@ -242,34 +268,6 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   }
   
       
-  // we create empty graphs for the numParts subdomains,
-  // in the graphs we place the vertices for the elements on the boundaries
-  
-  // we do not invoke the destructor on the individual graphs as 
-  // this would invoke the destructor on the individual vertices
-
-  if (theBoundaryElements != 0)
-    delete [] theBoundaryElements;
-  
-  theBoundaryElements = new Graph * [numParts];
-  if (theBoundaryElements == 0) {
-    opserr << "DomainPartitioner::partition(int numParts)";
-    opserr << " - ran out of memory\n";
-    numPartitions = 0;  
-    return -1;
-  }
-
-  for (int l=0; l<numParts; l++) {
-    theBoundaryElements[l] = new Graph(2048); // graphs can grow larger; just an estimate
-    
-    if (theBoundaryElements[l] == 0) {
-      opserr << "DomainPartitioner::partition(int numParts)";
-      opserr << " - ran out of memory\n";
-      numPartitions = 0;
-      return -1;
-    }
-  }
-  
   numPartitions = numParts;
 
   //  opserr << "DomainPartitioner::partition() - nodes \n";  
@@ -299,40 +297,29 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   }
 
   //
-  // we now iterate through the vertices of the element graph
-  // to see if the vertex is a boundary vertex or not - if it is
-  // we add to the appropriate graph created above. We also set the
-  // value the color variable of each of the external nodes connected 
-  // to the element to a value which will indicate that that node will
-  // have to be added to the subdomain.
+  // we now find the boundary vertices of each partition and iterate
+  // through the vertices of the element graph to set the partitions
+  // each node is in, which tells us the nodes that will have to be
+  // added to each subdomain.
   //
   
   opserr << "     + Boundary Nodes.\n";
+  if (this->buildBoundaryElements() != 0) {
+    numPartitions = 0;
+    return -1;
+  }
+
   //Transverse the graph
   VertexIter &theVertexIter = theElementGraph->getVertices();
   while ((vertexPtr = theVertexIter()) != 0) {
     int eleTag = vertexPtr->getRef();
     int vertexColor = vertexPtr->getColor();
     
-    // For each element, transverse its neighboring element
-    const ID &adjacency = vertexPtr->getAdjacency();
-    int size = adjacency.Size();
-    for (int i=0; i<size; i++) {
-      Vertex *otherVertex = theElementGraph->getVertexPtr(adjacency(i));
-
-      //If a neighbor has a different color (partition)
-      if (otherVertex->getColor() != vertexColor) {
-
-        //Add it into the boundary elements graph
-	theBoundaryElements[vertexColor-1]->addVertex(vertexPtr,false);
-	i = size;
-      }
-    }
-    
-    //Also for each element, transverse its connected nodes
+    //For each element, transverse its connected nodes
     Element *elePtr = myDomain->getElement(eleTag);
     const ID &nodes = elePtr->getExternalNodes();
-    size = nodes.Size();
+    int size = nodes.Size();
+    theElements[eleTag] = ElementInfo{vertexPtr->getTag(), nodes};
     for (int j=0; j<size; j++) {
       int nodeTag = nodes(j);
       TaggedObject *theTaggedObject = theNodeLocations->getComponentPtr(nodeTag);
@@ -357,6 +344,8 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   while ((mpPtr = theMPs()) != 0) {
     int retained = mpPtr->getNodeRetained();
     int constrained = mpPtr->getNodeConstrained();
+    pinnedNodes.insert(retained);
+    pinnedNodes.insert(constrained);
     
     TaggedObject *theRetainedObject = theNodeLocations->getComponentPtr(retained);      
     TaggedObject *theConstrainedObject = theNodeLocations->getComponentPtr(constrained);
@@ -555,6 +544,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     SP_Constraint *spPtr;
     while ((spPtr = theSPs()) != 0) {
       int nodeTag = spPtr->getNodeTag();
+      pinnedNodes.insert(nodeTag);
       
       TaggedObject *theTaggedObject = theNodeLocations->getComponentPtr(nodeTag);
       if (theTaggedObject == 0) {
@@ -584,6 +574,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     ElementalLoad *theLoad;
     while ((theLoad = theLoads()) != 0) {
       int loadEleTag = theLoad->getElementTag();
+      pinnedElements.insert(loadEleTag);
 
       SubdomainIter &theSubdomains = myDomain->getSubdomains();
       Subdomain *theSub;
@@ -608,6 +599,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   SP_Constraint *spPtr;
   while ((spPtr = theDomainSP()) != 0) {
     int nodeTag = spPtr->getNodeTag();
+    pinnedNodes.insert(nodeTag);
 
     TaggedObject *theTaggedObject = theNodeLocations->getComponentPtr(nodeTag);
     if (theTaggedObject == 0) {
@@ -680,6 +672,14 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   myDomain->domainChange();
 
   myDomain->clearElementGraph();
+
+  // a load balancer weighs the elements by the time they take
+  if (theBalancer != 0) {
+    myDomain->setElementTiming(true);
+    SubdomainIter &theTimedSubDomains = myDomain->getSubdomains();
+    while ((theSubDomain = theTimedSubDomains()) != 0) 
+      theSubDomain->setElementTiming(true);
+  }
     
   // we are done
   partitionFlag = true;
@@ -726,16 +726,17 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
 	res = theBalancer->balance(theWeightedPGraph);
 	    
 	// now invoke domainChanged on Subdomains and PartitionedDomain
-    // { 
-
+	// if the balancer moved any elements
+	if (res > 0 || boundaryChanged == true) {
+	  this->buildBoundaryElements();
 
-      // All domains are informed that there has been a domain change
-	SubdomainIter &theSubDomains = myDomain->getSubdomains();
-	Subdomain *theSubDomain;
+	  SubdomainIter &theSubDomains = myDomain->getSubdomains();
+	  Subdomain *theSubDomain;
 
-	while ((theSubDomain = theSubDomains()) != 0) 
-	  theSubDomain->domainChange();
-        myDomain->domainChange();
+	  while ((theSubDomain = theSubDomains()) != 0) 
+	    theSubDomain->domainChange();
+	  myDomain->domainChange();
+	}
 	
 	// we invoke change on the PartitionedDomain
 
@@ -783,341 +784,240 @@ DomainPartitioner::getColoredGraph(void)
       opserr << " - No domain has been set";
       exit(0);
     }
+
+    // once partitioned the elements are spread over the subdomains
+    if (partitionFlag == true)
+      return *theElementGraph;
     
     return myDomain->getElementGraph();
 }
 
 
-int 
-DomainPartitioner::swapVertex(int from, int to, int vertexTag,
-			      bool adjacentVertexNotInOther)
+//
+// sets the weight of each vertex of the colored graph to the time its
+// element spent in update() since the last call, and returns in
+// partitionCosts(i) the total for partition i
+//
+int
+DomainPartitioner::measureElementCosts(Vector &partitionCosts)
 {
-  opserr << "DomainPartitioner::swapVertex() " << from << " " << to << " " << vertexTag << endln;
-
-  /*
-  // check that the object did the partitioning
   if (partitionFlag == false) {
-    opserr << "DomainPartitioner::balance(const Vector &load)";
+    opserr << "DomainPartitioner::measureElementCosts()";
     opserr << " - not partitioned or DomainPartitioner did not partition\n";
     return -1;
   }
-  
-  // check that the subdomain exist in partitioned domain
-  Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
-  if (fromSubdomain == 0) {
-    opserr << "DomainPartitioner::swapVertex - No from Subdomain: ";
-    opserr << from << " exists\n";
-    return -2;
-  }
-  Subdomain *toSubdomain = myDomain->getSubdomainPtr(to);
-  if (toSubdomain == 0) {
-    opserr << "DomainPartitioner::swapVertex - No to Subdomain: ";
-    opserr << to << " exists\n";
-    return -3;
-  }    
-  
-  // remove the vertex from the boundary if there
-  // if not there we have to get a pointer to it from the ele graph.
-  
-  //    Graph &theEleGraph = myDomain->getElementGraph();    
-  Graph *fromBoundary = theBoundaryElements[from-1];
-  Graph *toBoundary = theBoundaryElements[to-1];    
+
+  partitionCosts.resize(numPartitions+1);
+  partitionCosts.Zero();
+
+  VertexIter &theVertices = theElementGraph->getVertices();
   Vertex *vertexPtr;
-  
-  // get a pointer to the vertex in the element graph
-  if (adjacentVertexNotInOther  == false) {
-    vertexPtr = fromBoundary->removeVertex(vertexTag,false);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
+  while ((vertexPtr = theVertices()) != 0)
+    vertexPtr->setWeight(0.0);
+
+  ID eleTags(0);
+  Vector costs(0);
+  for (int i=1; i<=numPartitions; i++) {
+    if (i == mainPartition)
+      myDomain->getElementCosts(eleTags, costs);
+    else {
+      Subdomain *theSubdomain = myDomain->getSubdomainPtr(i);
+      if (theSubdomain == 0)
+	continue;
+      theSubdomain->getElementCosts(eleTags, costs);
+    }
 
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;
-  } else { // get a pointer and check vertex not adjacent to another partition
-    vertexPtr = fromBoundary->getVertexPtr(vertexTag);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;	
-    const ID &adjacent = vertexPtr->getAdjacency();
-    bool inTo = false;
-    bool inOther = false;
-    int adjacentSize = adjacent.Size();
-    for (int i=0; i<adjacentSize; i++) {
-      Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
-      if (other->getColor() == to) 
-	inTo = true;
-      else if (other->getColor() != from) {
-	inOther = true;
-	i = adjacentSize;
-      }
+    for (int j=0; j<eleTags.Size(); j++) {
+      auto theElement = theElements.find(eleTags(j));
+      if (theElement == theElements.end())
+	continue;
+      vertexPtr = theElementGraph->getVertexPtr(theElement->second.vertexTag);
+      vertexPtr->setWeight(costs(j));
+      partitionCosts(vertexPtr->getColor()) += costs(j);
     }
-    if (inTo != true || inOther == true) // we cannot remove the vertex
-      return -5;
-    // if can remove the vertex from the fromBoundary
-    Vertex *theVertex = fromBoundary->removeVertex(vertexTag,false);
   }
-  
-  int eleTag = vertexPtr->getRef();
-  
-  //
-  // in the FROM subdomain we:
-  //  1. remove the element
-  //  2. remove all nodes connected to the element divide color by prime
-  //  3. see if have to add nodes back as external
-  //  4. remove from the PartitionedDomain if node was external
-  //  5. add new elements to the boundary vertices for from
-  
-  //  1. remove the element from the fromSubdomain
-    //          this gives us a pointer to the element as well.
-
-    Element *elePtr = fromSubdomain->removeElement(eleTag);
-    if (elePtr == 0) // if ele not there we can just return but ERROR it should be
-  return -6;
 
-    //  2. remove all nodes connected to the element divide color by prime    
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-    int primeFrom = primes(from);
-    const ID  &nodes1 = elePtr->getExternalNodes(); // create a copy, need after send ele
-    ID  nodes(nodes1);
+  return 0;
+}
 
-    int nodesSize = nodes.Size();
-    Node **nodesArray = new Node *[nodesSize];
-    for (int i=0; i<nodesSize; i++) {
-  int nodeTag = nodes(i);
 
-  // remove the node
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
+//
+// places in theBoundaryElements[i-1] the vertices of partition i with a
+// neighbour in another partition; the graphs do not own the vertices
+//
+int
+DomainPartitioner::buildBoundaryElements(void)
+{
+  this->clearBoundaryElements();
 
-  (*nodePlace)(nodeTag) /= primeFrom;
-  nodesArray[i] = nodePtr;
-        // opserr << "DomainPartitioner::swapVertex -NODE " << *nodePtr;
-  // add back as external if still needed
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
+  theBoundaryElements = new Graph * [numPartitions];
+  for (int l=0; l<numPartitions; l++)
+    theBoundaryElements[l] = new Graph(2048); // graphs can grow larger; just an estimate
 
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
+  Vertex *vertexPtr;
+  VertexIter &theVertexIter = theElementGraph->getVertices();
+  while ((vertexPtr = theVertexIter()) != 0) {
+    int vertexColor = vertexPtr->getColor();
+    if (vertexColor < 1 || vertexColor > numPartitions) {
+      opserr << "DomainPartitioner::buildBoundaryElements()";
+      opserr << " - vertex " << vertexPtr->getTag() << " has no partition\n";
+      return -1;
     }
+    
+    // For each element, transverse its neighboring element
+    const ID &adjacency = vertexPtr->getAdjacency();
+    int size = adjacency.Size();
+    for (int i=0; i<size; i++) {
+      Vertex *otherVertex = theElementGraph->getVertexPtr(adjacency(i));
 
-    // 5. add new elements to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    const ID &eleAdjacent = vertexPtr->getAdjacency();
-    int eleAdjacentSize = eleAdjacent.Size();
+      //If a neighbor has a different color (partition)
+      if (otherVertex->getColor() != vertexColor) {
 
-    for (int a=0; a<eleAdjacentSize; a++) {
-	int otherEleVertexTag = eleAdjacent(a);
-	Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	if (other == 0) {
-	    other = theElementGraph->getVertexPtr(otherEleVertexTag);
-	    if (other->getColor() == from)
-		fromBoundary->addVertex(other,false);
-	}
+        //Add it into the boundary elements graph
+	theBoundaryElements[vertexColor-1]->addVertex(vertexPtr,false);
+	i = size;
+      }
     }
+  }
 
+  boundaryChanged = false;
+  return 0;
+}
 
-    
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
 
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-    int primeTo = primes(to);
-    for (int l=0; l<nodesSize; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  int nodeColor = (*nodePlace)(nodeTag);
-  if (nodeColor % primeTo == 0) {
-      Node *nodePtr;
-      nodePtr = toSubdomain->removeNode(nodes(l));
+void
+DomainPartitioner::clearBoundaryElements(void)
+{
+  if (theBoundaryElements == 0)
+    return;
+
+  // the vertices belong to theElementGraph; a Graph deletes its own
+  for (int i=0; i<numPartitions; i++) {
+    Graph *theBoundary = theBoundaryElements[i];
+    if (theBoundary == 0)
+      continue;
+    ID vertexTags(0, theBoundary->getNumVertex());
+    int numVertex = 0;
+    VertexIter &theVertices = theBoundary->getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0)
+      vertexTags[numVertex++] = vertexPtr->getTag();
+    for (int j=0; j<numVertex; j++)
+      theBoundary->removeVertex(vertexTags(j), false);
+    delete theBoundary;
   }
-    }
+  delete [] theBoundaryElements;
+  theBoundaryElements = 0;
+}
 
 
-    for (int m=0; m<nodesSize; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  2. mark all connecting nodes of elements as belonging to To      
-  (*nodePlace)(nodeTag) *= primeTo;
+//
+// moves the element of vertex vertexTag from partition from to partition
+// to. Nodes of the element that to does not have are added to it as
+// external nodes, and to the PartitionedDomain if they were internal to
+// from, where they become external. Nodes are never removed, so the
+// interface only grows. Elements with elemental loads and elements at
+// constrained nodes that to does not have are not moved. Returns 0 if
+// the element was moved, 1 if it may not be, and < 0 on error.
+//
+int 
+DomainPartitioner::swapVertex(int from, int to, int vertexTag,
+			      bool adjacentVertexNotInOther)
+{
+  // check that the object did the partitioning
+  if (partitionFlag == false) {
+    opserr << "DomainPartitioner::swapVertex()";
+    opserr << " - not partitioned or DomainPartitioner did not partition\n";
+    return -1;
+  }
 
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
+  if (from == to || from < 1 || from > numPartitions || to < 1 || to > numPartitions) {
+    opserr << "DomainPartitioner::swapVertex() - invalid partitions " << from << " " << to << endln;
+    return -2;
   }
-    }
 
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the element
-    
-    toSubdomain->addElement(elePtr);
-    
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
+  Subdomain *fromSubdomain = 0;
+  Subdomain *toSubdomain = 0;
+  if (from != mainPartition && (fromSubdomain = myDomain->getSubdomainPtr(from)) == 0) {
+    opserr << "DomainPartitioner::swapVertex - No from Subdomain: " << from << " exists\n";
+    return -2;
+  }
+  if (to != mainPartition && (toSubdomain = myDomain->getSubdomainPtr(to)) == 0) {
+    opserr << "DomainPartitioner::swapVertex - No to Subdomain: " << to << " exists\n";
+    return -2;
+  }
 
+  Vertex *vertexPtr = theElementGraph->getVertexPtr(vertexTag);
+  if (vertexPtr == 0 || vertexPtr->getColor() != from)
+    return -3;
 
-    vertexPtr->setColor(to);
-    toBoundary->addVertex(vertexPtr,false);
-
-    for (int n=0; n<eleAdjacentSize; n++) {
-	int otherEleVertexTag = eleAdjacent(n);
-	Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	if (other != 0) {
-	    const ID &othersAdjacency = other->getAdjacency();
-	    int otherSize = othersAdjacency.Size();
-	    for (int b=0; b<otherSize; b++) {
-		int anotherEleVertexTag = othersAdjacency(b);
-		Vertex *otherOther = theElementGraph->getVertexPtr(anotherEleVertexTag);
-		if (otherOther->getColor() != to) {
-		    toBoundary->addVertex(other,false);
-		    b=otherSize;
-		}
-	    }
-	}
+  if (adjacentVertexNotInOther == true) {
+    const ID &adjacency = vertexPtr->getAdjacency();
+    for (int i=0; i<adjacency.Size(); i++) {
+      int color = theElementGraph->getVertexPtr(adjacency(i))->getColor();
+      if (color != from && color != to)
+	return 1;
     }
+  }
 
-
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeSP_Constraint(spPtr->getTag());
-        toSubdomain->addSP_Constraint(spPtr);
+  int eleTag = vertexPtr->getRef();
+  auto theElement = theElements.find(eleTag);
+  if (theElement == theElements.end() || pinnedElements.count(eleTag) != 0)
+    return 1;
+
+  // check the nodes to be added to to are not constrained
+  const ID &nodes = theElement->second.nodes;
+  int numNodes = nodes.Size();
+  std::vector<NodeLocations *> locations(numNodes);
+  for (int i=0; i<numNodes; i++) {
+    locations[i] = (NodeLocations *)theNodeLocations->getComponentPtr(nodes(i));
+    if (locations[i] == 0) {
+      opserr << "DomainPartitioner::swapVertex() - no NodeLocation for node " << nodes(i) << " -- A BUG!!\n";
+      return -4;
     }
-      }
+    if (locations[i]->nodePartitions.getLocation(to) < 0 && pinnedNodes.count(nodes(i)) != 0)
+      return 1;
   }
-    }
 
-    
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeSP_Constraint(spPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addSP_Constraint(spPtr);
-    else
-        myDomain->addSP_Constraint(spPtr);
+  // add the missing nodes to to; those internal to from are made external
+  for (int i=0; i<numNodes; i++) {
+    int nodeTag = nodes(i);
+    if (locations[i]->nodePartitions.getLocation(to) >= 0)
+      continue;
+
+    if (myDomain->getNode(nodeTag) == 0) {
+      Node *theNode = (fromSubdomain != 0) ? fromSubdomain->makeNodeExternal(nodeTag) : 0;
+      if (theNode == 0 || myDomain->addNode(theNode) == false) {
+	opserr << "DomainPartitioner::swapVertex() - failed to make node " << nodeTag << " external\n";
+	return -5;
       }
-  }
     }
 
-
-
-  */
-    /*
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeNodalLoad(loadPtr->getTag());
-        toSubdomain->addNodalLoad(loadPtr);
+    if (toSubdomain != 0 && toSubdomain->addExternalNode(myDomain->getNode(nodeTag)) == false) {
+      opserr << "DomainPartitioner::swapVertex() - failed to add node " << nodeTag << " to " << to << endln;
+      return -5;
     }
-      }
+    locations[i]->addPartition(to);
   }
-    }
-
-
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
 
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeNodalLoad(loadPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addNodalLoad(loadPtr);
-    else
-        myDomain->addNodalLoad(loadPtr);
-      }  
+  // move the element
+  Element *elePtr = (fromSubdomain != 0) ? fromSubdomain->removeElement(eleTag)
+                                         : myDomain->removeElement(eleTag);
+  if (elePtr == 0) {
+    opserr << "DomainPartitioner::swapVertex() - element " << eleTag << " not in partition " << from << endln;
+    return -6;
   }
-    }
-    */
 
-    return 0;
+  bool added = (toSubdomain != 0) ? toSubdomain->addElement(elePtr)
+                                  : myDomain->addElement(elePtr);
+  if (added == false) {
+    opserr << "DomainPartitioner::swapVertex() - failed to add element " << eleTag << " to " << to << endln;
+    return -6;
+  }
 
+  vertexPtr->setColor(to);
+  boundaryChanged = true;
+  return 0;
 }
 
 
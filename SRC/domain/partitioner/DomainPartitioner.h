@@ -38,6 +38,8 @@
 #include <stdbool.h>
 #endif
 
+#include <map>
+#include <set>
 #include <ID.h>
 
 class GraphPartitioner;
@@ -66,6 +68,7 @@ class DomainPartitioner
     virtual int getNumPartitions(void) const;
     virtual Graph &getPartitionGraph(void);
     virtual Graph &getColoredGraph(void);
+    virtual int measureElementCosts(Vector &partitionCosts);
     
     virtual int  swapVertex(int from, 
 			    int to, 
@@ -94,6 +97,9 @@ class DomainPartitioner
   protected:    
     
   private:
+    int buildBoundaryElements(void);
+    void clearBoundaryElements(void);
+
     PartitionedDomain *myDomain; 
     GraphPartitioner  &thePartitioner;
     LoadBalancer      *theBalancer;    
@@ -109,6 +115,14 @@ class DomainPartitioner
     
     bool usingMainDomain;
     int mainPartition;
+
+    // what swapVertex() needs to know about the elements and nodes that
+    // have left the PartitionedDomain
+    struct ElementInfo {int vertexTag; ID nodes;};
+    std::map<int, ElementInfo> theElements;
+    std::set<int> pinnedElements;    // have elemental loads
+    std::set<int> pinnedNodes;       // have SP or MP constraints
+    bool boundaryChanged;
 };
 
 #endif
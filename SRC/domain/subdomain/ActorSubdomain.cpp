@@ -166,9 +166,11 @@ ActorSubdomain::run(void)
 	    msgData(0) = theID->Size();
 	    msgData(1) = this->getNumDOF();
 
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (theID->Size() != 0)
 	      this->sendID(*theID);
+	    this->flush();
 	    break;
 
 	  case ShadowActorSubdomain_getCost:
@@ -456,11 +458,13 @@ ActorSubdomain::run(void)
 	    else
 		msgData(0) = -1;
 
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (theEle != 0) {
 		this->sendObject(*theEle);
 		delete theEle;
 	    }
+	    this->flush();
 
 	    msgData(0) = 0;
 
@@ -477,11 +481,13 @@ ActorSubdomain::run(void)
 	    else
 		msgData(0) = -1;
 
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (theNod != 0) {
 		this->sendObject(*theNod);
 		delete theNod;
 	    }
+	    this->flush();
 
 	    msgData(0) = 0;
 
@@ -553,10 +559,12 @@ ActorSubdomain::run(void)
 	    else
 		msgData(0) = -1;
 
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (theEle != 0) {
 		this->sendObject(*theEle);
 	    }
+	    this->flush();
 
 	    msgData(0) = 0;
 
@@ -573,11 +581,13 @@ ActorSubdomain::run(void)
 	    else
 		msgData(0) = -1;
 
+	    this->startBatch();
 	    this->sendID(msgData);
 
 	    if (theNod != 0) {
 		this->sendObject(*theNod);
 	    }
+	    this->flush();
 
 	    msgData(0) = 0;
 
@@ -846,6 +856,7 @@ ActorSubdomain::run(void)
 	    dbTag = msgData(2); // dof
 	    doubleRes = this->getNodeDisp(tag, dbTag, intRes);
 	    msgData(0) = intRes;
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (intRes == 0) {
 	      theV = new Vector(1);
@@ -853,6 +864,7 @@ ActorSubdomain::run(void)
 	      this->sendVector(*theV);
 	      delete theV;
 	    }
+	    this->flush();
 	    break;
 
 	  case ShadowActorSubdomain_setMass:
@@ -880,10 +892,12 @@ ActorSubdomain::run(void)
 	      msgData(0) = 1;
 	      msgData(1) = theVector->Size();
 	    }
+	    this->startBatch();
 	    this->sendID(msgData);
 
 	    if (theVector != 0)
 	      this->sendVector(*theVector);
+	    this->flush();
 
 	    break;
 
@@ -937,13 +951,50 @@ ActorSubdomain::run(void)
 	      msgData(0) = 1;
 	      msgData(1) = theVector->Size();
 	    }
+	    this->startBatch();
 	    this->sendID(msgData);
 
 	    if (theVector != 0)
 	      this->sendVector(*theVector);
+	    this->flush();
       
 	    break;
 
+	  case ShadowActorSubdomain_setElementTiming:
+	    this->setElementTiming(msgData(1) == 1);
+	    break;
+
+	  case ShadowActorSubdomain_getElementCosts:
+	    {
+	      ID eleTags(0);
+	      Vector costs(0);
+	      int numEle = this->getElementCosts(eleTags, costs, msgData(1) == 1);
+	      msgData(0) = numEle;
+	      this->startBatch();
+	      this->sendID(msgData);
+	      if (numEle > 0) {
+		this->sendID(eleTags);
+		this->sendVector(costs);
+	      }
+	      this->flush();
+	    }
+	    break;
+
+	  case ShadowActorSubdomain_makeNodeExternal:
+	    theNod = this->makeNodeExternal(msgData(1));
+	    if (theNod != 0)
+	      msgData(0) = theNod->getClassTag();
+	    else
+	      msgData(0) = -1;
+	    this->startBatch();
+	    this->sendID(msgData);
+	    if (theNod != 0) {
+	      this->sendObject(*theNod);
+	      delete theNod;
+	    }
+	    this->flush();
+	    break;
+
 	  case ShadowActorSubdomain_calculateNodalReactions:
 	    if (msgData(0) == 0)
 	      this->calculateNodalReactions(true);
@@ -204,8 +204,10 @@ bool ShadowSubdomain::addElement(Element *theEle)
   msgData(0) = ShadowActorSubdomain_addElement;
   msgData(1) = theEle->getClassTag();
   msgData(2) = theEle->getDbTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theEle);
+  this->flush();
   theElements[numElements] = tag;
   numElements++;
   //    this->Domain::domainChange();
@@ -222,8 +224,10 @@ bool ShadowSubdomain::addNode(Node *theNode)
   msgData(0) = ShadowActorSubdomain_addNode;
   msgData(1) = theNode->getClassTag();
   msgData(2) = theNode->getDbTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theNode);
+  this->flush();
   theNodes[numNodes] = tag;
   numNodes++;
   // this->Domain::domainChange();
@@ -240,8 +244,10 @@ bool ShadowSubdomain::addExternalNode(Node *theNode)
   msgData(0) = ShadowActorSubdomain_addExternalNode;
   msgData(1) = theNode->getClassTag();
   msgData(2) = theNode->getDbTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theNode);
+  this->flush();
   theNodes[numNodes]                 = tag;
   theExternalNodes[numExternalNodes] = tag;
   numNodes++;
@@ -258,8 +264,10 @@ bool ShadowSubdomain::addSP_Constraint(SP_Constraint *theSP)
   msgData(0) = ShadowActorSubdomain_addSP_Constraint;
   msgData(1) = theSP->getClassTag();
   msgData(2) = theSP->getDbTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theSP);
+  this->flush();
   numSPs++;
   // this->Domain::domainChange();
 
@@ -276,6 +284,7 @@ int ShadowSubdomain::addSP_Constraint(int axisDirn, double axisValue,
   msgData(1) = axisDirn;
   msgData(2) = fixityCodes.Size();
   msgData(3) = SP_Constraint_GetNextTag();
+  this->startBatch();
   this->sendID(msgData);
 
   this->sendID(fixityCodes);
@@ -283,6 +292,7 @@ int ShadowSubdomain::addSP_Constraint(int axisDirn, double axisValue,
   data(0) = axisValue;
   data(1) = tol;
   this->sendVector(data);
+  this->flush();
 
   this->recvID(msgData);
   int endTag = msgData(1);
@@ -316,8 +326,10 @@ bool ShadowSubdomain::addMP_Constraint(MP_Constraint *theMP)
   msgData(0) = ShadowActorSubdomain_addMP_Constraint;
   msgData(1) = theMP->getClassTag();
   msgData(2) = theMP->getDbTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theMP);
+  this->flush();
   numMPs++;
   // // this->Domain::domainChange();
 
@@ -331,8 +343,10 @@ bool ShadowSubdomain::addLoadPattern(LoadPattern *thePattern)
   msgData(0) = ShadowActorSubdomain_addLoadPattern;
   msgData(1) = thePattern->getClassTag();
   msgData(2) = thePattern->getDbTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*thePattern);
+  this->flush();
   //    this->Domain::domainChange();
 
   theShadowLPs->addComponent(thePattern);
@@ -356,8 +370,10 @@ bool ShadowSubdomain::addSP_Constraint(SP_Constraint *theSP, int loadPattern)
   msgData(1) = theSP->getClassTag();
   msgData(2) = theSP->getDbTag();
   msgData(3) = loadPattern;
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theSP);
+  this->flush();
   numSPs++;
   // this->Domain::domainChange();
 
@@ -379,8 +395,10 @@ bool ShadowSubdomain::addNodalLoad(NodalLoad *theLoad, int loadPattern)
   msgData(1) = theLoad->getClassTag();
   msgData(2) = theLoad->getDbTag();
   msgData(3) = loadPattern;
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theLoad);
+  this->flush();
 
   return true;
 }
@@ -400,8 +418,10 @@ bool ShadowSubdomain::addElementalLoad(ElementalLoad *theLoad, int loadPattern)
   msgData(1) = theLoad->getClassTag();
   msgData(2) = theLoad->getDbTag();
   msgData(3) = loadPattern;
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(*theLoad);
+  this->flush();
 
   return true;
 }
@@ -494,6 +514,32 @@ Node *ShadowSubdomain::removeNode(int tag)
   }
 }
 
+Node *ShadowSubdomain::makeNodeExternal(int tag)
+{
+  if (theNodes.getLocation(tag) < 0)
+    return 0;
+
+  msgData(0) = ShadowActorSubdomain_makeNodeExternal;
+  msgData(1) = tag;
+  this->sendID(msgData);
+  this->recvID(msgData);
+  int theType = msgData(0);
+  if (theType == -1)
+    return 0;
+
+  Node *theNode = theObjectBroker->getNewNode(theType);
+  if (theNode == 0)
+    return 0;
+  this->recvObject(*theNode);
+
+  if (theExternalNodes.getLocation(tag) < 0) {
+    theExternalNodes[numExternalNodes] = tag;
+    numExternalNodes++;
+    numDOF += theNode->getNumberDOF();
+  }
+  return theNode;
+}
+
 SP_Constraint *ShadowSubdomain::removeSP_Constraint(int tag)
 {
   TaggedObject *mc = theShadowSPs->removeComponent(tag);
@@ -763,8 +809,10 @@ void ShadowSubdomain::applyLoad(double time)
     Vector data(4);
     data(0) = time;
 
+    this->startBatch();
     this->sendID(msgData);
     this->sendVector(data);
+    this->flush();
   }
 }
 
@@ -784,8 +832,10 @@ void ShadowSubdomain::setCurrentTime(double time)
     Vector data(4);
     data(0) = time;
 
+    this->startBatch();
     this->sendID(msgData);
     this->sendVector(data);
+    this->flush();
   }
 }
 
@@ -795,8 +845,10 @@ void ShadowSubdomain::setCommittedTime(double time)
   Vector data(4);
   data(0) = time;
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendVector(data);
+  this->flush();
 }
 
 void ShadowSubdomain::setLoadConstant(void)
@@ -811,6 +863,7 @@ int ShadowSubdomain::setRayleighDampingFactors(double alphaM, double betaK,
 {
   msgData(0) = ShadowActorSubdomain_setRayleighDampingFactors;
 
+  this->startBatch();
   this->sendID(msgData);
 
   static Vector data(4);
@@ -819,6 +872,7 @@ int ShadowSubdomain::setRayleighDampingFactors(double alphaM, double betaK,
   data(2) = betaK0;
   data(3) = betaKc;
   this->sendVector(data);
+  this->flush();
   return 0;
 }
 
@@ -838,10 +892,12 @@ int ShadowSubdomain::update(double newTime, double dT)
   DomainDecompositionAnalysis *theDDA = this->getDDAnalysis();
   if (theDDA != 0 && theDDA->doesIndependentAnalysis() != true) {
     msgData(0) = ShadowActorSubdomain_updateTimeDt;
+    this->startBatch();
     this->sendID(msgData);
     data(0) = newTime;
     data(1) = dT;
     this->sendVector(data);
+    this->flush();
   }
 
   return 0;
@@ -874,8 +930,10 @@ int ShadowSubdomain::addRecorder(Recorder &theRecorder)
 {
   msgData(0) = ShadowActorSubdomain_addRecorder;
   msgData(1) = theRecorder.getClassTag();
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theRecorder);
+  this->flush();
   return 0;
 }
 
@@ -960,8 +1018,10 @@ void ShadowSubdomain::setDomainDecompAnalysis(
   msgData(0) = ShadowActorSubdomain_setDomainDecompAnalysis;
   msgData(1) = theDDAnalysis.getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theDDAnalysis);
+  this->flush();
 
   this->Subdomain::setDomainDecompAnalysis(theDDAnalysis);
 }
@@ -971,8 +1031,10 @@ int ShadowSubdomain::setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm)
   msgData(0) = ShadowActorSubdomain_setAnalysisAlgorithm;
   msgData(1) = theAlgorithm.getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theAlgorithm);
+  this->flush();
 
   return 0;
 }
@@ -982,8 +1044,10 @@ int ShadowSubdomain::setAnalysisIntegrator(IncrementalIntegrator &theIntegrator)
   msgData(0) = ShadowActorSubdomain_setAnalysisIntegrator;
   msgData(1) = theIntegrator.getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theIntegrator);
+  this->flush();
   this->recvID(msgData);
 
   return 0;
@@ -994,8 +1058,10 @@ int ShadowSubdomain::setAnalysisLinearSOE(LinearSOE &theSOE)
   msgData(0) = ShadowActorSubdomain_setAnalysisLinearSOE;
   msgData(1) = theSOE.getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theSOE);
+  this->flush();
 
   return 0;
 }
@@ -1005,8 +1071,10 @@ int ShadowSubdomain::setAnalysisEigenSOE(EigenSOE &theSOE)
   msgData(0) = ShadowActorSubdomain_setAnalysisEigenSOE;
   msgData(1) = theSOE.getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theSOE);
+  this->flush();
 
   return 0;
 }
@@ -1016,8 +1084,10 @@ int ShadowSubdomain::setAnalysisConvergenceTest(ConvergenceTest &theTest)
   msgData(0) = ShadowActorSubdomain_setAnalysisConvergenceTest;
   msgData(1) = theTest.getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
   this->sendObject(theTest);
+  this->flush();
 
   return 0;
 }
@@ -1205,9 +1275,11 @@ int ShadowSubdomain::computeNodalResponse(void)
         opserr << msgData(1) << "do not agree?\n";
         numDOF = msgData(1);
       }
+      this->startBatch();
       this->sendID(msgData);
       Vector theChange(lastChange);
       this->sendVector(theChange);
+      this->flush();
     }
   }
 
@@ -1217,12 +1289,14 @@ int ShadowSubdomain::computeNodalResponse(void)
 int ShadowSubdomain::analysisStep(double dT)
 {
   msgData(0) = ShadowActorSubdomain_analysisStep;
+  this->startBatch();
   this->sendID(msgData);
 
   static Vector timeStep(4);
   timeStep(0) = dT;
 
   this->sendVector(timeStep);
+  this->flush();
 
   return 0;
 }
@@ -1258,6 +1332,30 @@ double ShadowSubdomain::getCost(void)
   return 0.0;
 }
 
+void ShadowSubdomain::setElementTiming(bool onOff)
+{
+  msgData(0) = ShadowActorSubdomain_setElementTiming;
+  msgData(1) = onOff ? 1 : 0;
+  this->sendID(msgData);
+}
+
+int ShadowSubdomain::getElementCosts(ID &eleTags, Vector &costs, bool reset)
+{
+  msgData(0) = ShadowActorSubdomain_getElementCosts;
+  msgData(1) = reset ? 1 : 0;
+  this->sendID(msgData);
+  this->recvID(msgData);
+
+  int numEle = msgData(0);
+  eleTags.resize(numEle);
+  costs.resize(numEle);
+  if (numEle > 0) {
+    this->recvID(eleTags);
+    this->recvVector(costs);
+  }
+  return numEle;
+}
+
 int ShadowSubdomain::sendSelf(int cTag, Channel &the_Channel)
 {
   opserr << "ShadowSubdomain::sendSelf() ";
@@ -1351,8 +1449,10 @@ int ShadowSubdomain::setMass(const Matrix &mass, int nodeTag)
   msgData(1) = nodeTag;
   msgData(2) = mass.noRows();
   msgData(3) = mass.noCols();
+  this->startBatch();
   this->sendID(msgData);
   this->sendMatrix(mass);
+  this->flush();
   this->recvID(msgData);
   return msgData(0);
 }
@@ -1459,9 +1559,11 @@ bool ShadowSubdomain::addParameter(Parameter *param)
   msgData(0) = ShadowActorSubdomain_addParameter;
   msgData(1) = param->getClassTag();
 
+  this->startBatch();
   this->sendID(msgData);
 
   this->sendObject(*param);
+  this->flush();
   return 0;
 }
 
@@ -1493,11 +1595,13 @@ int ShadowSubdomain::updateParameter(int tag, double value)
   msgData(0) = ShadowActorSubdomain_updateParameterDOUBLE;
   msgData(1) = tag;
 
+  this->startBatch();
   this->sendID(msgData);
 
   static Vector data(1);
   data(0) = value;
   this->sendVector(data);
+  this->flush();
 
   if (this->recvID(msgData) != 0) {
     opserr << "ShadowSubdomain::updateParameterD ERROR 4\n";
@@ -64,6 +64,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual  bool addElement(Element *);
     virtual  bool addNode(Node *);
     virtual  bool addExternalNode(Node *);
+    virtual  Node *makeNodeExternal(int tag);
     virtual  bool addSP_Constraint(SP_Constraint *);
     virtual  int  addSP_Constraint(int axisDirn, double axisValue, 
 				   const ID &fixityCodes, double tol=1e-10);
@@ -165,6 +166,8 @@ class ShadowSubdomain: public Shadow, public Subdomain
 			 FEM_ObjectBroker &theBroker);    
 
     virtual double getCost(void);
+    virtual void setElementTiming(bool onOff);
+    virtual int getElementCosts(ID &eleTags, Vector &costs, bool reset = true);
     
     virtual  void Print(OPS_Stream &s, int flag =0);
     virtual void Print(OPS_Stream &s, ID *nodeTags, ID *eleTags, int flag =0);
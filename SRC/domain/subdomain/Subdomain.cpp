@@ -233,6 +233,33 @@ Subdomain::addExternalNode(Node *thePtr)
 
 
 
+//
+// moves an internal node to the external nodes, which it must become when
+// an element attached to it is moved to another subdomain; returns a copy
+// of the node, without its mass, that the caller is responsible for
+//
+Node *
+Subdomain::makeNodeExternal(int tag)
+{
+  Node *theNode = (Node *)externalNodes->getComponentPtr(tag);
+  if (theNode != 0)
+    return new Node(*theNode, false);
+
+  theNode = (Node *)internalNodes->removeComponent(tag);
+  if (theNode == 0)
+    return 0;
+
+  if (externalNodes->addComponent(theNode) == false) {
+    opserr << "Subdomain::makeNodeExternal() - failed to move node " << tag << endln;
+    internalNodes->addComponent(theNode);
+    return 0;
+  }
+
+  this->domainChange();
+  return new Node(*theNode, false);
+}
+
+
 Node *
 Subdomain::removeNode(int tag)
 {
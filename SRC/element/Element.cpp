@@ -39,7 +39,7 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element *ops_TheActiveElement = 0;
 
 Matrix **Element::theMatrices; 
 Vector **Element::theVectors1; 
@@ -183,6 +183,15 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   return 0;
 }
 
+void
+Element::getRayleighDampingFactors(double &alpham, double &betak, double &betak0, double &betakc) const
+{
+  alpham = alphaM;
+  betak  = betaK;
+  betak0 = betaK0;
+  betakc = betaKc;
+}
+
 const Matrix &
 Element::getDamp() 
 {
@@ -389,6 +398,15 @@ Element::isSubdomain(void)
     return false;
 }
 
+// Returns true if update() and getResistingForce() may be invoked on
+// different elements of the class at the same time, i.e. the element
+// neither writes class wide data nor returns class wide buffers there.
+bool
+Element::isReentrant(void)
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -681,6 +699,40 @@ double Element::getCharacteristicLength(void)
   }
   return minSize;
 }
+
+//
+// Upper bound on the highest natural frequency of the element alone,
+// from the Gershgorin bound on M^-1 K with the element mass lumped by
+// row sums. Returns 0 if the element has a stiff DOF without mass, in
+// which case no element-level bound exists. Subclasses with a closed
+// form estimate (e.g. wave speed over characteristic length) may override.
+//
+double
+Element::getMaxFrequency()
+{
+  const Matrix &K = this->getTangentStiff();
+  const Matrix &M = this->getMass();
+  const int n = K.noRows();
+  if (n == 0 || K.noCols() != n || M.noRows() != n || M.noCols() != n)
+    return 0.0;
+
+  double omega2 = 0.0;
+  for (int i=0; i<n; i++) {
+    double k = 0.0;
+    double m = 0.0;
+    for (int j=0; j<n; j++) {
+      k += fabs(K(i,j));
+      m += M(i,j);
+    }
+    if (k <= 0.0)
+      continue;
+    if (m <= 0.0)
+      return 0.0;
+    if (k/m > omega2)
+      omega2 = k/m;
+  }
+  return sqrt(omega2);
+}
       
 
 
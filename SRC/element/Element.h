@@ -53,6 +53,7 @@ class Element : public DomainComponent
     virtual Node **getNodePtrs()  =0;	
     virtual int    getNumDOF()    =0;
     virtual double getCharacteristicLength();
+    virtual double getMaxFrequency();
 
     // methods dealing with committed state and update
     virtual int  commitState();
@@ -60,6 +61,7 @@ class Element : public DomainComponent
     virtual int  revertToStart();
     virtual int  update();
     virtual bool isSubdomain();
+    virtual bool isReentrant();
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -76,6 +78,7 @@ class Element : public DomainComponent
 
     virtual int addInertiaLoadToUnbalance(const Vector &accel);
     virtual int setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
+    void getRayleighDampingFactors(double &alphaM, double &betaK, double &betaK0, double &betaKc) const;
 
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce() =0;
@@ -77,6 +77,14 @@
 #include <ElementalLoad.h>
 #include <ElementIter.h>
 
+// define to set the trial state of the sections of an element on a pool
+// of threads, for sections that do not share any state between them
+// #define N_SECTION_THREADS 4
+#ifdef N_SECTION_THREADS
+#include <atomic>
+#include <threads/thread_pool.hpp>
+#endif
+
 #define DefaultLoverGJ 1.0e-10
 
 Matrix ForceBeamColumn3d::theMatrix(12,12);
@@ -86,6 +94,7 @@ double ForceBeamColumn3d::workArea[200];
 Vector ForceBeamColumn3d::vsSubdivide[maxNumSections];
 Matrix ForceBeamColumn3d::fsSubdivide[maxNumSections];
 Vector ForceBeamColumn3d::SsrSubdivide[maxNumSections];
+Vector ForceBeamColumn3d::SsTrial[maxNumSections];
 
 #if 0
 #include <elementAPI.h>
@@ -694,7 +703,6 @@ ForceBeamColumn3d::update()
     vin -= dv;
 
     double L = crdTransf->getInitialLength();
-    double oneOverL  = 1.0/L;  
 
     double xi[maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, xi);
@@ -733,7 +741,6 @@ ForceBeamColumn3d::update()
     //   and deformations. if they work and we have subdivided we apply
     //   the remaining dV.
 
-    int i, j;
     while (converged == false && numSubdivide <= maxSubdivisions) {
 //    opserr << getTag() << " dv_trial = " << dvTrial << "\n";
 
@@ -790,257 +797,14 @@ ForceBeamColumn3d::update()
             vr(3) += v0[3];
             vr(4) += v0[4];
 
-            
-            for (i=0; i<numSections; i++) {
-              
-              int order      = sections[i]->getOrder();
-              const ID &code = sections[i]->getType();
-              
-              static Vector Ss;
-              static Vector dSs;
-              static Vector dvs;
-              static Matrix fb;
-              
-              Ss.setData(workArea, order);
-              dSs.setData(&workArea[order], order);
-              dvs.setData(&workArea[2*order], order);
-              fb.setData(&workArea[3*order], order, NEBD);
-              
-              double xL  = xi[i];
-              double xL1 = xL-1.0;
-              double wtL = wt[i]*L;
-
-              // calculate total section forces
-              // Ss = b*Se + bp*currDistrLoad;
-              // Ss.addMatrixVector(0.0, b[i], Se, 1.0);
-              int ii;
-              for (ii = 0; ii < order; ii++) {
-                switch(code(ii)) {
-                case SECTION_RESPONSE_P:
-                  Ss(ii) = SeTrial(0);
-                  break;
-                case SECTION_RESPONSE_MZ:
-                  Ss(ii) = xL1*SeTrial(1) + xL*SeTrial(2);
-                  break;
-                case SECTION_RESPONSE_VY:
-                  Ss(ii) = oneOverL*(SeTrial(1)+SeTrial(2));
-                  break;
-                case SECTION_RESPONSE_MY:
-                  Ss(ii) = xL1*SeTrial(3) + xL*SeTrial(4);
-                  break;
-                case SECTION_RESPONSE_VZ:
-                  Ss(ii) = oneOverL*(SeTrial(3)+SeTrial(4));
-                  break;
-                case SECTION_RESPONSE_T:
-                  Ss(ii) = SeTrial(5);
-                  break;
-                default:
-                  Ss(ii) = 0.0;
-                  break;
-                }
-              }
-              
-              // Add the effects of element loads, if present
-              // s = b*q + sp
-              if (numEleLoads > 0)
-                this->computeSectionForces(Ss, i);
-
-
-              // dSs = Ss - Ssr[i];
-              dSs = Ss;
-              dSs.addVector(1.0, SsrSubdivide[i], -1.0);
-              
-              // compute section deformation increments
-              if (l == 0) {
-                //  regular newton 
-                //    vs += fs * dSs;     
-
-                dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
-                
-              } else if (l == 2) {
-                //  newton with initial tangent if first iteration
-                //    vs += fs0 * dSs;     
-                //  otherwise regular newton 
-                //    vs += fs * dSs;     
-                
-                if (j == 0) {
-                  const Matrix &fs0 = sections[i]->getInitialFlexibility();
-                  dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
-                } else
-                  dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
-                
-              } else {
-                
-                //  newton with initial tangent
-                //    vs += fs0 * dSs;     
-                
-                const Matrix &fs0 = sections[i]->getInitialFlexibility();
-                dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
-              }
-              
-              // set section deformations
-              if (initialFlag != 0)
-                vsSubdivide[i] += dvs;
-
-              if ( sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-                opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
-                return -1;
-              }
-              
-              // get section resisting forces
-              SsrSubdivide[i] = sections[i]->getStressResultant();
-              
-              // get section flexibility matrix
-              // FRANK 
-              fsSubdivide[i] = sections[i]->getSectionFlexibility();
-              
-              /*
-                const Matrix &sectionStiff = sections[i]->getSectionTangent();
-                int n = sectionStiff.noRows();
-                Matrix I(n,n); I.Zero(); for (int l=0; l<n; l++) I(l,l) = 1.0;
-                Matrix sectionFlex(n,n);
-                sectionStiff.SolveSVD(I, sectionFlex, 1.0e-6);
-                fsSubdivide[i] = sectionFlex;            
-              */
-              
-              // calculate section residual deformations
-              // dvs = fs * (Ss - Ssr);
-              dSs = Ss;
-              dSs.addVector(1.0, SsrSubdivide[i], -1.0);  // dSs = Ss - Ssr[i];
-
-              dvs.addMatrixVector(0.0, fsSubdivide[i], dSs, 1.0);
-              
-              // integrate element flexibility matrix
-              // f = f + (b^ fs * b) * wtL;
-              //f.addMatrixTripleProduct(1.0, b[i], fs[i], wtL);
-              int jj;
-              const Matrix &fSec = fsSubdivide[i];
-              fb.Zero();
-              double tmp;
-              for (int ii = 0; ii < order; ii++) {
-                switch(code(ii)) {
-                case SECTION_RESPONSE_P:
-                  for (jj = 0; jj < order; jj++)
-                    fb(jj,0) += fSec(jj,ii)*wtL;
-                  break;
-                case SECTION_RESPONSE_MZ:
-                  for (jj = 0; jj < order; jj++) {
-                    tmp = fSec(jj,ii)*wtL;
-                        fb(jj,1) += xL1*tmp;
-                        fb(jj,2) += xL*tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_VY:
-                      for (jj = 0; jj < order; jj++) {
-                        tmp = oneOverL*fSec(jj,ii)*wtL;
-                        fb(jj,1) += tmp;
-                        fb(jj,2) += tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_MY:
-                      for (jj = 0; jj < order; jj++) {
-                        tmp = fSec(jj,ii)*wtL;
-                        fb(jj,3) += xL1*tmp;
-                        fb(jj,4) += xL*tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_VZ:
-                      for (jj = 0; jj < order; jj++) {
-                        tmp = oneOverL*fSec(jj,ii)*wtL;
-                        fb(jj,3) += tmp;
-                        fb(jj,4) += tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_T:
-                      for (jj = 0; jj < order; jj++)
-                        fb(jj,5) += fSec(jj,ii)*wtL;
-                      break;
-                    default:
-                      break;
-                    }
-                  }
-
-                  for (int ii = 0; ii < order; ii++) {
-                    switch (code(ii)) {
-                    case SECTION_RESPONSE_P:
-                      for (jj = 0; jj < NEBD; jj++)
-                        f(0,jj) += fb(ii,jj);
-                      break;
-                    case SECTION_RESPONSE_MZ:
-                      for (jj = 0; jj < NEBD; jj++) {
-                        tmp = fb(ii,jj);
-                        f(1,jj) += xL1*tmp;
-                        f(2,jj) += xL*tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_VY:
-                      for (jj = 0; jj < NEBD; jj++) {
-                        tmp = oneOverL*fb(ii,jj);
-                        f(1,jj) += tmp;
-                        f(2,jj) += tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_MY:
-                      for (jj = 0; jj < NEBD; jj++) {
-                        tmp = fb(ii,jj);
-                        f(3,jj) += xL1*tmp;
-                        f(4,jj) += xL*tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_VZ:
-                      for (jj = 0; jj < NEBD; jj++) {
-                        tmp = oneOverL*fb(ii,jj);
-                        f(3,jj) += tmp;
-                        f(4,jj) += tmp;
-                      }
-                      break;
-                    case SECTION_RESPONSE_T:
-                      for (jj = 0; jj < NEBD; jj++)
-                        f(5,jj) += fb(ii,jj);
-                      break;
-                    default:
-                      break;
-                    }
-                  }
+            // set the trial state of all the sections at once, then
+            // integrate the flexibility and residual deformations
+            if (this->setSectionStates(l, j, SeTrial, xi, L) < 0) {
+              opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
+              return -1;
+            }
 
-                  // integrate residual deformations
-                  // vr += (b^ (vs + dvs)) * wtL;
-                  //vr.addMatrixTransposeVector(1.0, b[i], vs[i] + dvs, wtL);
-                  dvs.addVector(1.0, vsSubdivide[i], 1.0);
-              
-                  double dei;
-                  for (int ii = 0; ii < order; ii++) {
-                    dei = dvs(ii)*wtL;
-                    switch(code(ii)) {
-                    case SECTION_RESPONSE_P:
-                      vr(0) += dei;
-                      break;
-                    case SECTION_RESPONSE_MZ:
-                      vr(1) += xL1*dei; 
-                      vr(2) += xL*dei;
-                      break;
-                    case SECTION_RESPONSE_VY:
-                      tmp = oneOverL*dei;
-                      vr(1) += tmp; 
-                      vr(2) += tmp;
-                      break;
-                    case SECTION_RESPONSE_MY:
-                      vr(3) += xL1*dei; 
-                      vr(4) += xL*dei;
-                      break;
-                    case SECTION_RESPONSE_VZ:
-                      tmp = oneOverL*dei;
-                      vr(3) += tmp;
-                      vr(4) += tmp;
-                      break;
-                    case SECTION_RESPONSE_T:
-                      vr(5) += dei;
-                      break;
-                    default:
-                      break;
-                    }
-                  }
-                }
+            this->integrateSections(xi, wt, L, f, vr);
 
                 if (!isTorsion) {
                   f(5,5) = DefaultLoverGJ;
@@ -1142,6 +906,174 @@ ForceBeamColumn3d::update()
     return 0;
   }
 
+int
+ForceBeamColumn3d::setSectionStates(int scheme, int iter, const Vector &SeTrial,
+                                    const double *xi, double L)
+{
+  // sets the trial deformations of section i from the section forces in
+  // equilibrium with SeTrial, and gets its resisting forces and flexibility;
+  // each call only touches the data of its own section
+  auto evaluate = [&](int i) -> int {
+    const int order = sections[i]->getOrder();
+    const ID &code = sections[i]->getType();
+
+    const double xL  = xi[i];
+    const double xL1 = xL - 1.0;
+    const double oneOverL = 1.0/L;
+
+    // Ss = b*Se + bp*currDistrLoad
+    Vector &Ss = SsTrial[i];
+    Ss.resize(order);
+    for (int ii = 0; ii < order; ii++) {
+      switch(code(ii)) {
+      case SECTION_RESPONSE_P:
+        Ss(ii) = SeTrial(0);
+        break;
+      case SECTION_RESPONSE_MZ:
+        Ss(ii) = xL1*SeTrial(1) + xL*SeTrial(2);
+        break;
+      case SECTION_RESPONSE_VY:
+        Ss(ii) = oneOverL*(SeTrial(1)+SeTrial(2));
+        break;
+      case SECTION_RESPONSE_MY:
+        Ss(ii) = xL1*SeTrial(3) + xL*SeTrial(4);
+        break;
+      case SECTION_RESPONSE_VZ:
+        Ss(ii) = oneOverL*(SeTrial(3)+SeTrial(4));
+        break;
+      case SECTION_RESPONSE_T:
+        Ss(ii) = SeTrial(5);
+        break;
+      default:
+        Ss(ii) = 0.0;
+        break;
+      }
+    }
+
+    if (numEleLoads > 0)
+      this->computeSectionForces(Ss, i);
+
+    // vs += fs * (Ss - Ssr), with the initial flexibility for the initial
+    // tangent iterations (scheme 1) and the first of scheme 2
+    if (initialFlag != 0) {
+      const bool initial = (scheme == 1) || (scheme == 2 && iter == 0);
+      const Matrix &fsi = initial ? sections[i]->getInitialFlexibility() : fsSubdivide[i];
+      const Vector &Ssr = SsrSubdivide[i];
+      Vector &vsi = vsSubdivide[i];
+      for (int ii = 0; ii < order; ii++) {
+        double dvs = 0.0;
+        for (int jj = 0; jj < order; jj++)
+          dvs += fsi(ii,jj)*(Ss(jj) - Ssr(jj));
+        vsi(ii) += dvs;
+      }
+    }
+
+    if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0)
+      return -1;
+
+    SsrSubdivide[i] = sections[i]->getStressResultant();
+    fsSubdivide[i] = sections[i]->getSectionFlexibility();
+    return 0;
+  };
+
+#ifdef N_SECTION_THREADS
+  static OpenSees::thread_pool pool{N_SECTION_THREADS};
+  std::atomic<int> res{0};
+  pool.submit_loop<int>(0, numSections, [&](int i) {
+    // materials may ask the pool thread for the element being updated
+    ops_TheActiveElement = this;
+    if (evaluate(i) < 0)
+      res = -1;
+  }).wait();
+  return res;
+#else
+  for (int i = 0; i < numSections; i++)
+    if (evaluate(i) < 0)
+      return -1;
+  return 0;
+#endif
+}
+
+
+void
+ForceBeamColumn3d::integrateSections(const double *xi, const double *wt, double L,
+                                     Matrix &f, Vector &vr)
+{
+  const double oneOverL = 1.0/L;
+
+  // the rows of b with nonzero entries, b(k,col[0..n-1]) = val[0..n-1];
+  // each response type appears at most once in a section
+  struct Row {
+    int k, n;
+    int col[2];
+    double val[2];
+  } rows[NEBD];
+
+  for (int i = 0; i < numSections; i++) {
+    const int order = sections[i]->getOrder();
+    const ID &code = sections[i]->getType();
+
+    const double xL  = xi[i];
+    const double xL1 = xL - 1.0;
+    const double wtL = wt[i]*L;
+
+    int numRows = 0;
+    for (int ii = 0; ii < order && numRows < NEBD; ii++) {
+      Row &r = rows[numRows];
+      r.k = ii;
+      switch(code(ii)) {
+      case SECTION_RESPONSE_P:
+        r.n = 1; r.col[0] = 0; r.val[0] = 1.0;
+        break;
+      case SECTION_RESPONSE_MZ:
+        r.n = 2; r.col[0] = 1; r.val[0] = xL1; r.col[1] = 2; r.val[1] = xL;
+        break;
+      case SECTION_RESPONSE_VY:
+        r.n = 2; r.col[0] = 1; r.val[0] = oneOverL; r.col[1] = 2; r.val[1] = oneOverL;
+        break;
+      case SECTION_RESPONSE_MY:
+        r.n = 2; r.col[0] = 3; r.val[0] = xL1; r.col[1] = 4; r.val[1] = xL;
+        break;
+      case SECTION_RESPONSE_VZ:
+        r.n = 2; r.col[0] = 3; r.val[0] = oneOverL; r.col[1] = 4; r.val[1] = oneOverL;
+        break;
+      case SECTION_RESPONSE_T:
+        r.n = 1; r.col[0] = 5; r.val[0] = 1.0;
+        break;
+      default:
+        continue;
+      }
+      numRows++;
+    }
+
+    const Matrix &fSec = fsSubdivide[i];
+    const Vector &Ss   = SsTrial[i];
+    const Vector &Ssr  = SsrSubdivide[i];
+    const Vector &vsi  = vsSubdivide[i];
+
+    for (int a = 0; a < numRows; a++) {
+      const Row &ra = rows[a];
+
+      // f += (b^ fs * b) * wtL
+      for (int c = 0; c < numRows; c++) {
+        const Row &rc = rows[c];
+        const double tmp = fSec(ra.k, rc.k)*wtL;
+        for (int p = 0; p < ra.n; p++)
+          for (int q = 0; q < rc.n; q++)
+            f(ra.col[p], rc.col[q]) += ra.val[p]*rc.val[q]*tmp;
+      }
+
+      // vr += (b^ (vs + fs * (Ss - Ssr))) * wtL
+      double dei = vsi(ra.k);
+      for (int jj = 0; jj < order; jj++)
+        dei += fSec(ra.k, jj)*(Ss(jj) - Ssr(jj));
+      dei *= wtL;
+      for (int p = 0; p < ra.n; p++)
+        vr(ra.col[p]) += ra.val[p]*dei;
+    }
+  }
+}
+
   void ForceBeamColumn3d::getForceInterpolatMatrix(double xi, Matrix &b, const ID &code)
   {
     b.Zero();
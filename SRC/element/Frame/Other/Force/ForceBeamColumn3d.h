@@ -149,6 +149,11 @@ class ForceBeamColumn3d: public Element
   // Section forces due to element loads
   void computeSectionForces(Vector &sp, int isec);
 
+  // Trial state of all the sections for the basic forces SeTrial, and the
+  // integration of their flexibility and residual deformations into f and vr
+  int  setSectionStates(int scheme, int iter, const Vector &SeTrial, const double *xi, double L);
+  void integrateSections(const double *xi, const double *wt, double L, Matrix &f, Vector &vr);
+
   // internal data
   ID     connectedExternalNodes; // tags of the end nodes
 
@@ -206,6 +211,7 @@ class ForceBeamColumn3d: public Element
   static Vector vsSubdivide[];
   static Vector SsrSubdivide[];
   static Matrix fsSubdivide[];
+  static Vector SsTrial[];       // section forces in equilibrium with the trial Se
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
   int parameterID;
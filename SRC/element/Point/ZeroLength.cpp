@@ -53,10 +53,6 @@ Matrix ZeroLength::ZeroLengthM2(2,2);
 Matrix ZeroLength::ZeroLengthM4(4,4);
 Matrix ZeroLength::ZeroLengthM6(6,6);
 Matrix ZeroLength::ZeroLengthM12(12,12);
-Vector ZeroLength::ZeroLengthV2(2);
-Vector ZeroLength::ZeroLengthV4(4);
-Vector ZeroLength::ZeroLengthV6(6);
-Vector ZeroLength::ZeroLengthV12(12);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLength)
 {
@@ -508,6 +504,14 @@ ZeroLength::getNumDOF(void)
     return numDOF;
 }
 
+// update() and getResistingForce() only touch the element's own
+// materials and force vector
+bool
+ZeroLength::isReentrant(void)
+{
+    return true;
+}
+
 
 // method: setDomain()
 //    to set a link to the enclosing Domain and to set the node pointers.
@@ -528,7 +532,8 @@ ZeroLength::setDomain(Domain *theDomain)
     // set default values for error conditions
     numDOF = 2;
     theMatrix = &ZeroLengthM2;
-    theVector = &ZeroLengthV2;
+    theForce.resize(2);
+    theVector = &theForce;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -582,31 +587,31 @@ ZeroLength::setDomain(Domain *theDomain)
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
 	theMatrix = &ZeroLengthM2;
-	theVector = &ZeroLengthV2;
+	theForce.resize(2);
 	elemType  = D1N2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
 	theMatrix = &ZeroLengthM4;
-	theVector = &ZeroLengthV4;
+	theForce.resize(4);
 	elemType  = D2N4;
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
 	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
+	theForce.resize(6);
 	elemType  = D2N6;
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
 	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
+	theForce.resize(6);
 	elemType  = D3N6;
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
 	theMatrix = &ZeroLengthM12;
-	theVector = &ZeroLengthV12;
+	theForce.resize(12);
 	elemType  = D3N12;
     }
     else {
@@ -116,6 +116,7 @@ class ZeroLength : public Element
 
     int getNumDOF(void);	
     void setDomain(Domain *theDomain);
+    bool isReentrant(void);
 
     // public methods to set the state of the element    
     int commitState(void);
@@ -181,6 +182,7 @@ class ZeroLength : public Element
 
     Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
     Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Vector theForce;        	// resisting force, owned so update is reentrant
 
     // Storage for uniaxial material models
     int numMaterials1d;			   // number of 1d materials
@@ -197,10 +199,6 @@ class ZeroLength : public Element
     static Matrix ZeroLengthM4;   // class wide matrix for 4*4
     static Matrix ZeroLengthM6;   // class wide matrix for 6*6
     static Matrix ZeroLengthM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthV2;   // class wide Vector for size 2
-    static Vector ZeroLengthV4;   // class wide Vector for size 4
-    static Vector ZeroLengthV6;   // class wide Vector for size 6
-    static Vector ZeroLengthV12;  // class wide Vector for size 12
 
     int mInitialize;  // tag to fix bug in recvSelf/setDomain when using database command
 };
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <CSRGraph.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <ID.h>
+#include <unordered_map>
+#include <algorithm>
+
+CSRGraph::CSRGraph(Graph &theGraph)
+{
+  const int numVertex = theGraph.getNumVertex();
+  tags.reserve(numVertex);
+  xadj.reserve(numVertex + 1);
+
+  Vertex *vertexPtr;
+  VertexIter &vertexIter = theGraph.getVertices();
+  while ((vertexPtr = vertexIter()) != nullptr)
+    tags.push_back(vertexPtr->getTag());
+
+  if (tags.empty()) {
+    xadj.push_back(0);
+    return;
+  }
+
+  // vertex tags are usually a dense range, in which case
+  // the index of a tag is found without hashing
+  const auto range = std::minmax_element(tags.begin(), tags.end());
+  const int  first = *range.first;
+  const long span  = (long)*range.second - first + 1;
+
+  std::vector<int> dense;
+  std::unordered_map<int,int> sparse;
+  if (span <= 2*(long)tags.size()) {
+    dense.assign(span, -1);
+    for (int i=0; i<(int)tags.size(); i++)
+      dense[tags[i] - first] = i;
+  } else {
+    sparse.reserve(tags.size());
+    for (int i=0; i<(int)tags.size(); i++)
+      sparse[tags[i]] = i;
+  }
+
+  adjncy.reserve(2*(std::size_t)theGraph.getNumEdge());
+  xadj.push_back(0);
+  for (int tag : tags) {
+    const ID &adjacency = theGraph.getVertexPtr(tag)->getAdjacency();
+    for (int j=0; j<adjacency.Size(); j++) {
+      const int other = adjacency(j);
+      int index = -1;
+      if (!dense.empty()) {
+        if (other >= first && other - first < span)
+          index = dense[other - first];
+      } else {
+        auto it = sparse.find(other);
+        if (it != sparse.end())
+          index = it->second;
+      }
+      if (index >= 0 && other != tag)
+        adjncy.push_back(index);
+    }
+    xadj.push_back((int)adjncy.size());
+  }
+}
+
+
+CSRGraph::Statistics
+CSRGraph::getStatistics(const std::vector<int> &order) const
+{
+  const int n = this->numVertex();
+  Statistics stats {0, 0, 0};
+
+  std::vector<int> position(n);
+  for (int k=0; k<n; k++)
+    position[order[k]] = k;
+
+  // bandwidth and envelope
+  for (int k=0; k<n; k++) {
+    const int v = order[k];
+    int first = k;
+    for (int e=xadj[v]; e<xadj[v+1]; e++)
+      first = std::min(first, position[adjncy[e]]);
+    stats.bandwidth = std::max(stats.bandwidth, k - first);
+    stats.profile  += k - first;
+  }
+
+  // nonzeros of L by traversing the row subtrees of the
+  // elimination tree, which is built along the way
+  std::vector<int> parent(n, -1), mark(n, -1);
+  for (int k=0; k<n; k++) {
+    const int v = order[k];
+    mark[k] = k;
+    stats.factorNonzeros++;
+    for (int e=xadj[v]; e<xadj[v+1]; e++) {
+      int j = position[adjncy[e]];
+      if (j > k)
+        continue;
+      while (mark[j] != k) {
+        mark[j] = k;
+        stats.factorNonzeros++;
+        if (parent[j] == -1)
+          parent[j] = k;
+        j = parent[j];
+      }
+    }
+  }
+
+  return stats;
+}
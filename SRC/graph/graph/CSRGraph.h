@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: CSRGraph is a compact, read-only copy of the adjacency of a
+// Graph in compressed sparse row form. Vertex i of the CSRGraph is the
+// vertex of the Graph with tag tags[i], and its neighbours are the indices
+// adjncy[xadj[i]], ..., adjncy[xadj[i+1]-1]. Numberers build one in a
+// single pass over the Graph and then work on plain integer arrays.
+//
+// Written: cmp
+//
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+#include <vector>
+
+class Graph;
+
+class CSRGraph
+{
+public:
+  explicit CSRGraph(Graph &theGraph);
+
+  int numVertex() const {return (int)tags.size();}
+  int degree(int i) const {return xadj[i+1] - xadj[i];}
+
+  // Properties of the symmetric matrix with this graph when its rows
+  // are eliminated in the given order (order[k] is the vertex numbered k)
+  struct Statistics {
+    int       bandwidth;      // maximum |k - l| over the edges
+    long long profile;        // entries in the lower envelope
+    long long factorNonzeros; // entries in the Cholesky factor L, diagonal included
+  };
+  Statistics getStatistics(const std::vector<int> &order) const;
+
+  std::vector<int> tags;
+  std::vector<int> xadj;
+  std::vector<int> adjncy;
+};
+
+#endif
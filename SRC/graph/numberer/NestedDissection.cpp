@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <vector>
+#include <NestedDissection.h>
+#include <Graph.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <Logging.h>
+#include <classTags.h>
+
+#ifdef _USE_METIS_5p1
+#  include <metis.h>
+#else
+extern "C"
+void METIS_NodeND(int *, int *, int *, int *, int *, int *, int *);
+#endif
+
+NestedDissection::NestedDissection(bool print)
+:GraphNumberer(GraphNUMBERER_TAG_NestedDissection),
+ printStatistics(print), statistics{0, 0, 0}
+{
+
+}
+
+NestedDissection::~NestedDissection()
+{
+
+}
+
+const ID &
+NestedDissection::number(Graph &theGraph, int lastVertex)
+{
+  CSRGraph graph(theGraph);
+  int numVertex = graph.numVertex();
+
+  theResult.resize(numVertex);
+  if (numVertex == 0)
+    return theResult;
+
+  std::vector<int> perm(numVertex), iperm(numVertex);
+
+  if (graph.adjncy.empty()) {
+    for (int i=0; i<numVertex; i++)
+      perm[i] = i;
+
+  } else {
+#ifdef _USE_METIS_5p1
+    idx_t options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(options);
+    options[METIS_OPTION_NUMBERING] = 0;
+    int status = METIS_NodeND(&numVertex, graph.xadj.data(), graph.adjncy.data(), nullptr,
+                              options, perm.data(), iperm.data());
+    if (status != METIS_OK) {
+      opserr << "WARNING NestedDissection::number - METIS_NodeND failed with flag " << status << "\n";
+      theResult.resize(0);
+      return theResult;
+    }
+#else
+    int numflag = 0;
+    int options[8] = {0};
+    METIS_NodeND(&numVertex, graph.xadj.data(), graph.adjncy.data(), &numflag,
+                 options, perm.data(), iperm.data());
+#endif
+  }
+
+  // perm[k] is the vertex eliminated k-th; a vertex that must be numbered
+  // last is moved to the end keeping the order of the others
+  int count = 0;
+  for (int k=0; k<numVertex; k++)
+    if (graph.tags[perm[k]] != lastVertex)
+      theResult(count++) = graph.tags[perm[k]];
+  if (count < numVertex)
+    theResult(count) = lastVertex;
+
+  if (printStatistics) {
+    statistics = graph.getStatistics(perm);
+    opserr << "NestedDissection: " << numVertex << " vertices, bandwidth " << statistics.bandwidth
+           << ", profile " << (double)statistics.profile 
+           << ", nonzeros in factor " << (double)statistics.factorNonzeros << "\n";
+  }
+
+  return theResult;
+}
+
+
+const ID &
+NestedDissection::number(Graph &theGraph, const ID &lastVertices)
+{
+  this->number(theGraph);
+
+  // move the last vertices to the end keeping the relative order
+  ID ordered(theResult.Size());
+  int count = 0;
+  for (int i=0; i<theResult.Size(); i++)
+    if (lastVertices.getLocation(theResult(i)) < 0)
+      ordered(count++) = theResult(i);
+  for (int i=0; i<theResult.Size(); i++)
+    if (lastVertices.getLocation(theResult(i)) >= 0)
+      ordered(count++) = theResult(i);
+
+  theResult = ordered;
+  return theResult;
+}
+
+
+const CSRGraph::Statistics &
+NestedDissection::getStatistics() const
+{
+  return statistics;
+}
+
+
+int
+NestedDissection::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+NestedDissection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: NestedDissection is a GraphNumberer which orders the
+// vertices with the multilevel nested dissection of METIS (METIS_NodeND).
+// The ordering is fill-reducing, and is intended for sparse direct solvers
+// rather than for profile or band storage.
+//
+// Written: cmp
+//
+#ifndef NestedDissection_h
+#define NestedDissection_h
+
+#include <GraphNumberer.h>
+#include <CSRGraph.h>
+#include <ID.h>
+
+class NestedDissection: public GraphNumberer
+{
+  public:
+    NestedDissection(bool printStatistics = false);
+    ~NestedDissection();
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+
+    const CSRGraph::Statistics &getStatistics() const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+  private:
+    ID   theResult;
+    bool printStatistics;     // compute and print statistics of each ordering
+    CSRGraph::Statistics statistics;
+};
+
+#endif
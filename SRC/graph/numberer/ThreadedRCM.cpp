@@ -0,0 +1,275 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <ThreadedRCM.h>
+#include <Graph.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <Logging.h>
+#include <classTags.h>
+#include <threads/thread_pool.hpp>
+
+namespace {
+
+// levels touching fewer edges than this are expanded serially
+constexpr long minParallelEdges = 4096;
+
+//
+// Level sets of a breadth first search stored in order[], with
+// position[v] the index of v in order[] or -1 if it has not been reached.
+//
+struct LevelSearch {
+  const CSRGraph &graph;
+  OpenSees::thread_pool *threads;
+  int numThreads;
+
+  std::vector<int> order;
+  std::vector<int> position;
+  std::unique_ptr<std::atomic<int>[]> claim; // first parent of a vertex
+  std::vector<int> offset;
+
+  LevelSearch(const CSRGraph &g, OpenSees::thread_pool *pool, int nt)
+  : graph(g), threads(pool), numThreads(nt),
+    order(g.numVertex()), position(g.numVertex(), -1),
+    claim(new std::atomic<int>[g.numVertex()])
+  {
+    for (int i=0; i<g.numVertex(); i++)
+      claim[i].store(INT_MAX, std::memory_order_relaxed);
+  }
+
+  // vertices of a level are in order of their first parent,
+  // and those with the same parent are sorted by degree
+  void sortChildren(int begin, int end) {
+    std::sort(order.begin()+begin, order.begin()+end, [this](int a, int b) {
+      const int da = graph.degree(a), db = graph.degree(b);
+      return da < db || (da == db && a < b);
+    });
+    for (int i=begin; i<end; i++)
+      position[order[i]] = i;
+  }
+
+  template <class F> void
+  forEach(int begin, int end, F &&f) {
+    threads->submit_blocks<int>(begin, end, [&f](int b, int e) {
+      for (int p=b; p<e; p++)
+        f(p);
+    }, numThreads).wait();
+  }
+
+  // append the next level of the level [begin, end) at end and
+  // return the end of the new level
+  int expand(int begin, int end) {
+    long numEdges = 0;
+    for (int p=begin; p<end; p++)
+      numEdges += graph.degree(order[p]);
+
+    if (threads == nullptr || numEdges < minParallelEdges) {
+      int tail = end;
+      for (int p=begin; p<end; p++) {
+        const int v = order[p], first = tail;
+        for (int e=graph.xadj[v]; e<graph.xadj[v+1]; e++) {
+          const int u = graph.adjncy[e];
+          if (position[u] == -1) {
+            position[u] = tail;
+            order[tail++] = u;
+          }
+        }
+        this->sortChildren(first, tail);
+      }
+      return tail;
+    }
+
+    // each unvisited neighbour is claimed by its first parent
+    this->forEach(begin, end, [this](int p) {
+      const int v = order[p];
+      for (int e=graph.xadj[v]; e<graph.xadj[v+1]; e++) {
+        const int u = graph.adjncy[e];
+        if (position[u] != -1)
+          continue;
+        int current = claim[u].load(std::memory_order_relaxed);
+        while (p < current && !claim[u].compare_exchange_weak(current, p, std::memory_order_relaxed))
+          ;
+      }
+    });
+
+    // count the children of each parent and find where they go
+    offset.assign(end - begin + 1, 0);
+    this->forEach(begin, end, [this, begin](int p) {
+      const int v = order[p];
+      int count = 0;
+      for (int e=graph.xadj[v]; e<graph.xadj[v+1]; e++)
+        if (claim[graph.adjncy[e]].load(std::memory_order_relaxed) == p)
+          count++;
+      offset[p - begin + 1] = count;
+    });
+    offset[0] = end;
+    for (int i=1; i<(int)offset.size(); i++)
+      offset[i] += offset[i-1];
+
+    this->forEach(begin, end, [this, begin](int p) {
+      const int v = order[p];
+      int tail = offset[p - begin];
+      for (int e=graph.xadj[v]; e<graph.xadj[v+1]; e++) {
+        const int u = graph.adjncy[e];
+        if (claim[u].load(std::memory_order_relaxed) == p)
+          order[tail++] = u;
+      }
+      this->sortChildren(offset[p - begin], tail);
+    });
+
+    return offset.back();
+  }
+
+  // rooted level structure from root placed at start; returns its end
+  // and the bounds of the last level
+  int levels(int root, int start, int &lastBegin, int &lastEnd, int &depth) {
+    order[start]   = root;
+    position[root] = start;
+    int begin = start, end = start + 1;
+    depth = 0;
+    for (int next; (next = this->expand(begin, end)) != end; depth++) {
+      begin = end;
+      end   = next;
+    }
+    lastBegin = begin;
+    lastEnd   = end;
+    return end;
+  }
+
+  void clear(int begin, int end) {
+    for (int i=begin; i<end; i++) {
+      position[order[i]] = -1;
+      claim[order[i]].store(INT_MAX, std::memory_order_relaxed);
+    }
+  }
+};
+
+} // namespace
+
+
+ThreadedRCM::ThreadedRCM(int nt, bool print)
+:GraphNumberer(GraphNUMBERER_TAG_ThreadedRCM),
+ numThreads(nt > 0 ? nt : 1), printStatistics(print), statistics{0, 0, 0},
+ threads(nullptr)
+{
+  if (numThreads > 1)
+    threads = new OpenSees::thread_pool{static_cast<OpenSees::concurrency_t>(numThreads)};
+}
+
+ThreadedRCM::~ThreadedRCM()
+{
+  if (threads != nullptr)
+    delete threads;
+}
+
+const ID &
+ThreadedRCM::number(Graph &theGraph, int lastVertex)
+{
+  CSRGraph graph(theGraph);
+  const int numVertex = graph.numVertex();
+
+  theResult.resize(numVertex);
+  if (numVertex == 0)
+    return theResult;
+
+  LevelSearch search(graph, threads, numThreads);
+
+  int start = 0;
+  for (int seed = 0; seed < numVertex; seed++) {
+    if (search.position[seed] != -1)
+      continue;
+
+    // find a pseudo-peripheral vertex of the component of seed
+    int root = seed, depth, lastBegin, lastEnd;
+    int end = search.levels(root, start, lastBegin, lastEnd, depth);
+    while (true) {
+      int candidate = search.order[lastBegin];
+      for (int i=lastBegin+1; i<lastEnd; i++)
+        if (graph.degree(search.order[i]) < graph.degree(candidate))
+          candidate = search.order[i];
+
+      search.clear(start, end);
+      int candidateDepth;
+      end = search.levels(candidate, start, lastBegin, lastEnd, candidateDepth);
+      if (candidateDepth <= depth) {
+        search.clear(start, end);
+        break;
+      }
+      root  = candidate;
+      depth = candidateDepth;
+    }
+
+    // Cuthill-McKee numbering of the component
+    start = search.levels(root, start, lastBegin, lastEnd, depth);
+  }
+
+  // reverse the ordering; a vertex to be numbered last is moved to the end
+  std::vector<int> &order = search.order;
+  std::reverse(order.begin(), order.end());
+
+  int count = 0;
+  for (int k=0; k<numVertex; k++)
+    if (graph.tags[order[k]] != lastVertex)
+      theResult(count++) = graph.tags[order[k]];
+  if (count < numVertex)
+    theResult(count) = lastVertex;
+
+  if (printStatistics) {
+    statistics = graph.getStatistics(order);
+    opserr << "ThreadedRCM: " << numVertex << " vertices, bandwidth " << statistics.bandwidth
+           << ", profile " << (double)statistics.profile
+           << ", nonzeros in factor " << (double)statistics.factorNonzeros << "\n";
+  }
+
+  return theResult;
+}
+
+
+const ID &
+ThreadedRCM::number(Graph &theGraph, const ID &lastVertices)
+{
+  this->number(theGraph);
+
+  // move the last vertices to the end keeping the relative order
+  ID ordered(theResult.Size());
+  int count = 0;
+  for (int i=0; i<theResult.Size(); i++)
+    if (lastVertices.getLocation(theResult(i)) < 0)
+      ordered(count++) = theResult(i);
+  for (int i=0; i<theResult.Size(); i++)
+    if (lastVertices.getLocation(theResult(i)) >= 0)
+      ordered(count++) = theResult(i);
+
+  theResult = ordered;
+  return theResult;
+}
+
+
+const CSRGraph::Statistics &
+ThreadedRCM::getStatistics() const
+{
+  return statistics;
+}
+
+
+int
+ThreadedRCM::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+ThreadedRCM::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: ThreadedRCM is a GraphNumberer which performs a reverse
+// Cuthill-McKee ordering on a CSRGraph. Each connected component is
+// started from a pseudo-peripheral vertex (George & Liu), and the level
+// sets are built level-synchronously: the vertices of a new level are
+// claimed by their first parent in the current level and sorted by degree,
+// which gives the same ordering as the serial algorithm for any number of
+// threads. Wide levels are expanded by a pool of threads.
+//
+// Written: cmp
+//
+#ifndef ThreadedRCM_h
+#define ThreadedRCM_h
+
+#include <GraphNumberer.h>
+#include <CSRGraph.h>
+#include <ID.h>
+
+namespace OpenSees {
+  class thread_pool;
+}
+
+class ThreadedRCM: public GraphNumberer
+{
+  public:
+    ThreadedRCM(int numThreads = 1, bool printStatistics = false);
+    ~ThreadedRCM();
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+
+    const CSRGraph::Statistics &getStatistics() const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+  private:
+    ID   theResult;
+    int  numThreads;
+    bool printStatistics;     // compute and print statistics of each ordering
+    CSRGraph::Statistics statistics;
+    OpenSees::thread_pool *threads;
+};
+
+#endif
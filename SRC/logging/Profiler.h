@@ -0,0 +1,195 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Profiler accumulates the time spent in, and the number of
+// calls to, each phase of an analysis step: forming the tangent and the
+// unbalance, solving the system of equations, testing for convergence,
+// updating and committing the domain and recording. When element timing is
+// switched on it also accumulates the time spent updating each element and
+// forming its tangent and residual, by element class.
+//
+// The timers are compiled in everywhere but cost one test of a flag when
+// the profiler is off, which it is by default. They are placed only in
+// loops that run on the main thread; the totals are not synchronized.
+//
+// The totals are reported by the "profile" command.
+//
+// Written: cmp
+//
+#ifndef OpenSees_Profiler_h
+#define OpenSees_Profiler_h
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+namespace OpenSees {
+
+class Profiler
+{
+  public:
+    enum Phase {
+      FormTangent,
+      FormUnbalance,
+      Solve,
+      Test,
+      DomainUpdate,
+      DomainCommit,
+      Record,
+      NumPhases
+    };
+
+    enum Task {
+      ElementUpdate,
+      ElementTangent,
+      ElementResidual,
+      NumTasks
+    };
+
+    using clock = std::chrono::steady_clock;
+
+    // value-initialized, so zero
+    struct Counter {
+      long   calls;
+      double seconds;
+    };
+
+    struct ElementClass {
+      std::string name;
+      Counter tasks[NumTasks];
+    };
+
+    static bool isOn()             {return on;}
+    static bool isTimingElements() {return on && elements;}
+
+    static void start(bool timeElements) {
+      if (!on)
+        started = clock::now();
+      on = true;
+      elements = timeElements;
+    }
+
+    static void stop() {
+      if (on)
+        elapsed += std::chrono::duration<double>(clock::now() - started).count();
+      on = false;
+    }
+
+    static void reset() {
+      for (Counter &counter : phases)
+        counter = Counter();
+      classes.clear();
+      elapsed = 0.0;
+      started = clock::now();
+    }
+
+    static void add(Phase phase, clock::duration time) {
+      phases[phase].calls++;
+      phases[phase].seconds += std::chrono::duration<double>(time).count();
+    }
+
+    static void addElement(int classTag, const char *className, Task task, clock::duration time) {
+      ElementClass &entry = classes[classTag];
+      if (entry.name.empty())
+        entry.name = className;
+      entry.tasks[task].calls++;
+      entry.tasks[task].seconds += std::chrono::duration<double>(time).count();
+    }
+
+    // seconds since the profiler was reset, counting only while it was on
+    static double getElapsed() {
+      return on ? elapsed + std::chrono::duration<double>(clock::now() - started).count()
+                : elapsed;
+    }
+
+    static const Counter &getPhase(Phase phase) {return phases[phase];}
+    static const std::unordered_map<int, ElementClass> &getElementClasses() {return classes;}
+
+    static const char *getName(Phase phase) {
+      static const char *const names[NumPhases] = {
+        "formTangent", "formUnbalance", "solve", "test",
+        "domainUpdate", "domainCommit", "record"
+      };
+      return names[phase];
+    }
+
+    static const char *getName(Task task) {
+      static const char *const names[NumTasks] = {"update", "tangent", "residual"};
+      return names[task];
+    }
+
+  private:
+    static inline bool on       = false;
+    static inline bool elements = false;
+    static inline double elapsed = 0.0;
+    static inline clock::time_point started;
+    static inline Counter phases[NumPhases];
+    static inline std::unordered_map<int, ElementClass> classes;
+};
+
+
+//
+// adds the time from its construction to its destruction to a phase
+//
+class ProfileScope
+{
+  public:
+    explicit ProfileScope(Profiler::Phase p)
+      : phase(p), active(Profiler::isOn())
+    {
+      if (active)
+        start = Profiler::clock::now();
+    }
+
+    ~ProfileScope() {
+      if (active)
+        Profiler::add(phase, Profiler::clock::now() - start);
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+  private:
+    Profiler::Phase phase;
+    bool active;
+    Profiler::clock::time_point start;
+};
+
+
+//
+// adds the time from its construction to its destruction to a task of
+// the class of an element; the class name is only looked up when timing
+//
+template <class T>
+class ProfileElementScope
+{
+  public:
+    ProfileElementScope(Profiler::Task t, const T &e)
+      : task(t), element(e), active(Profiler::isTimingElements())
+    {
+      if (active)
+        start = Profiler::clock::now();
+    }
+
+    ~ProfileElementScope() {
+      if (active)
+        Profiler::addElement(element.getClassTag(), element.getClassType(), task,
+                             Profiler::clock::now() - start);
+    }
+
+    ProfileElementScope(const ProfileElementScope &) = delete;
+    ProfileElementScope &operator=(const ProfileElementScope &) = delete;
+
+  private:
+    Profiler::Task task;
+    const T &element;
+    bool active;
+    Profiler::clock::time_point start;
+};
+
+} // namespace OpenSees
+
+#endif
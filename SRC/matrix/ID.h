@@ -76,6 +76,7 @@ class ID
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class SharedMemoryChannel;
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
@@ -38,15 +38,32 @@
 
 #include <math.h>
 #include <assert.h>
+#include <vector>
+#include <utility>
 
-#ifndef NO_STATIC_WORK
-# define MATRIX_WORK_AREA 400
-# define INT_WORK_AREA 20
-  int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-  int Matrix::sizeIntWork = INT_WORK_AREA;
-  double *Matrix::matrixWork = nullptr;
-  int    *Matrix::intWork    = nullptr;
-#endif
+//
+// Work areas for the LAPACK calls in Solve() and Invert(). They are
+// shared by all matrices of a thread and only grow, so that repeated
+// solves of the same size do not allocate.
+//
+namespace {
+struct MatrixWorkArea {
+  std::vector<double> doubles;
+  std::vector<int>    ints;
+
+  double *getDoubles(int n) {
+    if (static_cast<int>(doubles.size()) < n)
+      doubles.resize(n);
+    return doubles.data();
+  }
+  int *getInts(int n) {
+    if (static_cast<int>(ints.size()) < n)
+      ints.resize(n);
+    return ints.data();
+  }
+};
+thread_local MatrixWorkArea theWorkArea;
+}
 
 //#define MATRIX_BLAS
 //#define NO_WORK
@@ -59,11 +76,6 @@
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
 }
 
 
@@ -73,12 +85,6 @@ Matrix::Matrix(int nRows,int nCols)
 //assert(nRows > 0);
 //assert(nCols > 0);
 
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
   dataSize = numRows * numCols;
   data = nullptr;
 
@@ -92,24 +98,12 @@ Matrix::Matrix(double *theData, int row, int col)
 //assert(row > 0);
 //assert(col > 0);
 
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
 }
 
 
 Matrix::Matrix(const Matrix &other)
 : numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
   numRows  = other.numRows;
   numCols  = other.numCols;
   dataSize = other.dataSize;
@@ -136,7 +130,6 @@ Matrix::Matrix(Matrix &&other)
   other.dataSize = 0;
   other.data     = nullptr;
   other.fromFree = 1;
-  throw std::runtime_error("error");
 }
 #endif
 
@@ -152,13 +145,6 @@ Matrix::~Matrix()
       data = nullptr;
     }
   }
-#ifdef NO_STATIC_WORK
-  if (matrixWork != nullptr)
-    delete [] matrixWork;
-
-  if (intWork != nullptr)
-    delete [] intWork;
-#endif
 }
     
 
@@ -257,26 +243,8 @@ Matrix::Solve(const Vector &b, Vector &x)
     assert(numRows == x.Size());
     assert(numRows == b.Size());
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != nullptr) {
-        delete [] matrixWork;
-        matrixWork = nullptr;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = nullptr;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;  
-    }
+    double *matrixWork = theWorkArea.getDoubles(dataSize);
+    int    *intWork    = theWorkArea.getInts(n);
  
     // copy the data
     for (int i=0; i<dataSize; i++)
@@ -306,30 +274,8 @@ Matrix::Solve(const Vector &b, Vector &x) const
     assert(numRows == x.Size());
     assert(numRows == b.Size());
 
-#if defined(NO_STATIC_WORK)
-    /* static */ double *matrixWork = nullptr;
-    /* static */ int *intWork = nullptr;
-    /* static */ int sizeDoubleWork = 0;
-    /* static */ int sizeIntWork    = 0;
-#endif
-
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != nullptr) {
-        delete [] matrixWork;
-        matrixWork = nullptr;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-    if (n > sizeIntWork) {
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = nullptr;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;  
-    }
+    double *matrixWork = theWorkArea.getDoubles(dataSize);
+    int    *intWork    = theWorkArea.getInts(n);
  
     // copy the data
     int i;
@@ -349,9 +295,6 @@ Matrix::Solve(const Vector &b, Vector &x) const
 
     DGESV(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
 
-    delete [] intWork;
-    delete [] matrixWork;
-
     return -abs(info);
 }
 
@@ -367,23 +310,8 @@ Matrix::Solve(const Matrix &b, Matrix &x) // const
     assert(n == b.numRows);
     assert(x.numCols == b.numCols);
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != 0) {
-        delete [] matrixWork;
-        matrixWork = 0;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-    if (n > sizeIntWork) {
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = 0;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;
-    }
+    double *matrixWork = theWorkArea.getDoubles(dataSize);
+    int    *intWork    = theWorkArea.getInts(n);
 
     // copy the data
     int i;
@@ -459,35 +387,14 @@ Matrix::Invert()
 
     default:
   
-      // check work area can hold all the data
-      if (dataSize > sizeDoubleWork) {
-        if (matrixWork != nullptr) {
-          delete [] matrixWork;
-          matrixWork = 0;
-        }
-        matrixWork = new double[dataSize];
-        sizeDoubleWork = dataSize;
-      }
+      double *matrixWork = theWorkArea.getDoubles(dataSize);
+      int    *intWork    = theWorkArea.getInts(n);
 
-      // check work area can hold all the data
-      if (n > sizeIntWork) {
-        if (intWork != 0) {
-          delete [] intWork;
-          intWork = nullptr;
-        }
-        intWork = new int[n];
-        sizeIntWork = n;  
-      }
-#if 0
-      // copy the data 
-      for (int i=0; i<dataSize; i++)
-        matrixWork[i] = data[i];
-#endif
       // theInverse = *this;
       int ldA = n;
       double *Wptr = matrixWork;
       double *Aptr = data;
-      int workSize = sizeDoubleWork;
+      int workSize = dataSize;
       
       int *iPIV = intWork;
 
@@ -837,12 +744,8 @@ Matrix::addMatrixTripleProduct(double thisFact,
   int dimB = B.numCols;
   int sizeWork = dimB * numCols;
 
-  if (sizeWork > sizeDoubleWork) {
-    // TODO
-    this->addMatrix(thisFact, T^B*T, otherFact);
-    return 0;
-  }
-  else {
+  double *matrixWork = theWorkArea.getDoubles(sizeWork);
+  {
     int m = B.numRows,
         n = T.numCols,
         k = B.numCols;
@@ -942,16 +845,16 @@ Matrix::addMatrixTripleProduct(double thisFact,
     if (thisFact == 1.0 && otherFact == 0.0)
       return 0;
 
-    // check work area can hold the temporary matrix
-    int sizeWork = B.numRows * numCols;
-#ifndef NO_WORK
-    if (sizeWork > sizeDoubleWork) {
-#endif
+    // the loops below assume B is square
+    if (B.numRows != B.numCols) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
-#ifndef NO_WORK
     }
 
+    // get a work area to hold the temporary matrix
+    int sizeWork = B.numRows * numCols;
+    double *matrixWork = theWorkArea.getDoubles(sizeWork);
+
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
     for (int l=0; l<sizeWork; l++)
@@ -1020,7 +923,6 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 
     return 0;
-#endif
 }
 
 
@@ -1547,6 +1449,75 @@ Matrix operator*(double a, const Matrix &V)
   return V * a;
 }
 
+//
+// Arithmetic on temporaries; the storage of an rvalue operand is
+// reused for the result unless it is a view of other data.
+//
+Matrix operator+(Matrix &&A, const Matrix &B)
+{
+  if (A.fromFree != 0)
+    return static_cast<const Matrix &>(A) + B;
+  A += B;
+  return std::move(A);
+}
+
+Matrix operator+(const Matrix &A, Matrix &&B)
+{
+  if (B.fromFree != 0)
+    return A + static_cast<const Matrix &>(B);
+  B += A;
+  return std::move(B);
+}
+
+Matrix operator+(Matrix &&A, Matrix &&B)
+{
+  return std::move(A) + static_cast<const Matrix &>(B);
+}
+
+Matrix operator-(Matrix &&A, const Matrix &B)
+{
+  if (A.fromFree != 0)
+    return static_cast<const Matrix &>(A) - B;
+  A -= B;
+  return std::move(A);
+}
+
+Matrix operator-(const Matrix &A, Matrix &&B)
+{
+  if (B.fromFree != 0)
+    return A - static_cast<const Matrix &>(B);
+  assert(A.numRows == B.numRows && A.numCols == B.numCols);
+  for (int i=0; i<B.dataSize; i++)
+    B.data[i] = A.data[i] - B.data[i];
+  return std::move(B);
+}
+
+Matrix operator-(Matrix &&A, Matrix &&B)
+{
+  return std::move(A) - static_cast<const Matrix &>(B);
+}
+
+Matrix operator*(Matrix &&A, double fact)
+{
+  if (A.fromFree != 0)
+    return static_cast<const Matrix &>(A) * fact;
+  A *= fact;
+  return std::move(A);
+}
+
+Matrix operator*(double fact, Matrix &&A)
+{
+  return std::move(A) * fact;
+}
+
+Matrix operator/(Matrix &&A, double fact)
+{
+  if (A.fromFree != 0)
+    return static_cast<const Matrix &>(A) / fact;
+  A /= fact;
+  return std::move(A);
+}
+
 Vector Matrix::diagonal() const
 {
   
@@ -29,7 +29,6 @@
 //
 #ifndef Matrix_h
 #define Matrix_h 
-#define NO_STATIC_WORK
 #include <assert.h>
 #include <cstddef>
 using std::size_t;
@@ -178,6 +177,18 @@ class Matrix
     friend OPS_Stream &operator<<(OPS_Stream &s, const Matrix &M);
     //    friend istream &operator>>(istream &s, Matrix &M);    
     friend Matrix operator*(double a, const Matrix &M);
+
+    // operations on temporaries reuse their storage,
+    // so a chain such as A + B*c - D allocates once
+    friend Matrix operator+(Matrix &&A, const Matrix &B);
+    friend Matrix operator+(const Matrix &A, Matrix &&B);
+    friend Matrix operator+(Matrix &&A, Matrix &&B);
+    friend Matrix operator-(Matrix &&A, const Matrix &B);
+    friend Matrix operator-(const Matrix &A, Matrix &&B);
+    friend Matrix operator-(Matrix &&A, Matrix &&B);
+    friend Matrix operator*(Matrix &&A, double fact);
+    friend Matrix operator*(double fact, Matrix &&A);
+    friend Matrix operator/(Matrix &&A, double fact);
     
     
     friend class Vector;
@@ -187,6 +198,7 @@ class Matrix
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class SharedMemoryChannel;
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
@@ -195,17 +207,6 @@ class Matrix
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-#ifdef NO_STATIC_WORK
-    double *matrixWork = nullptr;
-    int *intWork = nullptr;
-    int sizeDoubleWork = 400;
-    int sizeIntWork = 20;
-#else
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
-#endif
 
     int numRows;
     int numCols;
@@ -32,6 +32,7 @@
 #include <math.h>
 #include <assert.h>
 #include "blasdecl.h"
+#include <utility>
 
 #if 0
 #define VECTOR_BLAS
@@ -1073,6 +1074,92 @@ Vector operator*(double a, const Vector &V)
   return V * a;
 }
 
+//
+// Arithmetic on temporaries; the storage of an rvalue operand is
+// reused for the result unless it is a view of other data.
+//
+Vector operator+(Vector &&a, const Vector &b)
+{
+  if (a.fromFree != 0)
+    return static_cast<const Vector &>(a) + b;
+  a += b;
+  return std::move(a);
+}
+
+Vector operator+(const Vector &a, Vector &&b)
+{
+  if (b.fromFree != 0)
+    return a + static_cast<const Vector &>(b);
+  b += a;
+  return std::move(b);
+}
+
+Vector operator+(Vector &&a, Vector &&b)
+{
+  return std::move(a) + static_cast<const Vector &>(b);
+}
+
+Vector operator-(Vector &&a, const Vector &b)
+{
+  if (a.fromFree != 0)
+    return static_cast<const Vector &>(a) - b;
+  a -= b;
+  return std::move(a);
+}
+
+Vector operator-(const Vector &a, Vector &&b)
+{
+  if (b.fromFree != 0)
+    return a - static_cast<const Vector &>(b);
+  assert(a.sz == b.sz);
+  for (int i=0; i<b.sz; i++)
+    b.theData[i] = a.theData[i] - b.theData[i];
+  return std::move(b);
+}
+
+Vector operator-(Vector &&a, Vector &&b)
+{
+  return std::move(a) - static_cast<const Vector &>(b);
+}
+
+Vector operator+(Vector &&a, double fact)
+{
+  if (a.fromFree != 0)
+    return static_cast<const Vector &>(a) + fact;
+  a += fact;
+  return std::move(a);
+}
+
+Vector operator-(Vector &&a, double fact)
+{
+  if (a.fromFree != 0)
+    return static_cast<const Vector &>(a) - fact;
+  a -= fact;
+  return std::move(a);
+}
+
+Vector operator*(Vector &&a, double fact)
+{
+  if (a.fromFree != 0)
+    return static_cast<const Vector &>(a) * fact;
+  a *= fact;
+  return std::move(a);
+}
+
+Vector operator*(double fact, Vector &&a)
+{
+  return std::move(a) * fact;
+}
+
+Vector operator/(Vector &&a, double fact)
+{
+  if (a.fromFree != 0)
+    return static_cast<const Vector &>(a) / fact;
+  assert(fact != 0.0);
+  a /= fact;
+  return std::move(a);
+}
+
 
 int
 Vector::Assemble(const Vector &V, int init_pos, double fact) 
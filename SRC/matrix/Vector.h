@@ -134,9 +134,24 @@ class Vector
     friend OPS_Stream &operator<<(OPS_Stream &s, const Vector &V);
     // friend istream &operator>>(istream &s, Vector &V);    
     friend Vector operator*(double a, const Vector &V);
+
+    // operations on temporaries reuse their storage,
+    // so a chain such as a + b*c - d allocates once
+    friend Vector operator+(Vector &&a, const Vector &b);
+    friend Vector operator+(const Vector &a, Vector &&b);
+    friend Vector operator+(Vector &&a, Vector &&b);
+    friend Vector operator-(Vector &&a, const Vector &b);
+    friend Vector operator-(const Vector &a, Vector &&b);
+    friend Vector operator-(Vector &&a, Vector &&b);
+    friend Vector operator+(Vector &&a, double fact);
+    friend Vector operator-(Vector &&a, double fact);
+    friend Vector operator*(Vector &&a, double fact);
+    friend Vector operator*(double fact, Vector &&a);
+    friend Vector operator/(Vector &&a, double fact);
     
     friend class Message;
     friend class SystemOfEqn;
+    friend class LinearSOE;
     friend class Matrix;
 //  template<int n> friend struct OpenSees::VectorND;
     template<int n, typename> friend struct OpenSees::VectorND;
@@ -145,6 +160,7 @@ class Vector
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;    
+    friend class SharedMemoryChannel;
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
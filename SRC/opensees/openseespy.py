@@ -678,6 +678,8 @@ __all__ = [
     "solveCPU",
     "accelCPU",
     "numFact",
+    "numFactSaved",
+    "numResidualEval",
     "numIter",
     "systemSize",
     "version",
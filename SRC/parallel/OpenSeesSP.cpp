@@ -17,11 +17,15 @@ extern "C" {
 }
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "G3_Runtime.h"
 
 #include <PartitionedDomain.h>
 #include <MPI_MachineBroker.h>
+#ifndef _WIN32
+#  include <SharedMemoryMachineBroker.h>
+#endif
 #include <ShadowSubdomain.h>
 #include <ActorSubdomain.h>
 #include <TclPackageClassBroker.h>
@@ -60,7 +64,19 @@ Libopenseessp_Init(Tcl_Interp* interp)
   int argc = 0; 
   char **argv = nullptr;
 
-  MachineBroker* theMachineBroker = new MPI_MachineBroker(0, argc, argv);
+  // OPENSEES_SHARED_MEMORY=np runs np processes on this host that
+  // communicate through shared memory rather than MPI. Only pid 0 runs
+  // the interpreter and the others only run actors, so all traffic goes
+  // through the channels of the broker; solvers that call MPI themselves
+  // check that it was started.
+  MachineBroker* theMachineBroker = nullptr;
+#ifndef _WIN32
+  const char *numShared = getenv("OPENSEES_SHARED_MEMORY");
+  if (numShared != nullptr && atoi(numShared) > 1)
+    theMachineBroker = new SharedMemoryMachineBroker(0, atoi(numShared));
+  else
+#endif
+    theMachineBroker = new MPI_MachineBroker(0, argc, argv);
   FEM_ObjectBroker* theBroker = new TclPackageClassBroker();
   theMachineBroker->setObjectBroker(theBroker);
 
@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <vector>
+#include <algorithm>
+#include <CostBalancer.h>
+#include <DomainPartitioner.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Logging.h>
+
+
+CostBalancer::CostBalancer(int p, double tol, int max)
+  :LoadBalancer(), period(p > 0 ? p : 1), tolerance(tol), maxMoves(max), numCommits(0)
+{
+
+}
+
+
+CostBalancer::~CostBalancer()
+{
+
+}
+
+
+int
+CostBalancer::balance(Graph &theWeightedGraph)
+{
+  if (++numCommits < period)
+    return 0;
+  numCommits = 0;
+
+  DomainPartitioner *thePartitioner = this->getDomainPartitioner();
+  if (thePartitioner == 0) {
+    opserr << "CostBalancer::balance() - no DomainPartitioner has been set\n";
+    return -1;
+  }
+
+  Vector load(0);
+  if (thePartitioner->measureElementCosts(load) < 0)
+    return -1;
+
+  int numPartitions = thePartitioner->getNumPartitions();
+  if (numPartitions < 2)
+    return 0;
+
+  double total = 0.0;
+  int heaviest = 1;
+  for (int i=1; i<=numPartitions; i++) {
+    total += load(i);
+    if (load(i) > load(heaviest))
+      heaviest = i;
+  }
+  if (total <= 0.0)
+    return 0;
+
+  const double limit = (1.0 + tolerance)*total/numPartitions;
+  if (load(heaviest) <= limit)
+    return 0;
+
+  Graph &theElements = thePartitioner->getColoredGraph();
+
+  // the boundary of the heaviest partition advances as its elements are
+  // moved, so the candidates are collected again after every pass
+  int numMoved = 0;
+  bool moved = true;
+  while (moved == true && load(heaviest) > limit) {
+    moved = false;
+
+    std::vector<Vertex *> candidates;
+    VertexIter &theVertices = theElements.getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0) {
+      if (vertexPtr->getColor() != heaviest || vertexPtr->getWeight() <= 0.0)
+        continue;
+      const ID &adjacency = vertexPtr->getAdjacency();
+      for (int i=0; i<adjacency.Size(); i++)
+        if (theElements.getVertexPtr(adjacency(i))->getColor() != heaviest) {
+          candidates.push_back(vertexPtr);
+          break;
+        }
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](Vertex *a, Vertex *b) {return a->getWeight() > b->getWeight();});
+
+    for (Vertex *candidate : candidates) {
+      if (maxMoves > 0 && numMoved >= maxMoves)
+        break;
+      if (candidate->getColor() != heaviest)
+        continue;
+
+      // the lightest partition the element is next to
+      int to = 0;
+      const ID &adjacency = candidate->getAdjacency();
+      for (int i=0; i<adjacency.Size(); i++) {
+        int color = theElements.getVertexPtr(adjacency(i))->getColor();
+        if (color != heaviest && (to == 0 || load(color) < load(to)))
+          to = color;
+      }
+
+      // moving the element must not make to the heavier of the two
+      double cost = candidate->getWeight();
+      if (to == 0 || load(to) + cost >= load(heaviest) - cost)
+        continue;
+
+      if (thePartitioner->swapVertex(heaviest, to, candidate->getTag(), false) != 0)
+        continue;
+
+      load(heaviest) -= cost;
+      load(to) += cost;
+      numMoved++;
+      moved = true;
+
+      if (load(heaviest) <= limit)
+        break;
+    }
+
+    if (maxMoves > 0 && numMoved >= maxMoves)
+      break;
+  }
+
+  if (numMoved > 0)
+    opserr << "CostBalancer::balance() - moved " << numMoved << " elements from partition "
+           << heaviest << ", its share of the measured cost is now "
+           << load(heaviest)/total << endln;
+
+  return numMoved;
+}
@@ -0,0 +1,38 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file contains the class definition for CostBalancer.
+// A CostBalancer is a LoadBalancer that moves elements between partitions
+// based on the time they are measured to take. Every period commits it
+// asks the DomainPartitioner for the cost of each element since the last
+// check; if the heaviest partition exceeds the mean by more than the
+// tolerance, elements on its boundary are moved, heaviest first, to the
+// lightest neighbouring partition until the excess is removed, the moves
+// would overshoot, or maxMoves elements have been moved.
+//
+// Written: cmp
+//
+#ifndef CostBalancer_h
+#define CostBalancer_h
+
+#include <LoadBalancer.h>
+
+class CostBalancer: public LoadBalancer
+{
+  public:
+    CostBalancer(int period = 10, double tolerance = 0.1, int maxMoves = 0);
+    ~CostBalancer();
+
+    int balance(Graph &theWeightedGraph);
+
+  private:
+    int period;
+    double tolerance;
+    int maxMoves;                // 0 means no limit
+    int numCommits;
+};
+
+#endif
@@ -43,13 +43,19 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <MatrixOperations.h>
+#include <SamplingStatistics.h>
 
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
 using std::ifstream;
 using std::ios;
 using std::setw;
@@ -57,6 +63,47 @@ using std::setprecision;
 using std::setiosflags;
 
 
+//
+// The coefficient of variation of the estimate of the mean of each
+// quantity. With randomized quasi-random samples it comes from the spread
+// of the estimates of the randomizations, which are independent where the
+// samples of one randomization are not; it is zero until each has one.
+//
+static void
+getCovOfEstimate(const SamplingStatistics &statistics,
+		 const std::vector<SamplingStatistics> &replicates, Vector &cov)
+{
+	int numQuantities = cov.Size();
+	int numReplicates = (int)replicates.size();
+
+	if (numReplicates <= 1) {
+		for (int i = 0; i < numQuantities; i++)
+			cov(i) = statistics.getCovOfMean(i);
+		return;
+	}
+
+	SamplingStatistics spread(numQuantities);
+	std::vector<double> mean(numQuantities);
+	for (const SamplingStatistics &replicate : replicates) {
+		if (replicate.getCount() == 0) {
+			cov.Zero();
+			return;
+		}
+		for (int i = 0; i < numQuantities; i++)
+			mean[i] = replicate.getMean(i);
+		spread.add(mean.data());
+	}
+
+	for (int i = 0; i < numQuantities; i++) {
+		double estimate = statistics.getMean(i);
+		if (estimate == 0.0)
+			cov(i) = 0.0;
+		else
+			cov(i) = sqrt(spread.getVariance(i)/numReplicates)/fabs(estimate);
+	}
+}
+
+
 ImportanceSamplingAnalysis::ImportanceSamplingAnalysis(ReliabilityDomain *passedReliabilityDomain,
                                                        Domain *passedOpenSeesDomain,
 										ProbabilityTransformation *passedProbabilityTransformation,
@@ -80,6 +127,7 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+	shareSamples = false;
 }
 
 
@@ -92,6 +140,104 @@ ImportanceSamplingAnalysis::~ImportanceSamplingAnalysis()
 
 
 
+//
+// Evaluates the limit-state functions at a sample and stores, for each, the
+// indicator of failure weighted by the ratio of the densities when the
+// probability of failure is estimated, and the value of the function
+// otherwise.
+//
+int
+ImportanceSamplingAnalysis::evaluateSample(long sample, const Vector &startPointY, double *q)
+{
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	// Create array of standard normal random numbers; a counter-based
+	// generator draws the numbers of this sample wherever it is evaluated
+	theRandomNumberGenerator->setSample(sample-1);
+	if (theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV) < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
+			<< " random numbers for simulation." << endln;
+		return -1;
+	}
+	const Vector &randomArray = theRandomNumberGenerator->getGeneratedNumbers();
+
+	// Compute the point in standard normal space
+	//u = startPointY + chol_covariance * randomArray;
+	Vector u(startPointY);
+	u.addVector(1.0, randomArray, samplingStdv);
+
+	// Transform into original space
+	Vector x(numRV);
+	if (theProbabilityTransformation->transform_u_to_x(u, x) < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
+		return -1;
+	}
+
+	// update domain with new x values
+	for (int j = 0; j < numRV; j++) {
+		int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+		Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+		theParam->update( x(j) );
+	}
+
+	// set values in the variable namespace
+	if (theGFunEvaluator->setVariables() < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
+			<< " could not set variables in namespace. " << endln;
+		return -1;
+	}
+
+	// Evaluate limit-state function
+	bool FEconvergence = true;
+	if (theGFunEvaluator -> runAnalysis() < 0) {
+		// In this case a failure happened during the analysis
+		// Hence, register this as failure
+		opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
+		FEconvergence = false;
+	}
+
+	// Ratio of the values of the joint distributions at the u-point
+	double weight = 0.0;
+	if (analysisTypeTag == 1) {
+		static const double twopi = 2.0*acos(-1.0);
+		double factor1 = 1.0 / ( pow(twopi,0.5*numRV));
+		double factor2 = factor1 / sqrt(pow(samplingStdv, numRV));
+
+		double temp2 = 0.0;
+		for (int i = 0; i < numRV; i++) {
+			double uy = u(i)-startPointY(i);
+			temp2 += uy*uy;
+		}
+		temp2 /= samplingStdv*samplingStdv;
+		double phi = factor1 * exp( -0.5 * (u ^ u) );
+		double h   = factor2 * exp( -0.5 * temp2 );
+		weight = phi / h;
+	}
+
+	for (int lsf = 0; lsf < numLsf; lsf++ ) {
+		LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+
+		// Set tag of "active" limit-state function
+		theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
+
+		// set and evaluate LSF
+		theGFunEvaluator->setExpression(theLimitStateFunction->getExpression());
+		double gFunctionValue = theGFunEvaluator->evaluateExpression();
+		if (!FEconvergence) {
+			gFunctionValue = -1.0;
+		}
+
+		if (analysisTypeTag == 1)
+			q[lsf] = gFunctionValue < 0.0 ? weight : 0.0;
+		else
+			q[lsf] = gFunctionValue;
+	}
+
+	return 0;
+}
+
+
 int 
 ImportanceSamplingAnalysis::analyze(void)
 {
@@ -99,67 +245,68 @@ ImportanceSamplingAnalysis::analyze(void)
 	// Alert the user that the simulation analysis has started
 	opserr << "ImportanceSampling Analysis is running ... " << endln;
 
+	if (analysisTypeTag < 1 || analysisTypeTag > 3) {
+		opserr << "ERROR: Invalid analysis type tag found in sampling analysis." << endln;
+		return -1;
+	}
+
 	// Declaration of some of the data used in the algorithm
-	double gFunctionValue;
-	int result, I, seed = 1;
-    long int k = 1;
-	double det_covariance, phi, h, q;
+	int result, seed = 1;
+	long int k = 1;
 	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
-    int numParam = theOpenSeesDomain->getNumParameters();
 	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
-    
+
 	Vector x(numRV);
-	Vector z(numRV);
-	Vector u(numRV);
-	Vector randomArray(numRV);
 	static NormalRV aStdNormRV(1,0.0,1.0);
-	bool failureHasOccured = false;
-
-	det_covariance = pow(samplingStdv, numRV);
-
-
-	// Pre-compute some factors to minimize computations inside simulation loop
-	static const double twopi = 2.0*acos(-1.0);
-	double factor1 = 1.0 / ( pow(twopi,0.5*numRV));
-	//double factor2 = 1.0 / ( pow(twopi,0.5*numRV) * sqrt(det_covariance) );
-	double factor2 = factor1 / sqrt(det_covariance);
 
+	// The processes sharing the samples, each with its own copy of the model
+	int rank = 0, numProcesses = 1;
+	if (shareSamples) {
+#ifdef _PARALLEL_INTERPRETERS
+		MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+		MPI_Comm_size(MPI_COMM_WORLD, &numProcesses);
+#else
+		opserr << "WARNING: samples are only shared by the parallel interpreters" << endln;
+#endif
+	}
+	if (numProcesses > 1 && theRandomNumberGenerator->setSample(0) < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - the samples can only be shared" << endln
+			<< " between processes with a counter-based random number generator." << endln;
+		return -1;
+	}
 
-	Vector sum_q(numLsf);
-	Vector sum_q_squared(numLsf);
-	double var_qbar;
-	double pfIn;
-	double CovIn;
+	// With a quasi-random generator the samples cycle through its
+	// randomizations, and statistics are kept for each as well
+	int numReplicates = theRandomNumberGenerator->getNumReplicates();
+	SamplingStatistics statistics(numLsf);
+	std::vector<SamplingStatistics> replicates(numReplicates, statistics);
 	char restartFileName[256];
 	sprintf(restartFileName,"%s_%s","restart",fileName);
-    
 
-	if (analysisTypeTag == 1) {
-		// Possible read data from file if this is a restart simulation
-		if (printFlag == 2) {
-			ifstream inputFile( restartFileName, ios::in );
-			inputFile >> k;
-			inputFile >> seed;
-			if (k == 1 && seed == 1) {
+
+	// Possible read data from file if this is a restart simulation
+	if (analysisTypeTag == 1 && printFlag == 2) {
+		ifstream inputFile( restartFileName, ios::in );
+		long int kIn;
+		int seedIn;
+		if (numReplicates > 1) {
+			opserr << "WARNING: A sampling analysis with quasi-random numbers is not restarted" << endln;
+		}
+		else if (inputFile >> kIn >> seedIn && !(kIn == 1 && seedIn == 1)) {
+			Vector pfIn(numLsf);
+			Vector CovIn(numLsf);
+			for (int i=0; i<numLsf; i++) {
+				inputFile >> pfIn(i);
+				inputFile >> CovIn(i);
 			}
-			else { 
-				for (int i=1; i<=numLsf; i++) {
-					inputFile >> pfIn;
-					if (pfIn > 0.0) {
-						failureHasOccured = true;
-					}
-					inputFile >> CovIn;
-					sum_q(i-1) = pfIn*k;
-					var_qbar = (CovIn*pfIn)*(CovIn*pfIn);
-					if (k < 1.0e-6) {
-						opserr << "WARNING: Zero number of samples read from restart file" << endln;
-					}
-					sum_q_squared(i-1) = k*( k*var_qbar + pow(sum_q(i-1)/k,2.0) );
-				}
-				k++;
+			if (kIn < 1) {
+				opserr << "WARNING: Zero number of samples read from restart file" << endln;
 			}
-			inputFile.close();
+			statistics.setState(kIn, pfIn, CovIn);
+			k = kIn + 1;
+			seed = seedIn;
 		}
+		inputFile.close();
 	}
 
     
@@ -193,289 +340,166 @@ ImportanceSamplingAnalysis::analyze(void)
 	// Initial declarations
 	Vector cov_of_q_bar(numLsf);
 	Vector q_bar(numLsf);
-	Vector variance_of_q_bar(numLsf);
-	Vector responseVariance(numLsf);
+	Vector covOfEstimate(numLsf);
 	Vector responseStdv(numLsf);
-	Vector g_storage(numLsf);
-	Vector sum_of_g_minus_mean_squared(numLsf);
-	Matrix crossSums(numLsf,numLsf);
 	Matrix responseCorrelation(numLsf,numLsf);
 	char myString[60];
-	Vector pf(numLsf);
-	Vector cov(numLsf);
 	double govCov = 999.0;
-	//Vector temp1;
-	double temp2, denumerator;
-	bool FEconvergence;
 
 
-	// Prepare output file
-	ofstream resultsOutputFile( fileName, ios::out );
+	// Prepare output file; only the first process writes
+	ofstream resultsOutputFile;
+	if (rank == 0) {
+		resultsOutputFile.open( fileName, ios::out );
+	}
+
 
+	// When the samples are shared they are evaluated in blocks of
+	// samplesPerBlock, and in each round every process evaluates one block.
+	// The samples are added to the statistics in order, with the target
+	// coefficient of variation checked after each, so the estimates and the
+	// sample at which the analysis stops are the same for any number of
+	// processes; the rest of the round is discarded. Otherwise the blocks
+	// hold a single sample, as they are evaluated.
+	const long int lastSample = numberOfSimulations > 2 ? numberOfSimulations : 2;
+	const int sampleBlock = numProcesses > 1 ? samplesPerBlock : 1;
+	const int blockSize = 1 + sampleBlock*numLsf;
+	std::vector<double> myBlock(blockSize);
+	std::vector<double> blocks((std::size_t)blockSize*numProcesses);
 
 	bool isFirstSimulation = true;
-	while( ( k <= numberOfSimulations && govCov > targetCOV || k <= 2 ) ) {
+	bool done = false;
+	long int firstOfRound = k;
+	while (!done) {
 
-		// Keep the user posted
-		if (printFlag == 1 || printFlag == 2) {
-            sprintf(myString,"%li",k);
-			opserr << "Sample #" << myString << ":" << endln;
-		}
-
-		
-		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
-		}
-		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-		}
-		seed = theRandomNumberGenerator->getSeed();
-		if (result < 0) {
-			opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
-				<< " random numbers for simulation." << endln;
-			return -1;
-		}
-		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
-
-		// Compute the point in standard normal space
-		//u = startPointY + chol_covariance * randomArray;
-        u = startPointY;
-		u.addVector(1.0, randomArray, samplingStdv);
-
-		// Transform into original space
-		result = theProbabilityTransformation->transform_u_to_x(u, x);
-		if (result < 0) {
-		  opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
-		  return -1;
-		}
-        
-        // update domain with new x values
-        for (int j = 0; j < numRV; j++) {
-            RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
-            int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
-            Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
-            
-            // now we should update the parameter value
-            theParam->update( x(j) );
-        }
-		
-        
-        // set values in the variable namespace
-        if (theGFunEvaluator->setVariables() < 0) {
-            opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
-                << " could not set variables in namespace. " << endln;
-            return -1;
-        }
-        
-		// Evaluate limit-state function
-		FEconvergence = true;
-		if (theGFunEvaluator -> runAnalysis() < 0) {
-			// In this case a failure happened during the analysis
-			// Hence, register this as failure
-            opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
-			FEconvergence = false;
-		}
+		// Evaluate the block of this process; the first entry flags an error
+		long int first = firstOfRound + (long int)rank*sampleBlock;
+		long int last = std::min(first + sampleBlock - 1, lastSample);
 
+		myBlock[0] = 0.0;
+		for (long int s = first; s <= last; s++) {
 
-		LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
-		LimitStateFunction *theLimitStateFunction;
-		// Loop over number of limit-state functions
-		for (int lsf = 0; lsf < numLsf; lsf++ ) {
-		//while ((theLimitStateFunction = lsfIter()) != 0) {
-            theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
-            int lsfTag = theLimitStateFunction->getTag();
+			// Keep the user posted
+			if (printFlag == 1 || printFlag == 2) {
+				sprintf(myString,"%li",s);
+				opserr << "Sample #" << myString << ":" << endln;
+			}
 
-			// Set tag of "active" limit-state function
-			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
+			if (isFirstSimulation) {
+				theRandomNumberGenerator->setSeed(seed);
+				isFirstSimulation = false;
+			}
 
-            // set and evaluate LSF
-            const char *lsfExpression = theLimitStateFunction->getExpression();
-            theGFunEvaluator->setExpression(lsfExpression);
-            
-            gFunctionValue = theGFunEvaluator->evaluateExpression();
-            if (!FEconvergence) {
-				gFunctionValue = -1.0;
+			if (this->evaluateSample(s, startPointY, &myBlock[1 + (s-first)*numLsf]) < 0) {
+				myBlock[0] = -1.0;
+				break;
 			}
+		}
+		seed = theRandomNumberGenerator->getSeed();
 
-			
-			// ESTIMATION OF FAILURE PROBABILITY
-			if (analysisTypeTag == 1) {
+#ifdef _PARALLEL_INTERPRETERS
+		if (numProcesses > 1)
+			MPI_Allgather(myBlock.data(), blockSize, MPI_DOUBLE,
+				      blocks.data(), blockSize, MPI_DOUBLE, MPI_COMM_WORLD);
+		else
+#endif
+			std::copy(myBlock.begin(), myBlock.end(), blocks.begin());
+
+		// Add the samples in order
+		for (int b = 0; b < numProcesses && !done; b++) {
+			const double *block = &blocks[(std::size_t)b*blockSize];
+			if (block[0] < 0.0) {
+				return -1;
+			}
 
-				// Collect result of sampling
-				if (gFunctionValue < 0.0) {
-					I = 1;
-					failureHasOccured = true;
+			first = firstOfRound + (long int)b*sampleBlock;
+			last = std::min(first + sampleBlock - 1, lastSample);
+
+			for (long int s = first; s <= last && !done; s++) {
+				const double *q = block + 1 + (s-first)*numLsf;
+				k = s;
+				if (analysisTypeTag == 3) {
+					// Store g-function values to file (one in each column)
+					for (int lsf = 0; lsf < numLsf; lsf++)
+						resultsOutputFile << setiosflags(ios::scientific) << setprecision(6) << q[lsf] << "  ";
+					resultsOutputFile << endln;
 				}
 				else {
-					I = 0;
+					statistics.add(q);
+					if (numReplicates > 1)
+						replicates[(s-1) % numReplicates].add(q);
 				}
-
-
-				// Compute values of joint distributions at the u-point
-				phi = factor1 * exp( -0.5 * (u ^ u) );
-				//temp1 = inv_covariance ^ (u-startPointY);
-				//temp2 = temp1 ^ (u-startPointY);
-				temp2 = 0.0;
-				for (int i = 0; i < numRV; i++) {
-				  double uy = u(i)-startPointY(i);
-				  temp2 += uy*uy;
+				getCovOfEstimate(statistics, replicates, covOfEstimate);
+
+				// Compute governing coefficient of variation; it is left at 999
+				// until a failure has occurred, and if only failures occur in
+				// cases where the 'q' remains 1
+				govCov = 0.0;
+				for (int lsf = 0; lsf < numLsf; lsf++) {
+					if (covOfEstimate(lsf) > govCov) {
+						govCov = covOfEstimate(lsf);
+					}
 				}
-				temp2 /= samplingStdv*samplingStdv;
-				h   = factor2 * exp( -0.5 * temp2 );
-
-
-				// Update sums
-				q = I * phi / h;
-				sum_q(lsf) = sum_q(lsf) + q;
-				sum_q_squared(lsf) = sum_q_squared(lsf) + q*q;
-
-
-
-				if (sum_q(lsf) > 0.0) {
-					// Compute coefficient of variation (of pf)
-					q_bar(lsf) = sum_q(lsf)/k;
-					variance_of_q_bar(lsf) = ( sum_q_squared(lsf)/k - (sum_q(lsf)/k)*(sum_q(lsf)/k)) / k;
-					if (variance_of_q_bar(lsf) < 0.0)
-						variance_of_q_bar(lsf) = 0.0;
-					cov_of_q_bar(lsf) = sqrt(variance_of_q_bar(lsf)) / q_bar(lsf);
+				if (govCov == 0.0) {
+					govCov = 999.0;
 				}
 
-			}
-			else if (analysisTypeTag == 2) {
-			// ESTIMATION OF RESPONSE STATISTICS
-
-				// Now q=g and q_bar=mean
-				q = gFunctionValue; 
-				failureHasOccured = true;
-				
-				sum_q(lsf) = sum_q(lsf) + q;
-				sum_q_squared(lsf) = sum_q_squared(lsf) + q*q;
-
-				g_storage(lsf) = gFunctionValue;
-				
-                // KRM 2/12/2012, note there is something not right with response statistics
-                // when the mean is less than 0.  
-				if (sum_q(lsf) > 0.0) {
-					
-					// Compute coefficient of variation (of mean)
-					//q_bar(lsf) = 1.0/(double)k * sum_q(lsf);
-					q_bar(lsf) = sum_q(lsf)/k;
-					//variance_of_q_bar(lsf) = 1.0/(double)k * 
-					//	( 1.0/(double)k * sum_q_squared(lsf) - (sum_q(lsf)/(double)k)*(sum_q(lsf)/(double)k));
-					variance_of_q_bar(lsf) = ( sum_q_squared(lsf)/k - (sum_q(lsf)/k)*(sum_q(lsf)/k) ) / k;
-					if (variance_of_q_bar(lsf) < 0.0) {
-						variance_of_q_bar(lsf) = 0.0;
+				// Keep the user posted
+				if ( (printFlag == 1 || printFlag == 2) && analysisTypeTag != 3 && rank == 0) {
+					for (int lsf = 0; lsf < numLsf; lsf++) {
+						int lsfTag = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf)->getTag();
+						sprintf(myString," GFun #%d, estimate:%15.10f, cov:%15.10f",lsfTag,
+							statistics.getMean(lsf),covOfEstimate(lsf));
+						opserr << myString << endln;
 					}
-					cov_of_q_bar(lsf) = sqrt(variance_of_q_bar(lsf)) / q_bar(lsf);
-
-					// Compute variance and standard deviation
-					if (k > 1)
-					  //responseVariance(lsf) = 1.0/((double)k-1) * (  sum_q_squared(lsf) - 1.0/((double)k) * sum_q(lsf) * sum_q(lsf)  );
-					  responseVariance(lsf) = (  sum_q_squared(lsf) - sum_q(lsf)/k * sum_q(lsf) ) / (k-1);
-					else
-						responseVariance(lsf) = 1.0;
-
-					if (responseVariance(lsf) <= 0.0) {
-						opserr << "ERROR: Response variance of limit-state function number "<< lsf
-							<< " is zero! " << endln;
-					}
-					else {
-						responseStdv(lsf) = sqrt(responseVariance(lsf));
+				}
+
+				// Print to the restart file, if requested. 
+				if (printFlag == 2 && rank == 0) {
+					ofstream outputFile( restartFileName, ios::out );
+					outputFile << k << endln;
+					outputFile << seed << endln;
+					for (int lsf=0; lsf<numLsf; lsf++ ) {
+						sprintf(myString,"%15.10f  %15.10f",statistics.getMean(lsf),covOfEstimate(lsf));
+						outputFile << myString << " " << endln;
 					}
+					outputFile.close();
 				}
-			}
-			else if (analysisTypeTag == 3) {
-				// Store g-function values to file (one in each column)
-				//sprintf(myString,"%12.6e",gFunctionValue);
-				resultsOutputFile << setiosflags(ios::scientific) << setprecision(6) << gFunctionValue << "  ";
-				resultsOutputFile.flush();
-			}
-			else {
-				opserr << "ERROR: Invalid analysis type tag found in sampling analysis." << endln;
-			}
 
-			// Keep the user posted
-			if ( (printFlag == 1 || printFlag == 2) && analysisTypeTag != 3) {
-				sprintf(myString," GFun #%d, estimate:%15.10f, cov:%15.10f",lsfTag,q_bar(lsf),cov_of_q_bar(lsf));
-				opserr << myString << endln;
+				if (k >= lastSample || (govCov <= targetCOV && k >= 2)) {
+					done = true;
+				}
 			}
 		}
 
-		// Now all the limit-state functions have been looped over
+		firstOfRound += (long int)numProcesses*sampleBlock;
+	}
+	opserr << endln;
 
 
-		if (analysisTypeTag == 3) {
-			resultsOutputFile << endln;
+	// Collect the estimates
+	bool failureHasOccured = (analysisTypeTag == 2);
+	for (int i = 0; i < numLsf; i++) {
+		q_bar(i) = statistics.getMean(i);
+		cov_of_q_bar(i) = covOfEstimate(i);
+		if (q_bar(i) > 0.0) {
+			failureHasOccured = true;
 		}
 
-
-		// Possibly compute correlation coefficient
 		if (analysisTypeTag == 2) {
-
-			for (int i=0; i<numLsf; i++) {
-				for (int j=i+1; j<numLsf; j++) {
-
-				  //crossSums(i,j) = crossSums(i,j) + g_storage(i) * g_storage(j);
-				  crossSums(i,j) = g_storage(i) * g_storage(j);
-
-				  //denumerator = 	(sum_q_squared(i)-1.0/(double)k*sum_q(i)*sum_q(i))
-				  //*(sum_q_squared(j)-1.0/(double)k*sum_q(j)*sum_q(j));
-				  denumerator = 	(sum_q_squared(i)-sum_q(i)/k*sum_q(i))*(sum_q_squared(j)-sum_q(j)/k*sum_q(j));
-
-					if (denumerator <= 0.0)
-						responseCorrelation(i,j) = 0.0;
-					else
-						responseCorrelation(i,j) = (crossSums(i,j)-sum_q(i)/k*sum_q(j)) / sqrt(denumerator);
-				}
+			if (statistics.getVariance(i) <= 0.0) {
+				opserr << "ERROR: Response variance of limit-state function number "<< i
+					<< " is zero! " << endln;
 			}
-		}
-
-		
-		// Compute governing coefficient of variation
-		if (!failureHasOccured) {
-			govCov = 999.0;
-		}
-		else {
-			govCov = 0.0;
-			for (int mmmm=0; mmmm<numLsf; mmmm++) {
-				if (cov_of_q_bar(mmmm) > govCov) {
-					govCov = cov_of_q_bar(mmmm);
-				}
+			else {
+				responseStdv(i) = sqrt(statistics.getVariance(i));
 			}
-		}
-
-		
-		// Make sure the cov isn't exactly zero; that could be the case if only failures
-		// occur in cases where the 'q' remains 1
-		if (govCov == 0.0) {
-			govCov = 999.0;
-		}
-
-
-		// Print to the restart file, if requested. 
-		if (printFlag == 2) {
-			ofstream outputFile( restartFileName, ios::out );
-			outputFile << k << endln;
-			outputFile << seed << endln;
-			for (int lsf=0; lsf<numLsf; lsf++ ) {
-				sprintf(myString,"%15.10f  %15.10f",q_bar(lsf),cov_of_q_bar(lsf));
-				outputFile << myString << " " << endln;
+			for (int j = i+1; j < numLsf; j++) {
+				responseCorrelation(i,j) = statistics.getCorrelation(i,j);
 			}
-			outputFile.close();
 		}
-
-		// Increment k (the simulation number counter)
-		k++;
-		isFirstSimulation = false;
-
 	}
 
-	// Step 'k' back a step now that we went out
-	k--;
-	opserr << endln;
-
-
 	if (analysisTypeTag != 3) {
 
 		if (!failureHasOccured) {
@@ -544,6 +568,14 @@ ImportanceSamplingAnalysis::analyze(void)
 					resultsOutputFile << "#  Coefficient of variation (of pf): .................. " 
 						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<cov_sim 
 						<< "  #" << endln;
+					resultsOutputFile << "#  Variance of the estimate of pf: .................... " 
+						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<(cov_sim*pf_sim)*(cov_sim*pf_sim) 
+						<< "  #" << endln;
+					if (numReplicates > 1) {
+						resultsOutputFile << "#  Randomizations of the quasi-random sequence: ....... " 
+							<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<numReplicates 
+							<< "  #" << endln;
+					}
 					resultsOutputFile << "#                                                                     #" << endln;
 					resultsOutputFile << "#######################################################################" << endln << endln << endln;
 				}
@@ -558,6 +590,9 @@ ImportanceSamplingAnalysis::analyze(void)
 					resultsOutputFile << "#  Estimated standard deviation: ...................... " 
 						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<responseStdv(lsf) 
 						<< "  #" << endln;
+					resultsOutputFile << "#  Coefficient of variation (of mean): ................ " 
+						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<cov_of_q_bar(lsf) 
+						<< "  #" << endln;
 					resultsOutputFile << "#                                                                     #" << endln;
 					resultsOutputFile << "#######################################################################" << endln << endln << endln;
 				}
@@ -65,9 +65,20 @@ public:
 	
 	int analyze(void);
 
+	// Share the samples between the processes of a parallel interpreter,
+	// each of which must run the analysis with its own copy of the model
+	// and a counter-based random number generator. Off by default, in
+	// which case every process runs an independent analysis.
+	void setSampleSharing(bool share) {shareSamples = share;}
+
 protected:
 	
 private:
+	int evaluateSample(long sample, const Vector &startPointY, double *q);
+
+	// samples evaluated by a process at a time when they are shared
+	static const int samplesPerBlock = 16;
+
 	ReliabilityDomain *theReliabilityDomain;
     Domain *theOpenSeesDomain;
 	ProbabilityTransformation *theProbabilityTransformation;
@@ -80,6 +91,7 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+	bool shareSamples;
 };
 
 #endif
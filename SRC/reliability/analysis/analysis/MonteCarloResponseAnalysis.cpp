@@ -144,12 +144,12 @@ int MonteCarloResponseAnalysis::analyze(){
 
 		
 		// Create array of standard normal random numbers
+		// a counter-based generator resumes a restart at the same sample
 		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
-		}
-		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+			theRandomNumberGenerator->setSeed(seed);
 		}
+		theRandomNumberGenerator->setSample(kk);
+		result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
 		seed = theRandomNumberGenerator->getSeed();
 		if (result < 0) {
 			opserr << "MonteCarloResponseAnalysis::analyze() - could not generate" << endln
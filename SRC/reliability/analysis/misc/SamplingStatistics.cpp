@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of SamplingStatistics.
+//
+// Written: cmp
+//
+#include <SamplingStatistics.h>
+#include <math.h>
+
+
+SamplingStatistics::SamplingStatistics(int n)
+:numQuantities(n), count(0), mean(n), comoment(n,n), delta(n)
+{
+
+}
+
+
+void
+SamplingStatistics::zero()
+{
+  count = 0;
+  mean.Zero();
+  comoment.Zero();
+}
+
+
+void
+SamplingStatistics::add(const double *q)
+{
+  count++;
+  for (int i=0; i<numQuantities; i++)
+    delta(i) = q[i] - mean(i);
+
+  const double factor = (double)(count-1)/count;
+  for (int i=0; i<numQuantities; i++) {
+    for (int j=0; j<numQuantities; j++)
+      comoment(i,j) += factor*delta(i)*delta(j);
+    mean(i) += delta(i)/count;
+  }
+}
+
+
+void
+SamplingStatistics::merge(const SamplingStatistics &other)
+{
+  if (other.count == 0)
+    return;
+  if (count == 0) {
+    count = other.count;
+    mean = other.mean;
+    comoment = other.comoment;
+    return;
+  }
+
+  const long total = count + other.count;
+  const double factor = (double)count*other.count/total;
+  for (int i=0; i<numQuantities; i++)
+    delta(i) = other.mean(i) - mean(i);
+
+  for (int i=0; i<numQuantities; i++) {
+    for (int j=0; j<numQuantities; j++)
+      comoment(i,j) += other.comoment(i,j) + factor*delta(i)*delta(j);
+    mean(i) += delta(i)*other.count/total;
+  }
+  count = total;
+}
+
+
+void
+SamplingStatistics::setState(long n, const Vector &m, const Vector &covOfMean)
+{
+  this->zero();
+  count = n;
+  for (int i=0; i<numQuantities; i++) {
+    mean(i) = m(i);
+    const double stdvOfMean = covOfMean(i)*fabs(m(i));
+    comoment(i,i) = stdvOfMean*stdvOfMean*n*n;
+  }
+}
+
+
+long
+SamplingStatistics::getCount() const
+{
+  return count;
+}
+
+
+double
+SamplingStatistics::getMean(int i) const
+{
+  return mean(i);
+}
+
+
+double
+SamplingStatistics::getVariance(int i) const
+{
+  return count > 1 ? comoment(i,i)/(count-1) : 0.0;
+}
+
+
+double
+SamplingStatistics::getVarianceOfMean(int i) const
+{
+  return count > 0 ? comoment(i,i)/count/count : 0.0;
+}
+
+
+double
+SamplingStatistics::getCovOfMean(int i) const
+{
+  if (mean(i) == 0.0)
+    return 0.0;
+  return sqrt(this->getVarianceOfMean(i))/fabs(mean(i));
+}
+
+
+double
+SamplingStatistics::getCorrelation(int i, int j) const
+{
+  const double denominator = comoment(i,i)*comoment(j,j);
+  if (denominator <= 0.0)
+    return 0.0;
+  return comoment(i,j)/sqrt(denominator);
+}
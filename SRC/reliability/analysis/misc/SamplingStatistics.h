@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SamplingStatistics accumulates the number of samples, the
+// means and the sums of products of deviations from the means of a set of
+// sampled quantities. Samples are added one at a time with the updates of
+// Welford, and two sets of statistics are merged with the updates of Chan,
+// Golub and LeVeque, so statistics gathered from separate groups of
+// samples can be combined without keeping the samples.
+//
+// Merging is exact in exact arithmetic but not in floating point, so the
+// result depends on how the samples were grouped. A driver that wants the
+// same numbers whatever the number of workers groups the samples the same
+// way and merges the groups in the same order.
+//
+// Written: cmp
+//
+#ifndef SamplingStatistics_h
+#define SamplingStatistics_h
+
+#include <Vector.h>
+#include <Matrix.h>
+
+class SamplingStatistics
+{
+  public:
+    SamplingStatistics(int numQuantities);
+
+    void zero();
+    void add(const double *q);
+    void merge(const SamplingStatistics &other);
+
+    // statistics of count samples with the given means and coefficients
+    // of variation of the means, as written to a restart file
+    void setState(long count, const Vector &mean, const Vector &covOfMean);
+
+    long   getCount() const;
+    double getMean(int i) const;
+    double getVariance(int i) const;         // sample variance
+    double getVarianceOfMean(int i) const;
+    double getCovOfMean(int i) const;
+    double getCorrelation(int i, int j) const;
+
+  private:
+    int  numQuantities;
+    long count;
+    Vector mean;
+    Matrix comoment;            // sums of products of deviations
+    Vector delta;
+};
+
+#endif
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// HaltonSequenceGenerator.
+//
+// Written: cmp
+//
+#include <HaltonSequenceGenerator.h>
+#include <PhiloxRandGenerator.h>
+
+
+HaltonSequenceGenerator::HaltonSequenceGenerator(int numReplicates, int passedSeed)
+:QuasiRandomGenerator(numReplicates, passedSeed)
+{
+
+}
+
+
+int
+HaltonSequenceGenerator::fillPoint(long point, int replicate, int n, double *u)
+{
+  // extend the list of primes to one per coordinate
+  for (int candidate = primes.empty() ? 2 : primes.back()+1; (int)primes.size() < n; candidate++) {
+    bool isPrime = true;
+    for (int p : primes) {
+      if (p*p > candidate)
+        break;
+      if (candidate % p == 0) {
+        isPrime = false;
+        break;
+      }
+    }
+    if (isPrime)
+      primes.push_back(candidate);
+  }
+
+  shift.resize(n);
+  PhiloxRandGenerator(seed).fillUniformNumbers(replicate, n, shift.data());
+
+  // the first point of the sequence, at the origin, is skipped
+  for (int j=0; j<n; j++) {
+    const double base = primes[j];
+    double inverse = 0.0, scale = 1.0/base;
+    for (long i = point + 1; i > 0; i /= primes[j]) {
+      inverse += (i % primes[j])*scale;
+      scale /= base;
+    }
+
+    double x = inverse + shift[j];
+    if (x >= 1.0)
+      x -= 1.0;
+    u[j] = x > 0.0 ? x : 0.5*scale;
+  }
+
+  return 0;
+}
@@ -0,0 +1,35 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: HaltonSequenceGenerator draws the samples from the Halton
+// sequence, coordinate j being the radical inverse of the point number in
+// the j-th prime base, randomized by a random rotation of each coordinate
+// (Cranley and Patterson 1976). It has no limit on the number of random
+// variables, but the coordinates in large bases are evenly spread only
+// after many points.
+//
+// Written: cmp
+//
+#ifndef HaltonSequenceGenerator_h
+#define HaltonSequenceGenerator_h
+
+#include <vector>
+#include <QuasiRandomGenerator.h>
+
+class HaltonSequenceGenerator : public QuasiRandomGenerator
+{
+  public:
+    HaltonSequenceGenerator(int numReplicates = 8, int seed = 0);
+
+  protected:
+    int fillPoint(long point, int replicate, int n, double *u);
+
+  private:
+    std::vector<int> primes;
+    std::vector<double> shift;
+};
+
+#endif
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// LatinHypercubeGenerator.
+//
+// Written: cmp
+//
+#include <LatinHypercubeGenerator.h>
+#include <PhiloxRandGenerator.h>
+#include <OPS_Globals.h>
+#include <math.h>
+
+
+LatinHypercubeGenerator::LatinHypercubeGenerator(long points, int numReplicates, int passedSeed)
+:QuasiRandomGenerator(numReplicates, passedSeed),
+ numPoints(points > 0 ? points : 1), design(-1), permutationSeed(0), numCoordinates(0)
+{
+
+}
+
+
+int
+LatinHypercubeGenerator::fillPoint(long point, int replicate, int n, double *u)
+{
+  const int numReplicates = this->getNumReplicates();
+  const long thisDesign = point/numPoints;
+  const long stratum = point%numPoints;
+
+  if (thisDesign != design || seed != permutationSeed || n != numCoordinates) {
+    permutations.assign(numReplicates, std::vector<int>());
+    design = thisDesign;
+    permutationSeed = seed;
+    numCoordinates = n;
+  }
+
+  // the permutations of the strata of each coordinate, drawn with
+  // Fisher-Yates from a stream apart from that of the places in the strata
+  std::vector<int> &permutation = permutations[replicate];
+  if (permutation.empty()) {
+    if ((long)n*numPoints > 0x7FFFFFFFL) {
+      opserr << "LatinHypercubeGenerator - too many points and random variables\n";
+      return -1;
+    }
+    permutation.resize((std::size_t)n*numPoints);
+    scratch.resize(numPoints);
+    PhiloxRandGenerator stream((int)(((unsigned)seed + 0x5851F42Du) | 1u));
+    for (int j=0; j<n; j++) {
+      int *p = &permutation[(std::size_t)j*numPoints];
+      stream.fillUniformNumbers((design*numReplicates + replicate)*n + j, (int)numPoints, scratch.data());
+      for (long i=0; i<numPoints; i++)
+        p[i] = (int)i;
+      for (long i=numPoints-1; i>0; i--) {
+        long k = (long)(scratch[i]*(i+1));
+        if (k > i)
+          k = i;
+        const int swap = p[i];
+        p[i] = p[k];
+        p[k] = swap;
+      }
+    }
+  }
+
+  PhiloxRandGenerator(seed).fillUniformNumbers(point*numReplicates + replicate, n, u);
+  for (int j=0; j<n; j++) {
+    u[j] = (permutation[(std::size_t)j*numPoints + stratum] + u[j])/numPoints;
+    if (u[j] >= 1.0)
+      u[j] = nextafter(1.0, 0.0);
+  }
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: LatinHypercubeGenerator draws the samples from Latin
+// hypercube designs of numPoints points: the range of each coordinate is
+// divided into numPoints strata, every stratum holds one point, the
+// strata of the coordinates are paired by random permutations, and each
+// point lies at a random place in its stratum. Points beyond the first
+// numPoints come from further designs, independent of the first; the
+// stratification pays off when the analysis runs whole designs.
+//
+// Written: cmp
+//
+#ifndef LatinHypercubeGenerator_h
+#define LatinHypercubeGenerator_h
+
+#include <vector>
+#include <QuasiRandomGenerator.h>
+
+class LatinHypercubeGenerator : public QuasiRandomGenerator
+{
+  public:
+    LatinHypercubeGenerator(long numPoints, int numReplicates = 8, int seed = 0);
+
+  protected:
+    int fillPoint(long point, int replicate, int n, double *u);
+
+  private:
+    long numPoints;
+
+    // the permutations of the designs of one group of designs, for the
+    // seed and number of coordinates they were drawn with
+    std::vector<std::vector<int> > permutations;
+    long design;
+    int permutationSeed;
+    int numCoordinates;
+
+    std::vector<double> scratch;
+};
+
+#endif
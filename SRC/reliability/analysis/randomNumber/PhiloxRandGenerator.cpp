@@ -0,0 +1,198 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of PhiloxRandGenerator.
+//
+// Written: cmp
+//
+#include <PhiloxRandGenerator.h>
+#include <NormalRV.h>
+#include <Vector.h>
+#include <time.h>
+
+namespace {
+
+inline void
+mulhilo(uint32_t a, uint32_t b, uint32_t &hi, uint32_t &lo)
+{
+  const uint64_t product = (uint64_t)a*b;
+  hi = (uint32_t)(product >> 32);
+  lo = (uint32_t)product;
+}
+
+// 53 random bits to a number strictly between 0 and 1
+inline double
+toUnit(uint32_t a, uint32_t b)
+{
+  const uint64_t bits = ((uint64_t)(a >> 5) << 26) | (b >> 6);
+  return ((double)bits + 0.5)/9007199254740992.0;
+}
+
+}
+
+
+void
+PhiloxRandGenerator::block(uint32_t ctr[4], uint32_t k0, uint32_t k1)
+{
+  for (int round=0; round<10; round++) {
+    uint32_t hi0, lo0, hi1, lo1;
+    mulhilo(0xD2511F53u, ctr[0], hi0, lo0);
+    mulhilo(0xCD9E8D57u, ctr[2], hi1, lo1);
+    const uint32_t c0 = hi1 ^ ctr[1] ^ k0;
+    const uint32_t c2 = hi0 ^ ctr[3] ^ k1;
+    ctr[0] = c0;
+    ctr[1] = lo1;
+    ctr[2] = c2;
+    ctr[3] = lo0;
+    k0 += 0x9E3779B9u;
+    k1 += 0xBB67AE85u;
+  }
+}
+
+
+PhiloxRandGenerator::PhiloxRandGenerator(int passedSeed)
+:RandomNumberGenerator(), generatedNumbers(0), seed(0), sample(0)
+{
+  this->setSeed(passedSeed);
+}
+
+
+PhiloxRandGenerator::~PhiloxRandGenerator()
+{
+  if (generatedNumbers != 0)
+    delete generatedNumbers;
+}
+
+
+//
+// the counter is (pair of numbers in the sample, sample) and the key is
+// the seed; each evaluation gives two numbers
+//
+void
+PhiloxRandGenerator::fillUniformNumbers(long k, int n, double *u) const
+{
+  const uint64_t s = (uint64_t)k;
+  for (int j=0; j<n; j+=2) {
+    uint32_t ctr[4] = {(uint32_t)(j/2), 0u, (uint32_t)s, (uint32_t)(s >> 32)};
+    block(ctr, (uint32_t)seed, 0x4F70u);
+    u[j] = toUnit(ctr[0], ctr[1]);
+    if (j+1 < n)
+      u[j+1] = toUnit(ctr[2], ctr[3]);
+  }
+}
+
+
+void
+PhiloxRandGenerator::fillStdNormalNumbers(long k, int n, double *z) const
+{
+  static NormalRV uRV(1, 0.0, 1.0);
+
+  this->fillUniformNumbers(k, n, z);
+  for (int j=0; j<n; j++)
+    z[j] = uRV.getInverseCDFvalue(z[j]);
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+{
+  if (seedIn != 0)
+    this->setSeed(seedIn);
+
+  if (generatedNumbers == 0)
+    generatedNumbers = new Vector(n);
+  else if (generatedNumbers->Size() != n) {
+    delete generatedNumbers;
+    generatedNumbers = new Vector(n);
+  }
+
+  if (n > 0)
+    this->fillStdNormalNumbers(sample, n, &(*generatedNumbers)(0));
+  sample++;
+
+  return 0;
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+{
+  if (seedIn != 0)
+    this->setSeed(seedIn);
+
+  if (generatedNumbers == 0)
+    generatedNumbers = new Vector(n);
+  else if (generatedNumbers->Size() != n) {
+    delete generatedNumbers;
+    generatedNumbers = new Vector(n);
+  }
+
+  Vector &randomArray = *generatedNumbers;
+  if (n > 0)
+    this->fillUniformNumbers(sample, n, &randomArray(0));
+  for (int j=0; j<n; j++)
+    randomArray(j) = (upper-lower)*randomArray(j) + lower;
+  sample++;
+
+  return 0;
+}
+
+
+const Vector &
+PhiloxRandGenerator::getGeneratedNumbers()
+{
+  return *generatedNumbers;
+}
+
+
+int
+PhiloxRandGenerator::getSeed()
+{
+  return seed;
+}
+
+
+//
+// a new seed starts a new stream at its first sample; a seed of zero
+// takes one from the clock, as CStdLibRandGenerator does
+//
+void
+PhiloxRandGenerator::setSeed(int passedSeed)
+{
+  seed = passedSeed != 0 ? passedSeed : (int)time(NULL);
+  sample = 0;
+}
+
+
+int
+PhiloxRandGenerator::setSample(long passedSample)
+{
+  sample = passedSample;
+  return 0;
+}
+
+
+long
+PhiloxRandGenerator::getSample() const
+{
+  return sample;
+}
+
+
+double
+PhiloxRandGenerator::generate_singleUniformNumber(double lower, double upper)
+{
+  this->generate_nIndependentUniformNumbers(1, lower, upper);
+  return (*generatedNumbers)(0);
+}
+
+
+double
+PhiloxRandGenerator::generate_singleStdNormalNumber()
+{
+  this->generate_nIndependentStdNormalNumbers(1);
+  return (*generatedNumbers)(0);
+}
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: PhiloxRandGenerator is a counter-based random number
+// generator (Philox4x32-10, Salmon et al. 2011). A number is a function of
+// the seed, the index of the sample it belongs to and its position in the
+// sample only; there is no state carried from one number to the next.
+// Sample k can therefore be drawn by any process or thread, in any order,
+// and is the same number as in a serial run with the same seed.
+//
+// Through the RandomNumberGenerator interface each call to generate
+// numbers draws the next sample; setSample() positions the stream at a
+// given sample, and the const fill methods draw a given sample without
+// touching the position at all.
+//
+// Written: cmp
+//
+#ifndef PhiloxRandGenerator_h
+#define PhiloxRandGenerator_h
+
+#include <stdint.h>
+#include <RandomNumberGenerator.h>
+
+class Vector;
+
+class PhiloxRandGenerator : public RandomNumberGenerator
+{
+  public:
+    PhiloxRandGenerator(int seed = 0);
+    ~PhiloxRandGenerator();
+
+    int     generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int     generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const   Vector &getGeneratedNumbers();
+    int     getSeed();
+
+    double  generate_singleStdNormalNumber();
+    double  generate_singleUniformNumber(double lower=0.0, double upper=1.0);
+    void    setSeed(int passedSeed=0);
+
+    int     setSample(long sample);
+    long    getSample() const;
+
+    // numbers of a sample, drawn without changing the position
+    void    fillUniformNumbers(long sample, int n, double *u) const;
+    void    fillStdNormalNumbers(long sample, int n, double *z) const;
+
+    // ten rounds of Philox4x32 on the counter ctr with the key (k0, k1),
+    // in place
+    static void block(uint32_t ctr[4], uint32_t k0, uint32_t k1);
+
+  private:
+    Vector *generatedNumbers;
+    int seed;
+    long sample;                // sample drawn by the next call
+};
+
+#endif
@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of QuasiRandomGenerator.
+//
+// Written: cmp
+//
+#include <QuasiRandomGenerator.h>
+#include <NormalRV.h>
+#include <Vector.h>
+#include <time.h>
+
+
+QuasiRandomGenerator::QuasiRandomGenerator(int replicates, int passedSeed)
+:RandomNumberGenerator(), seed(0), generatedNumbers(0),
+ numReplicates(replicates > 0 ? replicates : 1), sample(0)
+{
+  this->setSeed(passedSeed);
+}
+
+
+QuasiRandomGenerator::~QuasiRandomGenerator()
+{
+  if (generatedNumbers != 0)
+    delete generatedNumbers;
+}
+
+
+//
+// the coordinates of the next sample, in generatedNumbers
+//
+int
+QuasiRandomGenerator::fillSample(int n)
+{
+  if (generatedNumbers == 0)
+    generatedNumbers = new Vector(n);
+  else if (generatedNumbers->Size() != n) {
+    delete generatedNumbers;
+    generatedNumbers = new Vector(n);
+  }
+
+  int result = 0;
+  if (n > 0)
+    result = this->fillPoint(sample/numReplicates, (int)(sample%numReplicates), n,
+                             &(*generatedNumbers)(0));
+  sample++;
+
+  return result;
+}
+
+
+int
+QuasiRandomGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+{
+  static NormalRV uRV(1, 0.0, 1.0);
+
+  if (seedIn != 0)
+    this->setSeed(seedIn);
+
+  if (this->fillSample(n) < 0)
+    return -1;
+
+  Vector &randomArray = *generatedNumbers;
+  for (int j=0; j<n; j++)
+    randomArray(j) = uRV.getInverseCDFvalue(randomArray(j));
+
+  return 0;
+}
+
+
+int
+QuasiRandomGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+{
+  if (seedIn != 0)
+    this->setSeed(seedIn);
+
+  if (this->fillSample(n) < 0)
+    return -1;
+
+  Vector &randomArray = *generatedNumbers;
+  for (int j=0; j<n; j++)
+    randomArray(j) = (upper-lower)*randomArray(j) + lower;
+
+  return 0;
+}
+
+
+const Vector &
+QuasiRandomGenerator::getGeneratedNumbers()
+{
+  return *generatedNumbers;
+}
+
+
+int
+QuasiRandomGenerator::getSeed()
+{
+  return seed;
+}
+
+
+void
+QuasiRandomGenerator::setSeed(int passedSeed)
+{
+  seed = passedSeed != 0 ? passedSeed : (int)time(NULL);
+  sample = 0;
+}
+
+
+int
+QuasiRandomGenerator::setSample(long passedSample)
+{
+  sample = passedSample;
+  return 0;
+}
+
+
+int
+QuasiRandomGenerator::getNumReplicates()
+{
+  return numReplicates;
+}
+
+
+double
+QuasiRandomGenerator::generate_singleUniformNumber(double lower, double upper)
+{
+  this->generate_nIndependentUniformNumbers(1, lower, upper);
+  return (*generatedNumbers)(0);
+}
+
+
+double
+QuasiRandomGenerator::generate_singleStdNormalNumber()
+{
+  this->generate_nIndependentStdNormalNumbers(1);
+  return (*generatedNumbers)(0);
+}
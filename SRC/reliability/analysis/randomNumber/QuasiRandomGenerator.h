@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: QuasiRandomGenerator is the base class of the generators
+// that draw the samples from a sequence of points spread more evenly over
+// the unit cube than independent numbers are: low-discrepancy sequences
+// and Latin hypercube designs. Standard normal numbers are the inverse of
+// the normal distribution at the coordinates of the point.
+//
+// The sequence is randomized numReplicates times, each randomization
+// drawn from a PhiloxRandGenerator with the seed, and the samples cycle
+// through the randomizations: sample k is point k/numReplicates of
+// randomization k%numReplicates. Each randomization gives an unbiased
+// estimate, and the spread of these estimates is the error of their mean.
+//
+// Like PhiloxRandGenerator, the numbers of a sample depend only on the
+// seed and the index of the sample, which setSample() positions.
+//
+// Written: cmp
+//
+#ifndef QuasiRandomGenerator_h
+#define QuasiRandomGenerator_h
+
+#include <RandomNumberGenerator.h>
+
+class Vector;
+
+class QuasiRandomGenerator : public RandomNumberGenerator
+{
+  public:
+    QuasiRandomGenerator(int numReplicates, int seed = 0);
+    virtual ~QuasiRandomGenerator();
+
+    int     generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int     generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const   Vector &getGeneratedNumbers();
+    int     getSeed();
+
+    double  generate_singleStdNormalNumber();
+    double  generate_singleUniformNumber(double lower=0.0, double upper=1.0);
+    void    setSeed(int passedSeed=0);
+
+    int     setSample(long sample);
+    int     getNumReplicates();
+
+  protected:
+    // the n coordinates, strictly between 0 and 1, of a point of a
+    // randomization of the sequence
+    virtual int fillPoint(long point, int replicate, int n, double *u) = 0;
+
+    int seed;
+
+  private:
+    int fillSample(int n);
+
+    Vector *generatedNumbers;
+    int numReplicates;
+    long sample;                // sample drawn by the next call
+};
+
+#endif
@@ -53,6 +53,17 @@ public:
 	virtual double  generate_singleUniformNumber(double lower=0.0, double upper=1.0)=0;		
 	virtual void setSeed(int)=0;
 
+	// positions the stream at the first number of a sample, so that
+	// sample k is the same wherever it is drawn; generators whose
+	// numbers depend on the ones drawn before return -1
+	virtual int setSample(long sample) {return -1;}
+
+	// number of independent randomizations of a quasi-random sequence
+	// that the samples cycle through; the samples of one randomization
+	// are not independent of each other, so the error of an estimate
+	// comes from the spread of the estimates of the randomizations
+	virtual int getNumReplicates() {return 1;}
+
 
 protected:
 
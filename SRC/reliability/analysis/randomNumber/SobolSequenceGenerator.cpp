@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// SobolSequenceGenerator.
+//
+// Written: cmp
+//
+#include <SobolSequenceGenerator.h>
+#include <PhiloxRandGenerator.h>
+#include <OPS_Globals.h>
+
+namespace {
+
+// degree s, coefficients a and initial numbers m of the primitive
+// polynomials of dimensions 2 to 21 (new-joe-kuo-6.21201)
+struct Polynomial {
+  int s;
+  unsigned a;
+  unsigned m[7];
+};
+
+const Polynomial polynomials[SobolSequenceGenerator::maxDimension - 1] = {
+  {1,  0, {1}},
+  {2,  1, {1, 3}},
+  {3,  1, {1, 3, 1}},
+  {3,  2, {1, 1, 1}},
+  {4,  1, {1, 1, 3, 3}},
+  {4,  4, {1, 3, 5, 13}},
+  {5,  2, {1, 1, 5, 5, 17}},
+  {5,  4, {1, 1, 5, 5, 5}},
+  {5,  7, {1, 1, 7, 11, 19}},
+  {5, 11, {1, 1, 5, 1, 1}},
+  {5, 13, {1, 1, 1, 3, 11}},
+  {5, 14, {1, 3, 5, 5, 31}},
+  {6,  1, {1, 3, 3, 9, 7, 49}},
+  {6, 13, {1, 1, 1, 15, 21, 21}},
+  {6, 16, {1, 3, 1, 13, 27, 49}},
+  {6, 19, {1, 1, 1, 15, 7, 5}},
+  {6, 22, {1, 3, 1, 15, 13, 25}},
+  {6, 25, {1, 1, 5, 5, 19, 61}},
+  {7,  1, {1, 3, 7, 11, 23, 15, 103}},
+  {7,  4, {1, 3, 7, 13, 13, 15, 69}},
+};
+
+}
+
+
+SobolSequenceGenerator::SobolSequenceGenerator(int numReplicates, int passedSeed)
+:QuasiRandomGenerator(numReplicates, passedSeed)
+{
+  // the first coordinate is the van der Corput sequence
+  for (int i=0; i<32; i++)
+    direction[0][i] = (uint32_t)1 << (31-i);
+
+  for (int j=1; j<maxDimension; j++) {
+    const Polynomial &p = polynomials[j-1];
+    uint32_t *v = direction[j];
+    for (int i=0; i<p.s; i++)
+      v[i] = (uint32_t)p.m[i] << (31-i);
+    for (int i=p.s; i<32; i++) {
+      v[i] = v[i-p.s] ^ (v[i-p.s] >> p.s);
+      for (int k=1; k<p.s; k++)
+        if ((p.a >> (p.s-1-k)) & 1)
+          v[i] ^= v[i-k];
+    }
+  }
+}
+
+
+int
+SobolSequenceGenerator::fillPoint(long point, int replicate, int n, double *u)
+{
+  if (n > maxDimension) {
+    opserr << "SobolSequenceGenerator - direction numbers are tabulated for "
+           << maxDimension << " random variables only\n";
+    return -1;
+  }
+
+  shift.resize(n);
+  PhiloxRandGenerator(seed).fillUniformNumbers(replicate, n, shift.data());
+
+  const uint64_t index = (uint64_t)point;
+  for (int j=0; j<n; j++) {
+    uint32_t x = (uint32_t)(shift[j]*4294967296.0);
+    for (int i=0; i<32 && (index >> i) != 0; i++)
+      if ((index >> i) & 1)
+        x ^= direction[j][i];
+    u[j] = ((double)x + 0.5)/4294967296.0;
+  }
+
+  return 0;
+}
@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SobolSequenceGenerator draws the samples from the Sobol
+// sequence with the direction numbers of Joe and Kuo (2008), randomized
+// by a random digital shift of each coordinate. The direction numbers are
+// tabulated for up to 21 random variables; the Halton sequence or a Latin
+// hypercube design serve larger problems.
+//
+// Written: cmp
+//
+#ifndef SobolSequenceGenerator_h
+#define SobolSequenceGenerator_h
+
+#include <stdint.h>
+#include <vector>
+#include <QuasiRandomGenerator.h>
+
+class SobolSequenceGenerator : public QuasiRandomGenerator
+{
+  public:
+    SobolSequenceGenerator(int numReplicates = 8, int seed = 0);
+
+    static const int maxDimension = 21;
+
+  protected:
+    int fillPoint(long point, int replicate, int n, double *u);
+
+  private:
+    uint32_t direction[maxDimension][32];
+    std::vector<double> shift;
+};
+
+#endif
@@ -31,7 +31,6 @@
 // Written by Terje Haukaas (haukaas@ce.berkeley.edu)
 //
 
-#include <ReliabilityDomain.h>
 #include <ReliabilityDomainComponent.h>
 
 ReliabilityDomainComponent::ReliabilityDomainComponent(int passedTag, int passedClassTag)
@@ -32,6 +32,8 @@
 //
 
 #include <NormalRV.h>
+#include <classTags.h>
+#include <OPS_Globals.h>
 #include <Vector.h>
 #include <cmath>
 #include <float.h>
@@ -25,6 +25,7 @@
 #include <NewtonHallM.h>
 #include <Broyden.h>
 #include <BFGS.h>
+#include <LimitedMemoryNewton.h>
 #include <KrylovNewton.h>
 #include <PeriodicNewton.h>
 #include <AcceleratedNewton.h>
@@ -66,6 +67,7 @@ TclEquiSolnAlgo G3_newNewtonLineSearch;
 static TclEquiSolnAlgo G3_newKrylovNewton;
 static TclEquiSolnAlgo G3_newBroyden;
 static TclEquiSolnAlgo G3_newBFGS;
+static TclEquiSolnAlgo G3_newLimitedMemoryNewton;
 
 Tcl_CmdProc TclCommand_newLinearAlgorithm;
 Tcl_CmdProc TclCommand_newNewtonRaphson;
@@ -130,6 +132,10 @@ G3Parse_newEquiSolnAlgo(ClientData clientData, Tcl_Interp *interp, int argc,
   else if (strcmp(argv[1], "BFGS") == 0)
     return G3_newBFGS(clientData, interp, argc, argv);
 
+  else if ((strcmp(argv[1], "LBFGS") == 0) ||
+           (strcmp(argv[1], "Anderson") == 0))
+    return G3_newLimitedMemoryNewton(clientData, interp, argc, argv);
+
   else if (strcmp(argv[1], "SecantNewton") == 0)
     return G3Parse_newSecantNewtonAlgorithm(clientData, interp, argc, argv);
 
@@ -202,6 +208,38 @@ TclCommand_newLinearAlgorithm(ClientData clientData, Tcl_Interp *interp, int arg
   return TCL_OK;
 }
 
+//
+// parses the options "-reuse $maxRatio" and "-reuseSteps $maxSteps" of
+// the algorithms that can keep their tangent across steps; returns 1 if
+// argv[i] was one of them, 0 if not, and -1 on error
+//
+static int
+G3Parse_tangentReuse(Tcl_Interp *interp, int argc, TCL_Char ** const argv, int &i,
+                     double &maxRatio, int &maxSteps)
+{
+  if (strcmp(argv[i], "-reuse") == 0) {
+    if (i + 1 >= argc || Tcl_GetDouble(interp, argv[i+1], &maxRatio) != TCL_OK
+        || maxRatio < 0.0 || maxRatio >= 1.0) {
+      opserr << G3_ERROR_PROMPT << "-reuse requires a ratio in [0, 1)\n";
+      return -1;
+    }
+    i++;
+    return 1;
+  }
+
+  if (strcmp(argv[i], "-reuseSteps") == 0) {
+    if (i + 1 >= argc || Tcl_GetInt(interp, argv[i+1], &maxSteps) != TCL_OK
+        || maxSteps < 0) {
+      opserr << G3_ERROR_PROMPT << "-reuseSteps requires a number of steps >= 0\n";
+      return -1;
+    }
+    i++;
+    return 1;
+  }
+
+  return 0;
+}
+
 int
 TclCommand_newNewtonRaphson(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char**const argv)
 {
@@ -211,8 +249,16 @@ TclCommand_newNewtonRaphson(ClientData clientData, Tcl_Interp* interp, int argc,
   int formTangent = CURRENT_TANGENT;
   double iFactor = 0;
   double cFactor = 1;
+  double reuseRatio = 0;
+  int reuseSteps = 0;
 
   for (int i=2; i<argc; i++) {
+    int reuse = G3Parse_tangentReuse(interp, argc, argv, i, reuseRatio, reuseSteps);
+    if (reuse < 0)
+      return TCL_ERROR;
+    else if (reuse > 0)
+      continue;
+
     if (strcmp(argv[i],"-secant")==0 || 
         strcmp(argv[i],"-Secant")==0) {
       formTangent = CURRENT_SECANT;
@@ -251,7 +297,9 @@ TclCommand_newNewtonRaphson(ClientData clientData, Tcl_Interp* interp, int argc,
     }
   }
 
-  builder->set(new NewtonRaphson(formTangent, iFactor, cFactor));
+  auto algorithm = new NewtonRaphson(formTangent, iFactor, cFactor);
+  algorithm->setTangentReuse(reuseRatio, reuseSteps);
+  builder->set(algorithm);
 
   return TCL_OK;
 }
@@ -266,8 +314,16 @@ TclCommand_newModifiedNewton(ClientData clientData, Tcl_Interp* interp, int argc
   int formTangent = CURRENT_TANGENT;
   double iFactor = 0;
   double cFactor = 1;
+  double reuseRatio = 0;
+  int reuseSteps = 0;
 
   for (int i=2; i<argc; i++) {
+    int reuse = G3Parse_tangentReuse(interp, argc, argv, i, reuseRatio, reuseSteps);
+    if (reuse < 0)
+      return TCL_ERROR;
+    else if (reuse > 0)
+      continue;
+
     if (strcmp(argv[i],"-secant") == 0) {
       formTangent = CURRENT_SECANT;
 
@@ -294,6 +350,7 @@ TclCommand_newModifiedNewton(ClientData clientData, Tcl_Interp* interp, int argc
   }
 
   auto algorithm = new ModifiedNewton(formTangent, iFactor, cFactor);
+  algorithm->setTangentReuse(reuseRatio, reuseSteps);
   builder->set(algorithm);
   return TCL_OK;
 }
@@ -456,6 +513,53 @@ G3_newBFGS(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** cons
   return theNewAlgo;
 }
 
+//
+// algorithm LBFGS    <-maxDim $m> <-ratio $r> <-initial>
+// algorithm Anderson <-maxDim $m> <-ratio $r> <-initial>
+//
+static EquiSolnAlgo *
+G3_newLimitedMemoryNewton(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder *)clientData;
+
+  ConvergenceTest *theTest = builder->getConvergenceTest();
+
+  if (theTest == nullptr) {
+    opserr << G3_ERROR_PROMPT << "No ConvergenceTest yet specified\n";
+    return nullptr;
+  }
+
+  int method = strcmp(argv[1], "Anderson") == 0 ? LimitedMemoryNewton::Anderson
+                                                : LimitedMemoryNewton::LBFGS;
+  int formTangent = CURRENT_TANGENT;
+  int maxDim = 8;
+  double maxRatio = 0.5;
+  for (int i = 2; i < argc; ++i) {
+    if (strcmp(argv[i], "-initial") == 0) {
+      formTangent = INITIAL_TANGENT;
+
+    } else if (strcmp(argv[i], "-maxDim") == 0 && i + 1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &maxDim) != TCL_OK || maxDim < 0) {
+        opserr << G3_ERROR_PROMPT << "invalid -maxDim " << argv[i] << "\n";
+        return nullptr;
+      }
+
+    } else if (strcmp(argv[i], "-ratio") == 0 && i + 1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &maxRatio) != TCL_OK || maxRatio <= 0.0) {
+        opserr << G3_ERROR_PROMPT << "invalid -ratio " << argv[i] << "\n";
+        return nullptr;
+      }
+
+    } else {
+      opserr << G3_ERROR_PROMPT << "unknown option " << argv[i] << "\n";
+      return nullptr;
+    }
+  }
+
+  return new LimitedMemoryNewton(method, maxDim, maxRatio, formTangent);
+}
+
 EquiSolnAlgo *
 G3_newNewtonLineSearch(ClientData clientData, Tcl_Interp *interp, int argc,
                        TCL_Char ** const argv)
@@ -562,8 +666,16 @@ G3_newKrylovNewton(ClientData clientData, Tcl_Interp *interp, int argc,
   int incrementTangent = CURRENT_TANGENT;
   int iterateTangent = CURRENT_TANGENT;
   int maxDim = 3;
+  double reuseRatio = 0;
+  int reuseSteps = 0;
 
   for (int i = 2; i < argc; ++i) {
+    int reuse = G3Parse_tangentReuse(interp, argc, argv, i, reuseRatio, reuseSteps);
+    if (reuse < 0)
+      return nullptr;
+    else if (reuse > 0)
+      continue;
+
     if (strcmp(argv[i], "-iterate") == 0 && i + 1 < argc) {
       i++;
       if (strcmp(argv[i], "current") == 0)
@@ -591,6 +703,7 @@ G3_newKrylovNewton(ClientData clientData, Tcl_Interp *interp, int argc,
   Accelerator *theAccel = new KrylovAccelerator(maxDim, iterateTangent);
 
   EquiSolnAlgo *theNewAlgo = new AcceleratedNewton(*theTest, theAccel, incrementTangent);
+  theNewAlgo->setTangentReuse(reuseRatio, reuseSteps);
   return theNewAlgo;
 }
 
@@ -832,6 +945,36 @@ TclCommand_numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
   return TCL_OK;
 }
 
+int
+TclCommand_numFactSaved(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder *)clientData;
+  EquiSolnAlgo* algo = builder->getAlgorithm();
+
+  if (algo == nullptr)
+    return TCL_ERROR;
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(algo->getNumFactorizationsSaved()));
+
+  return TCL_OK;
+}
+
+int
+TclCommand_numResidualEval(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder *)clientData;
+  EquiSolnAlgo* algo = builder->getAlgorithm();
+
+  if (algo == nullptr)
+    return TCL_ERROR;
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(algo->getNumResidualEvaluations()));
+
+  return TCL_OK;
+}
+
 int
 TclCommand_algorithmRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
                         TCL_Char ** const argv)
@@ -17,6 +17,7 @@
 #include <Matrix.h>
 #include <Domain.h> // for modal damping
 #include <AnalysisModel.h>
+#include <ExplicitAnalysis.h>
 
 #include "BasicAnalysisBuilder.h"
 
@@ -116,6 +117,41 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
   }
 
+  // analysis Explicit <-alphaM $alphaM> <-threads $n> <-subcycle $levels> <-safety $factor>
+  else if (strcmp(argv[argi], "Explicit") == 0) {
+    double alphaM = 0.0, safety = 0.9;
+    int numThreads = 1, maxLevels = 0;
+    for (int i = argi + 1; i < argc; i++) {
+      if (i + 1 >= argc) {
+        opserr << G3_ERROR_PROMPT << "missing value for option " << argv[i] << "\n";
+        return TCL_ERROR;
+      }
+      if (strcmp(argv[i], "-alphaM") == 0) {
+        if (Tcl_GetDouble(interp, argv[++i], &alphaM) != TCL_OK)
+          return TCL_ERROR;
+      } else if (strcmp(argv[i], "-threads") == 0) {
+        if (Tcl_GetInt(interp, argv[++i], &numThreads) != TCL_OK)
+          return TCL_ERROR;
+      } else if (strcmp(argv[i], "-subcycle") == 0) {
+        if (Tcl_GetInt(interp, argv[++i], &maxLevels) != TCL_OK)
+          return TCL_ERROR;
+      } else if (strcmp(argv[i], "-safety") == 0) {
+        if (Tcl_GetDouble(interp, argv[++i], &safety) != TCL_OK)
+          return TCL_ERROR;
+        if (safety <= 0.0 || safety > 1.0) {
+          opserr << G3_ERROR_PROMPT << "safety factor must be in (0, 1]\n";
+          return TCL_ERROR;
+        }
+      } else {
+        opserr << G3_ERROR_PROMPT << "unknown option " << argv[i] << "\n";
+        return TCL_ERROR;
+      }
+    }
+    builder->setExplicitAnalysis(new ExplicitAnalysis(*builder->getDomain(), 
+                                                      alphaM, numThreads, maxLevels, safety));
+    return TCL_OK;
+  }
+
   else if (((strcmp(argv[1], "VariableTimeStepTransient") == 0) ||
           (strcmp(argv[1], "TransientWithVariableTimeStep") == 0) ||
           (strcmp(argv[1], "VariableTransient") == 0))) {
@@ -158,18 +194,73 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
       break;
     }
     case BasicAnalysisBuilder::TRANSIENT_ANALYSIS: {
-      double dT;
+      // for explicit integrators the time step may be omitted, in
+      // which case it is a fraction of the estimated critical step
+      //   analyze numIncr <-safety factor?>
+      double dT = 0.0;
       int numIncr;
-      if (argc < 3) {
-        opserr << G3_ERROR_PROMPT << "transient analysis: analysis numIncr? deltaT?\n";
+      if (argc < 2) {
+        opserr << G3_ERROR_PROMPT << "transient analysis: analysis numIncr? <deltaT?>\n";
         return TCL_ERROR;
       }
       if (Tcl_GetInt(interp, argv[1], &numIncr) != TCL_OK)
         return TCL_ERROR;
-      if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
+      if (argc > 2 && strcmp(argv[2], "-safety") == 0) {
+        double safety;
+        if (argc != 4) {
+          opserr << G3_ERROR_PROMPT << "want: analyze numIncr -safety factor?\n";
+          return TCL_ERROR;
+        }
+        if (Tcl_GetDouble(interp, argv[3], &safety) != TCL_OK)
+          return TCL_ERROR;
+        if (safety <= 0.0 || safety > 1.0) {
+          opserr << G3_ERROR_PROMPT << "safety factor must be in (0, 1]\n";
+          return TCL_ERROR;
+        }
+        result = builder->analyze(numIncr, 0.0, safety);
+        break;
+      }
+      if (argc > 2 && Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
         return TCL_ERROR;
 
-      if (argc == 6) {
+      // the options are matched by name, since the legacy form
+      // analyze numIncr dT dtMin dtMax Jd may take a negative dtMin
+      bool adaptive = argc > 3 && (strcmp(argv[3], "-tol") == 0
+                                || strcmp(argv[3], "-atol") == 0
+                                || strcmp(argv[3], "-min") == 0
+                                || strcmp(argv[3], "-max") == 0);
+      if (adaptive) {
+        // analyze numIncr dT -tol tol? <-atol atol?> <-min dtMin?> <-max dtMax?>
+        double tol   = 1.0e-3;
+        double atol  = 1.0e-8;
+        double dtMin = dT/1024.0;
+        double dtMax = 10.0*dT;
+        for (int i=3; i<argc; i++) {
+          if (strcmp(argv[i], "-tol") == 0 && i+1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK)
+              return TCL_ERROR;
+          } else if (strcmp(argv[i], "-atol") == 0 && i+1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++i], &atol) != TCL_OK)
+              return TCL_ERROR;
+          } else if (strcmp(argv[i], "-min") == 0 && i+1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++i], &dtMin) != TCL_OK)
+              return TCL_ERROR;
+          } else if (strcmp(argv[i], "-max") == 0 && i+1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++i], &dtMax) != TCL_OK)
+              return TCL_ERROR;
+          } else {
+            opserr << G3_ERROR_PROMPT << "unknown option " << argv[i]
+                   << ", want: analyze numIncr dT -tol tol? <-atol atol?> <-min dtMin?> <-max dtMax?>\n";
+            return TCL_ERROR;
+          }
+        }
+        if (dT <= 0.0 || tol <= 0.0 || atol <= 0.0 || dtMin > dtMax) {
+          opserr << G3_ERROR_PROMPT << "adaptive analysis requires dT > 0, tol > 0, atol > 0 and dtMin <= dtMax\n";
+          return TCL_ERROR;
+        }
+        result = builder->analyzeAdaptive(numIncr, dT, dtMin, dtMax, tol, atol);
+
+      } else if (argc == 6) {
         int Jd;
         double dtMin, dtMax;
         if (Tcl_GetDouble(interp, argv[3], &dtMin) != TCL_OK)
@@ -186,6 +277,23 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
       }
       break;
     }
+    case BasicAnalysisBuilder::EXPLICIT_ANALYSIS: {
+      // the time step is optional; when omitted it is
+      // estimated from the critical step of the mesh
+      double dT = 0.0;
+      int numIncr;
+      if (argc < 2) {
+        opserr << G3_ERROR_PROMPT << "explicit analysis: analysis numIncr? <deltaT?>\n";
+        return TCL_ERROR;
+      }
+      if (Tcl_GetInt(interp, argv[1], &numIncr) != TCL_OK)
+        return TCL_ERROR;
+      if (argc > 2 && Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
+        return TCL_ERROR;
+
+      result = builder->analyze(numIncr, dT);
+      break;
+    }
     default:
       opserr << G3_ERROR_PROMPT << "No Analysis type has been specified \n";
       return TCL_ERROR;
@@ -425,6 +533,37 @@ modalDamping(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+//
+// adaptiveStats
+//   Return the statistics of the last adaptive transient analysis as
+//   a list of keys and values.
+//
+static int
+adaptiveStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+
+  const BasicAnalysisBuilder::AdaptiveStatistics &stats = builder->getAdaptiveStatistics();
+
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewStringObj("accepted", -1));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(stats.numAccepted));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewStringObj("rejected", -1));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(stats.numRejected));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewStringObj("failed", -1));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(stats.numFailed));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewStringObj("minStep", -1));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewDoubleObj(stats.minDt));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewStringObj("maxStep", -1));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewDoubleObj(stats.maxDt));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewStringObj("maxError", -1));
+  Tcl_ListObjAppendElement(interp, list, Tcl_NewDoubleObj(stats.maxError));
+
+  Tcl_SetObjResult(interp, list);
+  return TCL_OK;
+}
+
 static int
 resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
@@ -439,6 +578,11 @@ resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** cons
   if (theTransientIntegrator != nullptr) {
     theTransientIntegrator->revertToStart();
   }
+
+  ExplicitAnalysis *theExplicitAnalysis = builder->getExplicitAnalysis();
+  if (theExplicitAnalysis != nullptr)
+    theExplicitAnalysis->revertToStart();
+
   return TCL_OK;
 }
 
@@ -20,6 +20,7 @@ static Tcl_CmdProc printB;
 static Tcl_CmdProc initializeAnalysis;
 static Tcl_CmdProc resetModel;
 static Tcl_CmdProc analyzeModel;
+static Tcl_CmdProc adaptiveStats;
 static Tcl_CmdProc specifyConstraintHandler;
 static Tcl_CmdProc modalDamping;
 
@@ -37,6 +38,8 @@ extern Tcl_CmdProc TclCommand_accelCPU;
 extern Tcl_CmdProc TclCommand_totalCPU;
 extern Tcl_CmdProc TclCommand_solveCPU;
 extern Tcl_CmdProc TclCommand_numFact;
+extern Tcl_CmdProc TclCommand_numFactSaved;
+extern Tcl_CmdProc TclCommand_numResidualEval;
 
 // from commands/analysis/ctest.cpp
 extern Tcl_CmdProc specifyCTest;
@@ -44,6 +47,9 @@ extern Tcl_CmdProc getCTestNorms;
 extern Tcl_CmdProc getCTestIter;
 extern Tcl_CmdProc TclCommand_algorithmRecorder;
 
+// from commands/analysis/profile.cpp
+extern Tcl_CmdProc TclCommand_profile;
+
 // from commands/analysis/sensitivity.cpp
 extern Tcl_CmdProc TclCommand_sensitivityAlgorithm;
 extern Tcl_CmdProc TclCommand_sensLambda;
@@ -64,6 +70,7 @@ struct char_cmd {
     {"analysis",            &specifyAnalysis},
 
     {"analyze",             &analyzeModel},
+    {"adaptiveStats",       &adaptiveStats},
     {"initialize",          &initializeAnalysis},
     {"modalProperties",     &modalProperties},
     {"modalDamping",        &modalDamping},
@@ -77,12 +84,17 @@ struct char_cmd {
     {"algorithm",           &TclCommand_specifyAlgorithm},
     {"numIter",             &TclCommand_numIter},
     {"numFact",             &TclCommand_numFact},
+    {"numFactSaved",        &TclCommand_numFactSaved},
+    {"numResidualEval",     &TclCommand_numResidualEval},
     {"accelCPU",            &TclCommand_accelCPU},
     {"totalCPU",            &TclCommand_totalCPU},
     {"solveCPU",            &TclCommand_solveCPU},
   // recorder.cpp
     {"algorithmRecorder",   &TclCommand_algorithmRecorder},
 
+  // profile.cpp
+    {"profile",             &TclCommand_profile},
+
   // sensitivity
     {"sensitivityAlgorithm", TclCommand_sensitivityAlgorithm},
     {"sensLambda",           TclCommand_sensLambda},
@@ -25,6 +25,7 @@
 #include <CTestFixedNumIter.h>
 #include <NormDispAndUnbalance.h>
 #include <NormDispOrUnbalance.h>
+#include <CTestCombined.h>
 
 
 ConvergenceTest*
@@ -57,6 +58,7 @@ TclDispatch_newConvergenceTest(ClientData clientData, Tcl_Interp* interp, int ar
   // get the tolerence first
   double tol     = 1e-12;
   double tol2    = 0.0;
+  double tol3    = 0.0;
 //double tolp    = 0.0;
 //double tolp2   = 0.0;
 //double tolrel  = 0.0;
@@ -67,6 +69,7 @@ TclDispatch_newConvergenceTest(ClientData clientData, Tcl_Interp* interp, int ar
   int printIt  =  0;
   int normType =  2;
   int maxIncr  = -1;
+  bool any     = false;
 
   // make sure at least one other argument to contain test type
   if (argc < 2) {
@@ -119,6 +122,29 @@ TclDispatch_newConvergenceTest(ClientData clientData, Tcl_Interp* interp, int ar
         return nullptr;
     }
 
+  } else if (strcmp(argv[1], "Combined") == 0) {
+    // test Combined $tolDisp $tolUnbalance $tolEnergy $iter <$pFlag> <$nType> <-any>
+    if (argc > 2 && strcmp(argv[argc-1], "-any") == 0) {
+      any = true;
+      argc--;
+    }
+    if (argc < 6 || argc > 8) {
+      opserr << G3_ERROR_PROMPT << "want test Combined $tolDisp $tolUnbalance $tolEnergy $iter <$pFlag> <$nType> <-any>\n";
+      return nullptr;
+    }
+    if (Tcl_GetDouble(interp, argv[2], &tol) != TCL_OK)
+      return nullptr;
+    if (Tcl_GetDouble(interp, argv[3], &tol2) != TCL_OK)
+      return nullptr;
+    if (Tcl_GetDouble(interp, argv[4], &tol3) != TCL_OK)
+      return nullptr;
+    if (Tcl_GetInt(interp, argv[5], &numIter) != TCL_OK)
+      return nullptr;
+    if (argc > 6 && Tcl_GetInt(interp, argv[6], &printIt) != TCL_OK)
+      return nullptr;
+    if (argc > 7 && Tcl_GetInt(interp, argv[7], &normType) != TCL_OK)
+      return nullptr;
+
   } else if (strcmp(argv[1], "FixedNumIter") == 0) {
     // test FixedNumIter $iter <$pFlag> <$nType>
     if (argc == 3) {
@@ -232,6 +258,14 @@ TclDispatch_newConvergenceTest(ClientData clientData, Tcl_Interp* interp, int ar
   if (strcmp(argv[1], "FixedNumIter") == 0)
     theNewTest = new CTestFixedNumIter(numIter, flag, normType);
 
+  else if (strcmp(argv[1], "Combined") == 0) {
+    if (tol <= 0.0 && tol2 <= 0.0 && tol3 <= 0.0) {
+      opserr << G3_ERROR_PROMPT << "no tolerance specified in test command\n";
+      return nullptr;
+    }
+    return new CTestCombined(tol, tol2, tol3, numIter, flag, normType, any);
+  }
+
   else {
     if (tol == 0.0) {
       opserr << G3_ERROR_PROMPT << "no tolerance specified in test command\n";
@@ -14,6 +14,8 @@
 #include <DOF_Numberer.h>
 #include <RCM.h>
 #include <AMDNumberer.h>
+#include <ThreadedRCM.h>
+#include <NestedDissection.h>
 
 #if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
 #  include <ParallelNumberer.h>
@@ -54,13 +56,51 @@ TclCommand_setNumberer(ClientData clientData, Tcl_Interp* interp, int argc, TCL_
   if (strcmp(argv[1], "Plain") == 0) {
     theNumberer = new PlainNumberer();
 
-  } else if (strcmp(argv[1], "RCM") == 0) {
-    RCM *theRCM = new RCM(false);
-    theNumberer = new DOF_Numberer(*theRCM);
+  } else if (strcmp(argv[1], "RCM") == 0 ||
+             strcmp(argv[1], "ThreadedRCM") == 0) {
+    // numberer RCM <-threads $n> <-stats>
+    int numThreads = 1;
+    bool printStats = false;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i], "-threads") == 0 && i+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++i], &numThreads) != TCL_OK || numThreads < 1) {
+          opserr << "WARNING invalid number of threads " << argv[i] << "\n";
+          return TCL_ERROR;
+        }
+      } else if (strcmp(argv[i], "-stats") == 0) {
+        printStats = true;
+      } else {
+        opserr << "WARNING unknown option " << argv[i] << " for numberer " << argv[1] << "\n";
+        return TCL_ERROR;
+      }
+    }
+    if (strcmp(argv[1], "RCM") == 0 && numThreads == 1 && !printStats) {
+      RCM *theRCM = new RCM(false);
+      theNumberer = new DOF_Numberer(*theRCM);
+    } else {
+      ThreadedRCM *theRCM = new ThreadedRCM(numThreads, printStats);
+      theNumberer = new DOF_Numberer(*theRCM);
+    }
 
   } else if (strcmp(argv[1], "AMD") == 0) {
     AMD *theAMD = new AMD();
     theNumberer = new DOF_Numberer(*theAMD);
+
+  } else if (strcmp(argv[1], "NestedDissection") == 0 ||
+             strcmp(argv[1], "ND") == 0 ||
+             strcmp(argv[1], "Metis") == 0) {
+    // numberer NestedDissection <-stats>
+    bool printStats = false;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i], "-stats") == 0) {
+        printStats = true;
+      } else {
+        opserr << "WARNING unknown option " << argv[i] << " for numberer " << argv[1] << "\n";
+        return TCL_ERROR;
+      }
+    }
+    NestedDissection *theND = new NestedDissection(printStats);
+    theNumberer = new DOF_Numberer(*theND);
   }
 
 #  ifdef _PARALLEL_INTERPRETERS
@@ -82,7 +122,7 @@ TclCommand_setNumberer(ClientData clientData, Tcl_Interp* interp, int argc, TCL_
 #endif
 
   else {
-    opserr << "WARNING No Numberer type exists (Plain, RCM only) \n";
+    opserr << "WARNING No Numberer type exists (Plain, RCM, ThreadedRCM, AMD, NestedDissection) \n";
     return TCL_ERROR;
   }
 
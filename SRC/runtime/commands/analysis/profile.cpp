@@ -0,0 +1,192 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file implements the "profile" command, which switches
+// the analysis profiler on and off and reports its totals.
+//
+//   profile on <-elements>
+//   profile off
+//   profile reset
+//   profile report <-json> <-file $path>
+//
+// With -elements the time spent in each element is accumulated by element
+// class as well; this takes two clock readings per element and task. The
+// report is returned as the result of the command unless a file is given.
+//
+// Written: cmp
+//
+#include <tcl.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <Logging.h>
+#include <Parsing.h>
+#include <logging/Profiler.h>
+
+using OpenSees::Profiler;
+
+namespace {
+
+void
+appendf(std::string &out, const char *format, ...)
+{
+  char line[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+  out += line;
+}
+
+// element classes in decreasing order of their total time
+std::vector<const Profiler::ElementClass *>
+sortedClasses()
+{
+  auto total = [](const Profiler::ElementClass *entry) {
+    double seconds = 0.0;
+    for (const Profiler::Counter &task : entry->tasks)
+      seconds += task.seconds;
+    return seconds;
+  };
+
+  std::vector<const Profiler::ElementClass *> classes;
+  for (const auto &entry : Profiler::getElementClasses())
+    classes.push_back(&entry.second);
+  std::sort(classes.begin(), classes.end(),
+            [&](const Profiler::ElementClass *a, const Profiler::ElementClass *b) {
+              return total(a) > total(b);
+            });
+  return classes;
+}
+
+std::string
+reportText()
+{
+  std::string out;
+  const double elapsed = Profiler::getElapsed();
+  appendf(out, "Profile of %.6g s\n", elapsed);
+  appendf(out, "  %-16s %12s %14s %8s\n", "phase", "calls", "seconds", "share");
+  for (int i=0; i<Profiler::NumPhases; i++) {
+    const Profiler::Phase phase = (Profiler::Phase)i;
+    const Profiler::Counter &counter = Profiler::getPhase(phase);
+    appendf(out, "  %-16s %12ld %14.6e %7.2f%%\n", Profiler::getName(phase),
+            counter.calls, counter.seconds,
+            elapsed > 0.0 ? 100.0*counter.seconds/elapsed : 0.0);
+  }
+
+  const std::vector<const Profiler::ElementClass *> classes = sortedClasses();
+  if (classes.empty())
+    return out;
+
+  // the columns of each task are headed "calls" and "<task> [s]",
+  // right aligned as the numbers below them
+  appendf(out, "  %-24s", "element class");
+  for (int j=0; j<Profiler::NumTasks; j++) {
+    const std::string seconds = std::string(Profiler::getName((Profiler::Task)j)) + " [s]";
+    appendf(out, " %10s %14s", "calls", seconds.c_str());
+  }
+  out += "\n";
+  for (const Profiler::ElementClass *entry : classes) {
+    appendf(out, "  %-24s", entry->name.c_str());
+    for (const Profiler::Counter &task : entry->tasks)
+      appendf(out, " %10ld %14.6e", task.calls, task.seconds);
+    out += "\n";
+  }
+  return out;
+}
+
+std::string
+reportJSON()
+{
+  std::string out;
+  appendf(out, "{\n  \"elapsed\": %.17g,\n  \"phases\": {", Profiler::getElapsed());
+  for (int i=0; i<Profiler::NumPhases; i++) {
+    const Profiler::Phase phase = (Profiler::Phase)i;
+    const Profiler::Counter &counter = Profiler::getPhase(phase);
+    appendf(out, "%s\n    \"%s\": {\"calls\": %ld, \"seconds\": %.17g}", i > 0 ? "," : "",
+            Profiler::getName(phase), counter.calls, counter.seconds);
+  }
+  out += "\n  },\n  \"elements\": [";
+
+  bool first = true;
+  for (const Profiler::ElementClass *entry : sortedClasses()) {
+    appendf(out, "%s\n    {\"class\": \"%s\"", first ? "" : ",", entry->name.c_str());
+    for (int j=0; j<Profiler::NumTasks; j++)
+      appendf(out, ", \"%s\": {\"calls\": %ld, \"seconds\": %.17g}",
+              Profiler::getName((Profiler::Task)j), entry->tasks[j].calls, entry->tasks[j].seconds);
+    out += "}";
+    first = false;
+  }
+  out += first ? "]\n}\n" : "\n  ]\n}\n";
+  return out;
+}
+
+}
+
+
+int
+TclCommand_profile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  if (argc < 2) {
+    opserr << OpenSees::PromptValueError << "expected profile on|off|reset|report\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1], "on") == 0) {
+    bool elements = false;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i], "-elements") == 0)
+        elements = true;
+      else {
+        opserr << OpenSees::PromptValueError << "unknown option " << argv[i] << "\n";
+        return TCL_ERROR;
+      }
+    }
+    Profiler::start(elements);
+
+  } else if (strcmp(argv[1], "off") == 0) {
+    Profiler::stop();
+
+  } else if (strcmp(argv[1], "reset") == 0) {
+    Profiler::reset();
+
+  } else if (strcmp(argv[1], "report") == 0) {
+    bool json = false;
+    const char *fileName = nullptr;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i], "-json") == 0)
+        json = true;
+      else if (strcmp(argv[i], "-file") == 0 && i+1 < argc)
+        fileName = argv[++i];
+      else {
+        opserr << OpenSees::PromptValueError << "unknown option " << argv[i] << "\n";
+        return TCL_ERROR;
+      }
+    }
+
+    const std::string report = json ? reportJSON() : reportText();
+    if (fileName == nullptr) {
+      Tcl_SetObjResult(interp, Tcl_NewStringObj(report.c_str(), -1));
+      return TCL_OK;
+    }
+
+    std::ofstream file(fileName);
+    if (!(file << report)) {
+      opserr << OpenSees::PromptValueError << "could not write to file " << fileName << "\n";
+      return TCL_ERROR;
+    }
+
+  } else {
+    opserr << OpenSees::PromptValueError << "unknown profile action " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
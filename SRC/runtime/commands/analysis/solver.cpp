@@ -63,6 +63,11 @@
 #  include <DistributedProfileSPDLinSOE.h>
 #endif
 
+#if defined(_PARALLEL_INTERPRETERS)
+#  include <NeighborDiagonalSOE.h>
+#  include <NeighborDiagonalSolver.h>
+#endif
+
 // TODO: remove
 // extern DirectIntegrationAnalysis *theTransientAnalysis;
 // extern LinearSOE *theSOE;
@@ -177,6 +182,10 @@ G3Parse_newLinearSOE(ClientData clientData, Tcl_Interp* interp, int argc, G3_Cha
   else if (strcmp(argv[1], "MPIDiagonal") == 0) {
     setMPIDSOEFlag = true;
   }
+
+  else if (strcmp(argv[1], "NeighborDiagonal") == 0) {
+    theSOE = new NeighborDiagonalSOE(*new NeighborDiagonalSolver());
+  }
 #endif
 
   else {
@@ -302,6 +311,40 @@ specifySparseGen(G3_Runtime* rt, int argc, G3_Char ** const argv)
 }
 
 
+LinearSOE*
+specifySubstructure(G3_Runtime* rt, int argc, G3_Char ** const argv)
+{
+  // system Substructure <-parts $numParts> <-threads $numThreads>
+  Tcl_Interp *interp = G3_getInterpreter(rt);
+
+  int numParts   = 0;
+  int numThreads = 1;
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i], "-parts") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &numParts) != TCL_OK || numParts < 1) {
+        opserr << G3_ERROR_PROMPT << "invalid number of parts " << argv[i] << "\n";
+        return nullptr;
+      }
+    } else if (strcmp(argv[i], "-threads") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &numThreads) != TCL_OK || numThreads < 1) {
+        opserr << G3_ERROR_PROMPT << "invalid number of threads " << argv[i] << "\n";
+        return nullptr;
+      }
+    } else {
+      opserr << G3_ERROR_PROMPT << "unknown option " << argv[i] << " for system " << argv[1] << "\n";
+      return nullptr;
+    }
+  }
+
+  // by default one part per thread
+  if (numParts == 0)
+    numParts = numThreads;
+
+  SubstructureLinSolver *theSolver = new SubstructureLinSolver(numThreads);
+  return new SubstructureLinSOE(*theSolver, numParts);
+}
+
+
 #if 0 // Some misc solvers i play with
 
 else if (strcmp(argv[2],"Block") == 0) {
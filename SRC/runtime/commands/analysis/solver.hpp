@@ -37,6 +37,9 @@
 #include <SparseGenColLinSOE.h>
 //
 #include <SparseGenRowLinSOE.h>
+//
+#include <SubstructureLinSOE.h>
+#include <SubstructureLinSolver.h>
 // #include <SymSparseLinSOE.h>
 // #include <SymSparseLinSolver.h>
 #include <ArpackSOE.h>
@@ -92,6 +95,7 @@ typedef LinearSOE*(G3_SysOfEqnSpecifier)(G3_Runtime*, int, G3_Char**);
 // Specifiers defined in solver.cpp
 G3_SysOfEqnSpecifier specify_SparseSPD;
 G3_SysOfEqnSpecifier specifySparseGen;
+G3_SysOfEqnSpecifier specifySubstructure;
 TclDispatch<LinearSOE*> TclDispatch_newMumpsLinearSOE;
 // TclDispatch<LinearSOE*> TclDispatch_newUmfpackLinearSOE;
 LinearSOE* TclDispatch_newUmfpackLinearSOE(ClientData, Tcl_Interp*, int, const char** const);
@@ -134,6 +138,8 @@ std::unordered_map<std::string, struct soefps> soe_table = {
   {"sparsegeneral", {specifySparseGen, nullptr, nullptr}},
   {"superlu",       {specifySparseGen, nullptr, nullptr}},
 
+  {"substructure", {specifySubstructure, nullptr, nullptr}},
+
   {"sparsesym", {
      specify_SparseSPD, nullptr, nullptr}},
 
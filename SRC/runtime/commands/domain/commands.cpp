@@ -92,6 +92,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
 
   Tcl_CreateCommand(interp, "setTime",             &TclCommand_setTime,  domain, nullptr);
   Tcl_CreateCommand(interp, "getTime",             &TclCommand_getTime,  domain, nullptr);
+  Tcl_CreateCommand(interp, "criticalTimeStep",    &TclCommand_getCriticalTimeStep, domain, nullptr);
   Tcl_CreateCommand(interp, "setCreep",            &TclCommand_setCreep, nullptr, nullptr);
 
   // DAMPING
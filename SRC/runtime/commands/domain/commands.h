@@ -133,6 +133,7 @@ Tcl_CmdProc TclCommand_sensitivityAlgorithm;
 // Tcl_CmdProc stopTimer;
 Tcl_CmdProc TclCommand_getTime;
 Tcl_CmdProc TclCommand_setTime;
+Tcl_CmdProc TclCommand_getCriticalTimeStep;
 
 Tcl_CmdProc rayleighDamping;
 
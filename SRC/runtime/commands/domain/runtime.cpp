@@ -98,3 +98,18 @@ TclCommand_getTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
   return TCL_OK;
 }
 
+//
+// criticalTimeStep
+//   Return the estimated critical time step of the central difference
+//   method for the current state of the model, or 0 if none can be formed.
+//
+int
+TclCommand_getCriticalTimeStep(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+
+  Tcl_SetObjResult(interp, Tcl_NewDoubleObj(domain->getCriticalTimeStep()));
+  return TCL_OK;
+}
+
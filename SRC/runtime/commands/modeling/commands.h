@@ -18,6 +18,8 @@ extern Tcl_CmdProc  TclCommand_getNDF;
 extern Tcl_CmdProc  TclCommand_addNode;
 extern Tcl_CmdProc  TclCommand_addNodalMass;
 extern Tcl_CmdProc  TclCommand_addNodalLoad;
+// import.cpp
+extern Tcl_CmdProc  TclCommand_importMesh;
 // 
 extern Tcl_CmdProc  TclCommand_addSeries;
 extern Tcl_CmdProc  TclCommand_addPattern;
@@ -98,6 +100,7 @@ struct char_cmd {
   {"node",                 TclCommand_addNode},
   {"mass",                 TclCommand_addNodalMass},
   {"element",              TclCommand_addElement},
+  {"importMesh",           TclCommand_importMesh},
 
   {"print",                TclCommand_print},
   {"classType",            TclCommand_classType},
@@ -0,0 +1,38 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file implements the importMesh command, which reads
+// nodes and element blocks from a binary mesh file and adds them to the
+// model in bulk. See BasicModelBuilder::importMesh for the file format.
+//
+// Author: cmp
+//
+#include <assert.h>
+#include <tcl.h>
+#include <Logging.h>
+#include <Parsing.h>
+#include <BasicModelBuilder.h>
+
+int
+TclCommand_importMesh(ClientData clientData, Tcl_Interp *interp, int argc,
+                      TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(clientData);
+
+  if (argc != 2) {
+    opserr << G3_ERROR_PROMPT << "incorrect number of arguments, expected:\n";
+    opserr << "      importMesh fileName?\n";
+    return TCL_ERROR;
+  }
+
+  if (builder->importMesh(argv[1]) != 0) {
+    opserr << G3_ERROR_PROMPT << "failed to import mesh from " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
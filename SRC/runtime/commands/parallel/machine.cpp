@@ -3,6 +3,7 @@
 //        OpenSees - Open System for Earthquake Engineering Simulation
 //
 //===----------------------------------------------------------------------===//
+#include <string.h>
 #include <tcl.h>
 #include <OPS_Globals.h>
 #include <Channel.h>
@@ -10,12 +11,14 @@
 
 static int getPID(ClientData,  Tcl_Interp *, int, TCL_Char ** const argv);
 static int getNP( ClientData,  Tcl_Interp *, int, TCL_Char ** const argv);
+static int channelBatch(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 
 
 void Init_MachineRuntime(Tcl_Interp* interp, MachineBroker* theMachineBroker)
 {
   Tcl_CreateCommand(interp, "getNP",     &getNP,   (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "getPID",    &getPID,  (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "channelBatch", &channelBatch, (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
 }
 
 static int
@@ -49,4 +52,38 @@ getNP(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const arg
   return TCL_OK;
 }
 
+//
+// channelBatch $frameSize
+//   coalesce small messages to actors started after this command into
+//   frames of $frameSize doubles; 0 only counts messages, -1 turns it off
+//
+// channelBatch -print <-tags>
+//   print the messages and bytes sent on each actor channel
+//
+static int
+channelBatch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  MachineBroker* theMachineBroker = (MachineBroker*)clientData;
+  if (theMachineBroker == nullptr)
+    return TCL_OK;
 
+  if (argc < 2) {
+    opserr << "WARNING want - channelBatch frameSize? or channelBatch -print <-tags>\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1], "-print") == 0) {
+    int flag = (argc > 2 && strcmp(argv[2], "-tags") == 0) ? 1 : 0;
+    theMachineBroker->Print(opserr, flag);
+    return TCL_OK;
+  }
+
+  int frameSize;
+  if (Tcl_GetInt(interp, argv[1], &frameSize) != TCL_OK) {
+    opserr << "WARNING channelBatch - invalid frameSize " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  theMachineBroker->setChannelBatching(frameSize);
+  return TCL_OK;
+}
@@ -7,6 +7,7 @@
 //
 #include <tcl.h>
 #include <vector>
+#include <string.h>
 #include <OPS_Globals.h>
 // #include <mpi.h>
 #include <Channel.h>
@@ -14,6 +15,7 @@
 
 // #  include <DistributedDisplacementControl.h>
 // #  include <ShedHeaviest.h>
+#include <CostBalancer.h>
 // #  include <MPIDiagonalSOE.h>
 // #  include <MPIDiagonalSolver.h>
 #include <ShadowSubdomain.h>
@@ -37,7 +39,7 @@
    FEM_ObjectBroker    *broker             = nullptr;
    DomainPartitioner   *DOMAIN_partitioner = nullptr;
    GraphPartitioner    *GRAPH_partitioner  = nullptr;
-// LoadBalancer        *balancer           = nullptr;
+   LoadBalancer        *balancer           = nullptr;
    Channel             **channels          = nullptr;  
    int  num_subdomains    = 0;
    bool partitioned       = false;
@@ -89,10 +91,30 @@ opsPartition(ClientData clientData, Tcl_Interp *interp, int argc,
 {
   PartitionRuntime& part = *static_cast<PartitionRuntime*>(clientData);
 
-  int eleTag;
-  if (argc == 2) {
-    if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK) {
-      ;
+  // partition <eleTag> <-balance period <tolerance> <maxMoves>>
+  int eleTag = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-balance") == 0) {
+      int period = 10, maxMoves = 0;
+      double tolerance = 0.1;
+      if (i + 1 < argc && Tcl_GetInt(interp, argv[i + 1], &period) == TCL_OK) {
+        i++;
+        if (i + 1 < argc && Tcl_GetDouble(interp, argv[i + 1], &tolerance) == TCL_OK) {
+          i++;
+          if (i + 1 < argc && Tcl_GetInt(interp, argv[i + 1], &maxMoves) == TCL_OK)
+            i++;
+        }
+      }
+      Tcl_ResetResult(interp);
+      if (part.DOMAIN_partitioner != nullptr) {
+        opserr << "WARNING partition -balance must be given before the model is partitioned\n";
+        return TCL_ERROR;
+      }
+      part.balancer = new CostBalancer(period, tolerance, maxMoves);
+
+    } else if (Tcl_GetInt(interp, argv[i], &eleTag) != TCL_OK) {
+      opserr << "WARNING partition <eleTag> <-balance period <tolerance> <maxMoves>> - invalid argument " << argv[i] << "\n";
+      return TCL_ERROR;
     }
   }
   partitionModel(part, eleTag);
@@ -127,7 +149,10 @@ partitionModel(PartitionRuntime& part, int eleTag)
     //      part.balancer = new ShedHeaviest();
     // OPS_DOMAIN_partitioner = new DomainPartitioner(*OPS_GRAPH_partitioner, *part.balancer);
     part.GRAPH_partitioner = new Metis;
-    part.DOMAIN_partitioner = new DomainPartitioner(*part.GRAPH_partitioner);
+    if (part.balancer != nullptr)
+      part.DOMAIN_partitioner = new DomainPartitioner(*part.GRAPH_partitioner, *part.balancer);
+    else
+      part.DOMAIN_partitioner = new DomainPartitioner(*part.GRAPH_partitioner);
     part.theDomain.setPartitioner(part.DOMAIN_partitioner);
   }
 
@@ -15,11 +15,22 @@ namespace py = pybind11;
 #include <elementAPI.h> // G3_getRuntime/SafeBuilder
 #include <runtime/runtime/BasicModelBuilder.h>
 
+#include <cmath>
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <vector>
+#include <string>
+
 #include <Domain.h>
 #include <Vector.h>
 #include <Node.h>
+#include <NodeIter.h>
 #include <NodeData.h>
 #include <Element.h>
+#include <Response.h>
+#include <Information.h>
+#include <DummyStream.h>
 #include <SectionForceDeformation.h>
 #include <UniaxialMaterial.h>
 #include <NDMaterial.h>
@@ -216,6 +227,200 @@ copy_matrix(Matrix matrix)
 }
 
 
+//
+// BULK STATE ACCESS
+//
+// Responses of many nodes or elements are written to a single 2D array
+// in one call, without going through the interpreter. Rows follow the
+// order of the given tags, or the order of Domain::getNodes() when no
+// tags are given; entries past the size of a row's response are NaN.
+// An output array of the right shape may be passed to avoid allocating.
+//
+static NodeData
+get_node_data(const std::string &type)
+{
+  if (type == "displ" || type == "disp")
+    return NodeData::Disp;
+  else if (type == "veloc" || type == "vel")
+    return NodeData::Vel;
+  else if (type == "accel")
+    return NodeData::Accel;
+  else if (type == "react" || type == "reaction")
+    return NodeData::Reaction;
+  else if (type == "incrDisp")
+    return NodeData::IncrDisp;
+  else if (type == "unbalance")
+    return NodeData::UnbalancedLoad;
+
+  throw py::value_error("unknown node response '" + type + "'");
+}
+
+static py::array_t<double>
+get_output(py::object out, py::ssize_t rows, py::ssize_t cols)
+{
+  if (out.is_none())
+    return py::array_t<double>({rows, cols});
+
+  // casting anything else would silently fill a converted copy
+  if (!py::isinstance<py::array_t<double, py::array::c_style>>(out))
+    throw py::type_error("output must be a C-contiguous array of float64");
+
+  auto array = py::cast<py::array_t<double, py::array::c_style>>(out);
+  if (array.ndim() != 2 || array.shape(0) != rows || array.shape(1) < cols)
+    throw py::value_error("output array has incorrect shape");
+  return array;
+}
+
+static py::array_t<int>
+get_node_tags(Domain &domain)
+{
+  py::array_t<int> tags(domain.getNumNodes());
+  int *ptr = tags.mutable_data();
+  Node *theNode;
+  NodeIter &theNodes = domain.getNodes();
+  while ((theNode = theNodes()) != nullptr)
+    *ptr++ = theNode->getTag();
+  return tags;
+}
+
+static py::array_t<double>
+get_node_responses(Domain &domain, const std::string &type, py::object tags, py::object out)
+{
+  const NodeData data = get_node_data(type);
+
+  // gather the nodes and the widest response
+  std::vector<Node*> nodes;
+  if (tags.is_none()) {
+    nodes.reserve(domain.getNumNodes());
+    Node *theNode;
+    NodeIter &theNodes = domain.getNodes();
+    while ((theNode = theNodes()) != nullptr)
+      nodes.push_back(theNode);
+  } else {
+    auto tagArray = py::cast<py::array_t<int, ARRAY_FLAGS>>(tags);
+    const int *tag = tagArray.data();
+    nodes.resize(tagArray.size());
+    for (py::ssize_t i=0; i<tagArray.size(); i++) {
+      nodes[i] = domain.getNode(tag[i]);
+      if (nodes[i] == nullptr)
+        throw py::key_error("no node with tag " + std::to_string(tag[i]));
+    }
+  }
+
+  int width = 0;
+  for (Node *node : nodes)
+    width = std::max(width, node->getNumberDOF());
+
+  py::array_t<double> array = get_output(out, nodes.size(), width);
+  const py::ssize_t cols = array.shape(1);
+  double *ptr = array.mutable_data();
+  {
+    py::gil_scoped_release release;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (size_t i=0; i<nodes.size(); i++) {
+      double *row = ptr + i*cols;
+      const Vector *response = nodes[i]->getResponse(data);
+      int n = response != nullptr ? response->Size() : 0;
+      for (int j=0; j<n && j<cols; j++)
+        row[j] = (*response)(j);
+      for (py::ssize_t j=n; j<cols; j++)
+        row[j] = nan;
+    }
+  }
+  return array;
+}
+
+//
+// Return a view of the storage of one node response. The view aliases
+// the node's own storage, so it is only valid while the node exists and
+// its number of DOFs is unchanged.
+//
+static py::array_t<double>
+view_node_response(py::object self, int tag, const std::string &type)
+{
+  Domain &domain = py::cast<Domain&>(self);
+  Node *node = domain.getNode(tag);
+  if (node == nullptr)
+    throw py::key_error("no node with tag " + std::to_string(tag));
+
+  Vector *response = const_cast<Vector*>(node->getResponse(get_node_data(type)));
+  if (response == nullptr || response->Size() == 0)
+    return py::array_t<double>(0);
+
+  return py::array_t<double>({response->Size()}, {sizeof(double)}, &(*response)(0), self);
+}
+
+//
+// A set of element responses, parsed once with Element::setResponse()
+// and evaluated together by fill(). The Response objects refer to the
+// elements directly, so the set must not outlive them.
+//
+class ElementResponseSet {
+public:
+  ElementResponseSet(Domain &domain, py::array_t<int, ARRAY_FLAGS> tags, const std::vector<std::string> &args)
+  {
+    std::vector<const char *> argv;
+    for (const std::string &arg : args)
+      argv.push_back(arg.c_str());
+
+    DummyStream dummy;
+    const int *tag = tags.data();
+    responses.reserve(tags.size());
+    for (py::ssize_t i=0; i<tags.size(); i++) {
+      Element *theEle = domain.getElement(tag[i]);
+      if (theEle == nullptr)
+        throw py::key_error("no element with tag " + std::to_string(tag[i]));
+      // a null response leaves a row of NaN
+      responses.push_back(theEle->setResponse(argv.data(), static_cast<int>(argv.size()), dummy));
+    }
+  }
+
+  ~ElementResponseSet()
+  {
+    for (Response *response : responses)
+      delete response;
+  }
+
+  ElementResponseSet(const ElementResponseSet&) = delete;
+  ElementResponseSet& operator=(const ElementResponseSet&) = delete;
+
+  py::array_t<double>
+  fill(py::object out)
+  {
+    std::vector<const Vector*> data(responses.size(), nullptr);
+    int width = 0;
+    {
+      py::gil_scoped_release release;
+      for (size_t i=0; i<responses.size(); i++) {
+        if (responses[i] == nullptr || responses[i]->getResponse() < 0)
+          continue;
+        data[i] = &responses[i]->getInformation().getData();
+        width = std::max(width, data[i]->Size());
+      }
+    }
+
+    py::array_t<double> array = get_output(out, responses.size(), width);
+    const py::ssize_t cols = array.shape(1);
+    double *ptr = array.mutable_data();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (size_t i=0; i<responses.size(); i++) {
+      double *row = ptr + i*cols;
+      int n = data[i] != nullptr ? data[i]->Size() : 0;
+      for (int j=0; j<n && j<cols; j++)
+        row[j] = (*data[i])(j);
+      for (py::ssize_t j=n; j<cols; j++)
+        row[j] = nan;
+    }
+    return array;
+  }
+
+  size_t size() const {return responses.size();}
+
+private:
+  std::vector<Response*> responses;
+};
+
+
 GroundMotion*
 quake2sees_motion(
     py::array_t<double,ARRAY_FLAGS> quake_array, 
@@ -486,6 +691,39 @@ init_obj_module(py::module &m)
     .def ("getHystereticBackbone", [](BasicModelBuilder& builder, int tag){
         return std::unique_ptr<HystereticBackbone, py::nodelete>(builder.getTypedObject<HystereticBackbone>(tag));
     })
+    .def ("addNodes", [](BasicModelBuilder& builder,
+                         py::array_t<int,    py::array::c_style | py::array::forcecast> tags,
+                         py::array_t<double, py::array::c_style | py::array::forcecast> crds) {
+        if (tags.size() > INT_MAX)
+          throw py::value_error("too many nodes for one call");
+        int n = tags.size();
+        if (crds.size() != (py::ssize_t)n*builder.getNDM())
+          throw py::value_error("coordinates must have shape (len(tags), ndm)");
+        if (builder.addNodes(n, tags.data(), crds.data()) != 0)
+          throw std::runtime_error("failed to add nodes");
+    }, py::arg("tags"), py::arg("coords"))
+    .def ("addElements", [](BasicModelBuilder& builder, std::string type,
+                            py::array_t<int, py::array::c_style | py::array::forcecast> tags,
+                            py::array_t<int, py::array::c_style | py::array::forcecast> connectivity,
+                            py::array_t<int, py::array::c_style | py::array::forcecast> matTags,
+                            std::vector<double> params, std::string option) {
+        if (tags.size() > INT_MAX || connectivity.size() > INT_MAX || params.size() > (std::size_t)INT_MAX)
+          throw py::value_error("too many elements or parameters for one call");
+        int n = tags.size();
+        if (n == 0)
+          return;
+        if (matTags.size() != n || connectivity.size() % n != 0)
+          throw py::value_error("connectivity and materials must have one row per element");
+        if (builder.addElements(type.c_str(), n, (int)(connectivity.size()/n),
+                                tags.data(), connectivity.data(), matTags.data(),
+                                params.data(), (int)params.size(), option.c_str()) != 0)
+          throw std::runtime_error("failed to add elements");
+    }, py::arg("type"), py::arg("tags"), py::arg("connectivity"), py::arg("materials"),
+       py::arg("params")=std::vector<double>{}, py::arg("option")="")
+    .def ("importMesh", [](BasicModelBuilder& builder, std::string file) {
+        if (builder.importMesh(file.c_str()) != 0)
+          throw std::runtime_error("failed to import mesh from " + file);
+    })
   ;
 
   py::class_<Domain>(m, "_Domain")
@@ -499,6 +737,20 @@ init_obj_module(py::module &m)
       return copy_vector(*domain.getNodeResponse(node, typ));
     })
     .def ("getTime", &Domain::getCurrentTime)
+    // bulk access
+    .def ("getNodeTags", &get_node_tags)
+    .def ("getNodeResponses", &get_node_responses,
+          py::arg("type"), py::arg("tags") = py::none(), py::arg("out") = py::none())
+    .def ("viewNodeResponse", &view_node_response, py::arg("tag"), py::arg("type"))
+    .def ("calculateNodalReactions", &Domain::calculateNodalReactions, py::arg("flag") = 0)
+  ;
+
+  py::class_<ElementResponseSet>(m, "ElementResponseSet")
+    .def (py::init<Domain&, py::array_t<int, ARRAY_FLAGS>, const std::vector<std::string>&>(),
+          py::arg("domain"), py::arg("tags"), py::arg("args"),
+          py::keep_alive<1, 2>())
+    .def ("fill", &ElementResponseSet::fill, py::arg("out") = py::none())
+    .def ("__len__", &ElementResponseSet::size)
   ;
   
   py::class_<G3_Runtime>(m, "_Runtime")
@@ -22,9 +22,13 @@
 #include <ConstraintHandler.h>
 #include <ConvergenceTest.h>
 #include <AnalysisModel.h>
+#include <ExplicitAnalysis.h>
 #include <TimeSeries.h>
 #include <LoadPattern.h>
 #include <float.h>
+#include <math.h>
+#include <Node.h>
+#include <NodeIter.h>
 
 // For eigen()
 #include <FE_EleIter.h>
@@ -70,6 +74,7 @@ BasicAnalysisBuilder::BasicAnalysisBuilder(Domain* domain)
   theStaticIntegrator(nullptr),
   theTransientIntegrator(nullptr),
   theTest(nullptr),
+  theExplicitAnalysis(nullptr),
  CurrentAnalysisFlag(EMPTY_ANALYSIS)
 {
   theAnalysisModel = new AnalysisModel();
@@ -121,10 +126,16 @@ BasicAnalysisBuilder::wipe()
       delete theEigenSOE;
       theEigenSOE = nullptr;
   }
+  if (theExplicitAnalysis != nullptr) {
+      delete theExplicitAnalysis;
+      theExplicitAnalysis = nullptr;
+      CurrentAnalysisFlag = EMPTY_ANALYSIS;
+  }
   if (theAnalysisModel != nullptr) {
     delete theAnalysisModel;
     theAnalysisModel = new AnalysisModel();
   }
+  modelStamp = 0;
 }
 
 void
@@ -145,6 +156,7 @@ BasicAnalysisBuilder::setLinks(CurrentAnalysis flag)
 
   switch (flag) {
   case EMPTY_ANALYSIS:
+  case EXPLICIT_ANALYSIS:
     break;
 
   case TRANSIENT_ANALYSIS:
@@ -212,6 +224,9 @@ BasicAnalysisBuilder::initialize(void)
       } else
         theTransientIntegrator->commit();
       break;
+
+    case EXPLICIT_ANALYSIS:
+      break;
   }
   theDomain->initialize();
 
@@ -227,6 +242,20 @@ BasicAnalysisBuilder::domainChanged(void)
 
   opsdbg << G3_DEBUG_PROMPT << "Domain changed\n";
 
+  // the explicit engine keeps its own numbering and does
+  // not use the AnalysisModel or LinearSOE
+  if (this->CurrentAnalysisFlag == EXPLICIT_ANALYSIS)
+    return theExplicitAnalysis->domainChanged();
+
+  // when only elements or single point constraints were added or removed
+  // since the model was last built, patch the FE_Elements instead of
+  // rebuilding
+  if (modelStamp != 0 && this->updateElements() == 0) {
+    modelStamp = stamp;
+    return 0;
+  }
+  modelStamp = 0;
+
   theAnalysisModel->clearAll();
   if (theHandler != nullptr) {
     theHandler->clearAll();
@@ -299,11 +328,63 @@ BasicAnalysisBuilder::domainChanged(void)
 //    return -5;
 //  }
 
+  modelStamp = stamp;
   return 0;
 }
 
+//
+// Update the analysis after elements and single point constraints alone
+// have been added to or removed from the domain. The DOF_Groups and 
+// equation numbers are kept, the handler patches the FE_Elements, and the
+// systems of equations are only resized when elements were added (the
+// sparsity of the removed elements is left in place). Returns non-zero
+// when a full rebuild is needed.
+//
 int
-BasicAnalysisBuilder::analyze(int num_steps, double size_steps)
+BasicAnalysisBuilder::updateElements(void)
+{
+  if (theHandler == nullptr)
+    return -1;
+
+  std::vector<Element*> added, removed;
+  std::vector<SP_Constraint*> addedSPs, removedSPs;
+  if (!theDomain->getElementChanges(modelStamp, added, removed) ||
+      !theDomain->getSP_Changes(modelStamp, addedSPs, removedSPs))
+    return -1;
+
+  // handlers that do not support a change leave the model untouched
+  if (theHandler->handleSP_Constraints(addedSPs, removedSPs) < 0)
+    return -1;
+
+  if (theHandler->handleElements(added, removed) < 0)
+    return -1;
+
+  opsdbg << G3_DEBUG_PROMPT << "Updated " << (int)added.size() << " added and "
+         << (int)removed.size() << " removed elements, "
+         << (int)addedSPs.size() << " added and " 
+         << (int)removedSPs.size() << " removed SP constraints\n";
+
+  if (!added.empty()) {
+    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    if (theSOE != nullptr && theSOE->setSize(theGraph) < 0)
+      return -1;
+    if (theEigenSOE != nullptr && theEigenSOE->setSize(theGraph) < 0)
+      return -1;
+    theAnalysisModel->clearDOFGraph();
+  }
+
+  switch (this->CurrentAnalysisFlag) {
+  case STATIC_ANALYSIS:
+    return theStaticIntegrator->domainChanged() < 0 ? -1 : 0;
+  case TRANSIENT_ANALYSIS:
+    return theTransientIntegrator->domainChanged() < 0 ? -1 : 0;
+  default:
+    return 0;
+  }
+}
+
+int
+BasicAnalysisBuilder::analyze(int num_steps, double size_steps, double safety)
 {
 
   switch (this->CurrentAnalysisFlag) {
@@ -313,12 +394,38 @@ BasicAnalysisBuilder::analyze(int num_steps, double size_steps)
       break;
 
     case TRANSIENT_ANALYSIS: {
+      // a non-positive step is the fraction safety of the
+      // critical step of a conditionally stable integrator
+      if (size_steps <= 0.0) {
+        int stamp = theDomain->hasDomainChanged();
+        if (stamp != domainStamp) {
+          domainStamp = stamp;
+          if (this->domainChanged() < 0)
+            return -1;
+        }
+        double dtCrit = 0.0;
+        if (theTransientIntegrator != nullptr)
+          dtCrit = theTransientIntegrator->getCriticalTimeStep();
+        if (dtCrit <= 0.0) {
+          opserr << G3_ERROR_PROMPT << "a time step is required, the current integrator "
+                 << "does not provide an estimate of the critical time step\n";
+          return -1;
+        }
+        size_steps = safety*dtCrit;
+      }
       // TODO: Set global timestep variable
       ops_Dt = size_steps;
       return this->analyzeTransient(num_steps, size_steps);
       break;
     }
 
+    case EXPLICIT_ANALYSIS: {
+      // ExplicitAnalysis sets ops_Dt itself when it picks the step
+      if (size_steps > 0.0)
+        ops_Dt = size_steps;
+      return theExplicitAnalysis->analyze(num_steps, size_steps);
+    }
+
     default:
       opserr << G3_ERROR_PROMPT << "No Analysis type has been specified \n";
       return -1;
@@ -625,6 +732,171 @@ BasicAnalysisBuilder::analyzeVariable(int numSteps, double dT, double dtMin, dou
   return 0;
 }
 
+//
+// Estimate the local truncation error of the trial step from the jump
+// in acceleration, e = C dT^2 (A_{n+1} - A_n), where C is the constant
+// of the integrator (Zienkiewicz and Xie, 1991). Translations and
+// rotations are measured separately, each against atol plus tol times
+// the largest norm of its displacements seen so far, uMax; the larger
+// of the two ratios is returned, so a step is acceptable below 1.
+//
+static double
+estimateStepError(Domain *theDomain, double C, double dT, double tol, double atol, double uMax[2])
+{
+  double eNorm[2] = {0.0, 0.0};
+  double uNorm[2] = {0.0, 0.0};
+
+  Node *theNode;
+  NodeIter &theNodes = theDomain->getNodes();
+  while ((theNode = theNodes()) != nullptr) {
+    const Vector &trialAccel = theNode->getTrialAccel();
+    const Vector &accel      = theNode->getAccel();
+    const Vector &trialDisp  = theNode->getTrialDisp();
+    const int ndm = theNode->getCrds().Size();
+    const int ndf = trialDisp.Size();
+    for (int i=0; i<ndf; i++) {
+      // group 1 holds the rotations of 2D and 3D frame nodes
+      const int g = ((ndm == 2 && ndf == 3 && i == 2)
+                  || (ndm == 3 && ndf >= 6 && i >= 3 && i < 6)) ? 1 : 0;
+      double da = trialAccel(i) - accel(i);
+      eNorm[g] += da*da;
+      uNorm[g] += trialDisp(i)*trialDisp(i);
+    }
+  }
+
+  double error = 0.0;
+  for (int g=0; g<2; g++) {
+    uNorm[g] = sqrt(uNorm[g]);
+    if (uNorm[g] > uMax[g])
+      uMax[g] = uNorm[g];
+    double e = C*dT*dT*sqrt(eNorm[g])/(atol + tol*uMax[g]);
+    if (e > error)
+      error = e;
+  }
+  return error;
+}
+
+//
+// Advance numSteps*dT in time with steps chosen from an estimate of the
+// local truncation error. A converged step is accepted if its error is
+// below atol + tol*|U|, and the next step is scaled by
+// 0.9*(1/error)^(1/3), limited to a factor between 1/4 and 2 and to
+// [dtMin, dtMax]. Steps which fail to converge are halved until dtMin
+// is reached. The integrator must provide the error constant.
+//
+int
+BasicAnalysisBuilder::analyzeAdaptive(int numSteps, double dT, double dtMin, double dtMax, double tol, double atol)
+{
+  const double totalTimeIncr = numSteps * dT;
+  double currentTimeIncr = 0.0;
+  double currentDt = dT;
+  double uMax[2] = {0.0, 0.0};
+
+  const double C = theTransientIntegrator->getLocalErrorConstant();
+  if (C <= 0.0) {
+    opserr << "BasicAnalysisBuilder::analyzeAdaptive() - the integrator "
+           << "provides no estimate of the local error\n";
+    return -1;
+  }
+
+  adaptiveStats = AdaptiveStatistics{};
+  adaptiveStats.minDt = DBL_MAX;
+
+  while (totalTimeIncr - currentTimeIncr > 1.0e-12*totalTimeIncr) {
+
+    // do not step past the end of the requested interval
+    double stepDt = currentDt;
+    if (stepDt > totalTimeIncr - currentTimeIncr)
+      stepDt = totalTimeIncr - currentTimeIncr;
+
+    if (theAnalysisModel->analysisStep(stepDt) < 0) {
+      opserr << "BasicAnalysisBuilder::analyzeAdaptive() - the AnalysisModel failed";
+      opserr << " at time " << theDomain->getCurrentTime() << "\n";
+      theDomain->revertToLastCommit();
+      return -2;
+    }
+
+    // check if domain has undergone change
+    int stamp = theDomain->hasDomainChanged();
+    if (stamp != domainStamp) {
+      domainStamp = stamp;
+      if (this->domainChanged() < 0) {
+        opserr << "BasicAnalysisBuilder::analyzeAdaptive() - domainChanged() failed\n";
+        return -1;
+      }
+    }
+
+    int result = 0;
+    if (theTransientIntegrator->newStep(stepDt) < 0)
+      result = -2;
+    else if (theAlgorithm->solveCurrentStep() < 0)
+      result = -3;
+
+    // cut the step if the solution failed
+    if (result < 0) {
+      theDomain->revertToLastCommit();
+      theTransientIntegrator->revertToLastStep();
+      adaptiveStats.numFailed++;
+      if (stepDt <= dtMin) {
+        opserr << "BasicAnalysisBuilder::analyzeAdaptive() - ";
+        opserr << " failed at time " << theDomain->getCurrentTime() << "\n";
+        return result;
+      }
+      currentDt = (0.5*stepDt > dtMin) ? 0.5*stepDt : dtMin;
+      continue;
+    }
+
+    double error = estimateStepError(theDomain, C, stepDt, tol, atol, uMax);
+    double factor = (error > 0.0) ? 0.9*cbrt(1.0/error) : 2.0;
+    if (factor > 2.0)
+      factor = 2.0;
+    else if (factor < 0.25)
+      factor = 0.25;
+
+    // repeat the step if the error is too large, unless the step
+    // cannot be reduced any further
+    if (error > 1.0 && stepDt > dtMin) {
+      theDomain->revertToLastCommit();
+      theTransientIntegrator->revertToLastStep();
+      adaptiveStats.numRejected++;
+      currentDt = (factor*stepDt > dtMin) ? factor*stepDt : dtMin;
+      continue;
+    }
+
+    if (theTransientIntegrator->commit() < 0) {
+      opserr << "BasicAnalysisBuilder::analyzeAdaptive() - ";
+      opserr << "the Integrator failed to commit";
+      opserr << " at time " << theDomain->getCurrentTime() << "\n";
+      theDomain->revertToLastCommit();
+      theTransientIntegrator->revertToLastStep();
+      return -4;
+    }
+
+    currentTimeIncr += stepDt;
+    adaptiveStats.numAccepted++;
+    if (stepDt < adaptiveStats.minDt)
+      adaptiveStats.minDt = stepDt;
+    if (stepDt > adaptiveStats.maxDt)
+      adaptiveStats.maxDt = stepDt;
+    if (error > adaptiveStats.maxError)
+      adaptiveStats.maxError = error;
+
+    // a step shortened to reach the end of the interval
+    // says nothing about the size of the next one
+    if (stepDt == currentDt)
+      currentDt = factor*stepDt;
+    if (currentDt < dtMin)
+      currentDt = dtMin;
+    else if (currentDt > dtMax)
+      currentDt = dtMax;
+  }
+
+  if (adaptiveStats.numAccepted == 0)
+    adaptiveStats.minDt = 0.0;
+
+  return 0;
+}
+
 
 void
 BasicAnalysisBuilder::set(ConstraintHandler* obj)
@@ -633,6 +905,7 @@ BasicAnalysisBuilder::set(ConstraintHandler* obj)
     delete theHandler;
 
   theHandler = obj;
+  modelStamp = 0;
 }
 
 void
@@ -646,7 +919,7 @@ BasicAnalysisBuilder::set(DOF_Numberer* obj)
   theNumberer = obj;
   theNumberer->setLinks(*theAnalysisModel);
 
-  domainStamp = 0;
+  domainStamp = modelStamp = 0;
   return;
 }
 
@@ -684,7 +957,7 @@ BasicAnalysisBuilder::set(LinearSOE* obj, bool free)
     theEigenSOE->setLinearSOE(*theSOE);
 
 
-  domainStamp = 0;
+  domainStamp = modelStamp = 0;
 }
 
 
@@ -708,7 +981,7 @@ BasicAnalysisBuilder::set(StaticIntegrator& obj)
     theStaticIntegrator->domainChanged();
 
   else
-    domainStamp = 0;
+    domainStamp = modelStamp = 0;
 }
 
 void
@@ -728,7 +1001,7 @@ BasicAnalysisBuilder::set(TransientIntegrator& obj, bool free)
     theTransientIntegrator->domainChanged();
 
   else
-    domainStamp = 0;
+    domainStamp = modelStamp = 0;
 }
 
 void
@@ -759,11 +1032,21 @@ BasicAnalysisBuilder::set(EigenSOE &theNewSOE)
     theEigenSOE->setLinks(*theAnalysisModel);
     theEigenSOE->setLinearSOE(*theSOE);
 
-    domainStamp = 0;
+    domainStamp = modelStamp = 0;
   }
 
 }
 
+void
+BasicAnalysisBuilder::set(ExplicitAnalysis* obj)
+{
+  if (theExplicitAnalysis != nullptr && theExplicitAnalysis != obj)
+    delete theExplicitAnalysis;
+
+  theExplicitAnalysis = obj;
+  domainStamp = modelStamp = 0;
+}
+
 void
 BasicAnalysisBuilder::fillDefaults(BasicAnalysisBuilder::CurrentAnalysis flag)
 {
@@ -781,6 +1064,9 @@ BasicAnalysisBuilder::fillDefaults(BasicAnalysisBuilder::CurrentAnalysis flag)
       if (theTransientIntegrator == nullptr)
           theTransientIntegrator = new Newmark(0.5,0.25);
       break;
+
+    case EXPLICIT_ANALYSIS:
+      return;
   }
 
   if (theTest == nullptr)
@@ -812,7 +1098,7 @@ BasicAnalysisBuilder::fillDefaults(BasicAnalysisBuilder::CurrentAnalysis flag)
 int
 BasicAnalysisBuilder::setStaticAnalysis()
 {
-  domainStamp = 0;
+  domainStamp = modelStamp = 0;
   this->fillDefaults(STATIC_ANALYSIS);
   this->setLinks(STATIC_ANALYSIS);
 
@@ -824,7 +1110,7 @@ BasicAnalysisBuilder::setStaticAnalysis()
 int
 BasicAnalysisBuilder::setTransientAnalysis()
 {
-  domainStamp = 0;
+  domainStamp = modelStamp = 0;
   this->CurrentAnalysisFlag = TRANSIENT_ANALYSIS;
   this->fillDefaults(TRANSIENT_ANALYSIS);
   this->setLinks(TRANSIENT_ANALYSIS);
@@ -832,6 +1118,14 @@ BasicAnalysisBuilder::setTransientAnalysis()
   return 1;
 }
 
+int
+BasicAnalysisBuilder::setExplicitAnalysis(ExplicitAnalysis* obj)
+{
+  this->set(obj);
+  this->CurrentAnalysisFlag = EXPLICIT_ANALYSIS;
+  return 0;
+}
+
 int
 BasicAnalysisBuilder::newTransientAnalysis()
 {
@@ -867,7 +1161,7 @@ BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
   }
 
   if (theEigenSOE == nullptr) {
-    domainStamp = 0;
+    domainStamp = modelStamp = 0;
     if (typeSolver == EigenSOE_TAGS_SymBandEigenSOE) {
       SymBandEigenSolver *theEigenSolver = new SymBandEigenSolver();
       theEigenSOE = new SymBandEigenSOE(*theEigenSolver, *theAnalysisModel);
@@ -908,6 +1202,7 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
     //domainStamp = stamp; // commented out so domainChanged() gets called with integrator,
                          //  which isnt updated here
 //    result = this->domainChanged();
+    modelStamp = 0;
 
     theAnalysisModel->clearAll();
     theHandler->clearAll();
@@ -1039,6 +1334,12 @@ BasicAnalysisBuilder::getConvergenceTest()
   return theTest;
 }
 
+ExplicitAnalysis*
+BasicAnalysisBuilder::getExplicitAnalysis()
+{
+  return theExplicitAnalysis;
+}
+
 int
 BasicAnalysisBuilder::formUnbalance()
 {
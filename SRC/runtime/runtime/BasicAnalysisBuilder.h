@@ -17,6 +17,7 @@
 // - StaticIntegrator          *theStaticIntegrator;
 // - TransientIntegrator       *theTransientIntegrator;
 // - ConvergenceTest           *theTest;
+// - ExplicitAnalysis          *theExplicitAnalysis;
 //
 // The BasicAnalysisBuilder assumes responsibility for
 // deleting these objects, but ownership of the SOE may be
@@ -38,6 +39,7 @@ class EigenSOE;
 class StaticIntegrator;
 class TransientIntegrator;
 class ConvergenceTest;
+class ExplicitAnalysis;
 
 class BasicAnalysisBuilder
 {
@@ -48,7 +50,8 @@ public:
     enum CurrentAnalysis {
       EMPTY_ANALYSIS,
       STATIC_ANALYSIS, 
-      TRANSIENT_ANALYSIS
+      TRANSIENT_ANALYSIS,
+      EXPLICIT_ANALYSIS
     };
 
     void set(ConstraintHandler* obj);
@@ -59,6 +62,7 @@ public:
     void set(TransientIntegrator& obj, bool free=true);
     void set(ConvergenceTest* obj);
     void set(EigenSOE& obj);
+    void set(ExplicitAnalysis* obj);
 
     LinearSOE* getLinearSOE();
 
@@ -68,6 +72,7 @@ public:
     int  newTransientAnalysis();
     int  setStaticAnalysis();
     int  setTransientAnalysis();
+    int  setExplicitAnalysis(ExplicitAnalysis* obj);
 
     //   Eigen
     void newEigenAnalysis(int typeSolver, double shift);
@@ -80,17 +85,32 @@ public:
     StaticIntegrator*    getStaticIntegrator();
     TransientIntegrator* getTransientIntegrator();
     ConvergenceTest*     getConvergenceTest();
+    ExplicitAnalysis*    getExplicitAnalysis();
 
     int domainChanged();
 
     // Performing analysis
-    int analyze(int num_steps, double size_steps=0.0);
+    // a transient analysis without size_steps takes safety
+    // times the critical step of the integrator
+    int analyze(int num_steps, double size_steps=0.0, double safety=0.9);
     int analyzeStatic(int num_steps);
     
     int analyzeTransient(int numSteps, double dT);
     int analyzeStep(double dT);
     int analyzeSubLevel(int level, double dT);
     int analyzeVariable(int numSteps, double dT, double dtMin, double dtMax, int Jd);
+    int analyzeAdaptive(int numSteps, double dT, double dtMin, double dtMax, double tol, double atol=1.0e-8);
+
+    // Statistics of the last call to analyzeAdaptive()
+    struct AdaptiveStatistics {
+      int    numAccepted = 0;    // converged steps meeting the error tolerance
+      int    numRejected = 0;    // converged steps repeated for excess error
+      int    numFailed   = 0;    // steps repeated because the solution failed
+      double minDt       = 0.0;  // smallest accepted step
+      double maxDt       = 0.0;  // largest accepted step
+      double maxError    = 0.0;  // largest error of an accepted step over atol + tol*|U|
+    };
+    const AdaptiveStatistics& getAdaptiveStatistics() const {return adaptiveStats;};
 
     void wipe();
 
@@ -100,6 +120,7 @@ public:
 private:
     void setLinks(CurrentAnalysis flag = EMPTY_ANALYSIS);
     void fillDefaults(enum CurrentAnalysis flag);
+    int  updateElements(void);
 
     Domain                    *theDomain;
     ConstraintHandler         *theHandler;
@@ -111,8 +132,10 @@ private:
     StaticIntegrator          *theStaticIntegrator;
     TransientIntegrator       *theTransientIntegrator;
     ConvergenceTest           *theTest;
+    ExplicitAnalysis          *theExplicitAnalysis;
 
     int domainStamp;
+    int modelStamp = 0;   // stamp at which the AnalysisModel was last updated
     int numEigen = 0;
 
     int numSubLevels = 0;
@@ -121,6 +144,8 @@ private:
     bool freeSOE = true;
     bool freeTI  = true;
 
+    AdaptiveStatistics adaptiveStats;
+
 };
 
 #endif
@@ -95,6 +95,22 @@ public:
 
   int buildFE_Model();
 
+  //
+  // Bulk mesh ingestion
+  //
+  // Nodes are given as numNodes tags and numNodes*ndm coordinates.
+  // Elements of one type are given as numElements tags, 
+  // numElements*numElementNodes node tags and numElements material
+  // (or section) tags; params and option are shared by the block.
+  // Each call checks its input in a single pass before anything
+  // is added to the domain.
+  int addNodes(int numNodes, const int *tags, const double *crds);
+  int addElements(const char *type, int numElements, int numElementNodes,
+                  const int *tags, const int *connectivity, const int *matTags,
+                  const double *params=nullptr, int numParams=0, 
+                  const char *option=nullptr);
+  int importMesh(const char *fileName);
+
 // 
 private:
   int   addRegistryObject(const char*, int tag, void* obj); 
@@ -0,0 +1,465 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Bulk mesh ingestion for the BasicModelBuilder. Nodes and
+// blocks of elements of a single type are created from flat arrays
+// without going through the interpreter. The input of each call is checked
+// in one pass (duplicate tags, missing nodes and missing materials are
+// detected on sorted, de-duplicated copies of the tag arrays) before any
+// object is created, and the objects are then handed to the Domain in a
+// single batch. importMesh() reads and checks a whole file the same way
+// before it adds anything.
+//
+// The binary format read by importMesh() is, in native byte order,
+//
+//   char[8]   "OPSMESH1"
+//   int32     ndm, numNodes, numBlocks
+//   int32     nodeTags[numNodes]
+//   float64   coords[numNodes*ndm]
+//
+// followed by numBlocks element blocks of the form
+//
+//   char[32]  element type, e.g. "quad"
+//   char[32]  option, e.g. "PlaneStrain"; may be empty
+//   int32     numElements, numElementNodes, numParams
+//   float64   params[numParams]
+//   int32     eleTags[numElements]
+//   int32     connectivity[numElements*numElementNodes]
+//   int32     matTags[numElements]
+//
+// Supported element types and their block parameters are
+//
+//   Truss       2 nodes, uniaxialMaterial, {A, <rho>}
+//   quad        4 nodes, nDMaterial,       {thk, <p, rho, b1, b2>}
+//   tri31       3 nodes, nDMaterial,       {thk, <p, rho, b1, b2>}
+//   stdBrick    8 nodes, nDMaterial,       {<b1, b2, b3>}
+//   ShellMITC4  4 nodes, section,          {}
+//
+// Written: cmp
+//
+#include <stdio.h>
+#include <limits.h>
+#include <string.h>
+#include <strings.h>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <Truss.h>
+#include <FourNodeQuad.h>
+#include <Tri31.h>
+#include <Brick.h>
+#include <ShellMITC4.h>
+#include <BasicModelBuilder.h>
+
+namespace {
+
+enum class BulkMaterial {Uniaxial, ND, Section};
+
+struct BulkElementType {
+  const char  *name;
+  int          numNodes;
+  BulkMaterial material;
+};
+
+const BulkElementType bulk_element_types[] = {
+  {"Truss",      2, BulkMaterial::Uniaxial},
+  {"quad",       4, BulkMaterial::ND},
+  {"tri31",      3, BulkMaterial::ND},
+  {"stdBrick",   8, BulkMaterial::ND},
+  {"ShellMITC4", 4, BulkMaterial::Section}
+};
+
+// sorted copy of tags with duplicates removed; returns the
+// first duplicate in `duplicate` if there is one
+std::vector<int>
+sortedTags(const int *tags, int n, int *duplicate=nullptr)
+{
+  std::vector<int> sorted(tags, tags+n);
+  std::sort(sorted.begin(), sorted.end());
+  auto last = std::adjacent_find(sorted.begin(), sorted.end());
+  if (duplicate != nullptr && last != sorted.end())
+    *duplicate = *last;
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+  return sorted;
+}
+
+double
+param(const double *params, int numParams, int i, double value)
+{
+  return i < numParams ? params[i] : value;
+}
+
+Element *
+newBulkElement(int type, int tag, const int *nodes, void *material,
+               const double *params, int numParams, const char *option, int ndm)
+{
+  switch (type) {
+    case 0:
+      return new Truss(tag, ndm, nodes[0], nodes[1], *(UniaxialMaterial*)material,
+                       params[0], param(params, numParams, 1, 0.0));
+    case 1:
+      return new FourNodeQuad(tag, nodes[0], nodes[1], nodes[2], nodes[3],
+                              *(NDMaterial*)material, option, params[0],
+                              param(params, numParams, 1, 0.0),
+                              param(params, numParams, 2, 0.0),
+                              param(params, numParams, 3, 0.0),
+                              param(params, numParams, 4, 0.0));
+    case 2: {
+      std::array<int,3> triNodes {nodes[0], nodes[1], nodes[2]};
+      return new Tri31(tag, triNodes, *(NDMaterial*)material, option, params[0],
+                       param(params, numParams, 1, 0.0),
+                       param(params, numParams, 2, 0.0),
+                       param(params, numParams, 3, 0.0),
+                       param(params, numParams, 4, 0.0));
+    }
+    case 3:
+      return new Brick(tag, nodes[0], nodes[1], nodes[2], nodes[3],
+                            nodes[4], nodes[5], nodes[6], nodes[7],
+                       *(NDMaterial*)material,
+                       param(params, numParams, 0, 0.0),
+                       param(params, numParams, 1, 0.0),
+                       param(params, numParams, 2, 0.0));
+    case 4:
+      return new ShellMITC4(tag, nodes[0], nodes[1], nodes[2], nodes[3],
+                            *(SectionForceDeformation*)material);
+  }
+  return nullptr;
+}
+
+// check that a batch of node tags is free of duplicates and not already
+// in the domain; the sorted tags are returned in `sorted`
+int
+checkNodes(Domain &theDomain, int numNodes, const int *tags, std::vector<int> &sorted)
+{
+  int duplicate = 0;
+  sorted = sortedTags(tags, numNodes, &duplicate);
+  if ((int)sorted.size() != numNodes) {
+    opserr << "WARNING node " << duplicate << " is given more than once\n";
+    return -1;
+  }
+  for (int tag : sorted)
+    if (theDomain.getNode(tag) != nullptr) {
+      opserr << "WARNING node with tag " << tag << " already exists in model\n";
+      return -1;
+    }
+  return 0;
+}
+
+// check a block of elements against the model. The nodes must be in the
+// domain or among newNodes, the sorted tags of nodes that are added
+// together with the block. Returns the index of the element type, with
+// the sorted material tags of the block and the materials they refer to,
+// or -1 if the block is invalid.
+int
+checkElementBlock(const BasicModelBuilder &builder, const char *type,
+                  int numElements, int numElementNodes,
+                  const int *tags, const int *connectivity, const int *matTags,
+                  int numParams, const std::vector<int> &newNodes,
+                  std::vector<int> &materialTags, std::vector<void*> &materials)
+{
+  constexpr int numTypes = sizeof(bulk_element_types)/sizeof(BulkElementType);
+  int kind = 0;
+  while (kind < numTypes && strcasecmp(type, bulk_element_types[kind].name) != 0)
+    kind++;
+
+  if (kind == numTypes) {
+    opserr << "WARNING element type " << type << " is not supported for bulk import\n";
+    return -1;
+  }
+
+  const int ndm = builder.getNDM();
+  const int ndf = builder.getNDF();
+  const BulkElementType &info = bulk_element_types[kind];
+  if (numElementNodes != info.numNodes) {
+    opserr << "WARNING element type " << type << " expects " << info.numNodes
+           << " nodes, got " << numElementNodes << "\n";
+    return -1;
+  }
+  if ((kind == 0 || kind == 1 || kind == 2) && numParams < 1) {
+    opserr << "WARNING element type " << type << " requires at least one parameter\n";
+    return -1;
+  }
+  if ((kind == 1 || kind == 2) && (ndm != 2 || ndf != 2)) {
+    opserr << "WARNING element type " << type << " requires ndm 2 and ndf 2\n";
+    return -1;
+  }
+  if (kind == 3 && (ndm != 3 || ndf != 3)) {
+    opserr << "WARNING element type " << type << " requires ndm 3 and ndf 3\n";
+    return -1;
+  }
+  if (kind == 4 && (ndm != 3 || ndf != 6)) {
+    opserr << "WARNING element type " << type << " requires ndm 3 and ndf 6\n";
+    return -1;
+  }
+  if (numElements > INT_MAX/numElementNodes) {
+    opserr << "WARNING block of " << numElements << " elements of type " << type << " is too large\n";
+    return -1;
+  }
+
+  materialTags.clear();
+  materials.clear();
+  if (numElements <= 0)
+    return kind;
+
+  Domain &theDomain = *builder.getDomain();
+
+  int duplicate = 0;
+  std::vector<int> sorted = sortedTags(tags, numElements, &duplicate);
+  if ((int)sorted.size() != numElements) {
+    opserr << "WARNING element " << duplicate << " is given more than once\n";
+    return -1;
+  }
+  for (int tag : sorted)
+    if (theDomain.getElement(tag) != nullptr) {
+      opserr << "WARNING element with tag " << tag << " already exists in model\n";
+      return -1;
+    }
+
+  // each node referenced by the block is looked up once
+  for (int tag : sortedTags(connectivity, numElements*numElementNodes))
+    if (!std::binary_search(newNodes.begin(), newNodes.end(), tag)
+        && theDomain.getNode(tag) == nullptr) {
+      opserr << "WARNING node " << tag << " is referenced by an element but does not exist\n";
+      return -1;
+    }
+
+  // as is each material
+  materialTags = sortedTags(matTags, numElements);
+  materials.resize(materialTags.size());
+  for (std::size_t i=0; i<materialTags.size(); i++) {
+    int tag = materialTags[i];
+    switch (info.material) {
+      case BulkMaterial::Uniaxial:
+        materials[i] = builder.getTypedObject<UniaxialMaterial>(tag, BasicModelBuilder::SilentLookup); break;
+      case BulkMaterial::ND:
+        materials[i] = builder.getTypedObject<NDMaterial>(tag, BasicModelBuilder::SilentLookup);       break;
+      case BulkMaterial::Section:
+        materials[i] = builder.getTypedObject<SectionForceDeformation>(tag, BasicModelBuilder::SilentLookup); break;
+    }
+    if (materials[i] == nullptr) {
+      opserr << "WARNING material " << tag << " not found for element type " << type << "\n";
+      return -1;
+    }
+  }
+
+  return kind;
+}
+
+} // namespace
+
+
+int
+BasicModelBuilder::addNodes(int numNodes, const int *tags, const double *crds)
+{
+  if (numNodes <= 0)
+    return 0;
+
+  // check the tags are unique and not already in the domain
+  std::vector<int> sorted;
+  if (checkNodes(*theDomain, numNodes, tags, sorted) != 0)
+    return -1;
+
+  std::vector<Node*> nodes(numNodes);
+  for (int i=0; i<numNodes; i++) {
+    const double *x = &crds[(std::size_t)i*ndm];
+    switch (ndm) {
+      case 1:  nodes[i] = new Node(tags[i], ndf, x[0]);             break;
+      case 2:  nodes[i] = new Node(tags[i], ndf, x[0], x[1]);       break;
+      default: nodes[i] = new Node(tags[i], ndf, x[0], x[1], x[2]); break;
+    }
+  }
+
+  if (theDomain->addNodes(nodes.data(), numNodes) != 0) {
+    for (Node *node : nodes)
+      delete node;
+    return -1;
+  }
+  return 0;
+}
+
+
+int
+BasicModelBuilder::addElements(const char *type, int numElements, int numElementNodes,
+                               const int *tags, const int *connectivity, const int *matTags,
+                               const double *params, int numParams, const char *option)
+{
+  //
+  // check the input
+  //
+  std::vector<int>   materialTags;
+  std::vector<void*> materials;
+  const int kind = checkElementBlock(*this, type, numElements, numElementNodes,
+                                     tags, connectivity, matTags, numParams,
+                                     std::vector<int>(), materialTags, materials);
+  if (kind < 0)
+    return -1;
+  if (numElements <= 0)
+    return 0;
+
+  if (option == nullptr || option[0] == '\0')
+    option = "PlaneStrain";
+
+  //
+  // create the elements and add them as a batch
+  //
+  std::vector<Element*> elements(numElements);
+  for (int i=0; i<numElements; i++) {
+    auto m = std::lower_bound(materialTags.begin(), materialTags.end(), matTags[i]);
+    elements[i] = newBulkElement(kind, tags[i], &connectivity[(std::size_t)i*numElementNodes],
+                                 materials[m - materialTags.begin()],
+                                 params, numParams, option, ndm);
+  }
+
+  if (theDomain->addElements(elements.data(), numElements) != 0) {
+    for (Element *element : elements)
+      delete element;
+    return -1;
+  }
+  return 0;
+}
+
+
+namespace {
+template <class T> bool
+readArray(FILE *file, std::vector<T> &array, std::size_t n)
+{
+  array.resize(n);
+  return n == 0 || fread(array.data(), sizeof(T), n, file) == n;
+}
+
+struct BulkBlock {
+  char type[33], option[33];
+  int  numElements, numElementNodes;
+  std::vector<double> params;
+  std::vector<int>    tags, connectivity, matTags;
+};
+} // namespace
+
+
+//
+// The whole file is read and checked before anything is added to the
+// model, so a file that is truncated or refers to missing objects
+// leaves the model as it was.
+//
+int
+BasicModelBuilder::importMesh(const char *fileName)
+{
+  FILE *file = fopen(fileName, "rb");
+  if (file == nullptr) {
+    opserr << "WARNING could not open file " << fileName << "\n";
+    return -1;
+  }
+
+  char magic[8];
+  int  header[3];
+  if (fread(magic, 1, 8, file) != 8 || strncmp(magic, "OPSMESH1", 8) != 0
+      || fread(header, sizeof(int), 3, file) != 3) {
+    opserr << "WARNING " << fileName << " is not a mesh file\n";
+    fclose(file);
+    return -1;
+  }
+
+  const int fileNDM = header[0], numNodes = header[1], numBlocks = header[2];
+  if (fileNDM != ndm || numNodes < 0 || numBlocks < 0) {
+    opserr << "WARNING mesh file " << fileName << " has ndm " << fileNDM
+           << " but the model has ndm " << ndm << "\n";
+    fclose(file);
+    return -1;
+  }
+
+  std::vector<int>    nodeTags;
+  std::vector<double> crds;
+  if (!readArray(file, nodeTags, numNodes) || !readArray(file, crds, (std::size_t)numNodes*ndm)) {
+    opserr << "WARNING unexpected end of mesh file " << fileName << "\n";
+    fclose(file);
+    return -1;
+  }
+
+  std::vector<BulkBlock> blocks;
+  for (int b=0; b<numBlocks; b++) {
+    blocks.emplace_back();
+    BulkBlock &block = blocks.back();
+    memset(block.type, 0, sizeof(block.type));
+    memset(block.option, 0, sizeof(block.option));
+    int  sizes[3];
+    if (fread(block.type, 1, 32, file) != 32 || fread(block.option, 1, 32, file) != 32
+        || fread(sizes, sizeof(int), 3, file) != 3
+        || sizes[0] < 0 || sizes[1] <= 0 || sizes[2] < 0
+        || sizes[0] > INT_MAX/sizes[1]
+        || !readArray(file, block.params, sizes[2])
+        || !readArray(file, block.tags, sizes[0])
+        || !readArray(file, block.connectivity, (std::size_t)sizes[0]*sizes[1])
+        || !readArray(file, block.matTags, sizes[0])) {
+      opserr << "WARNING invalid element block " << b << " in mesh file " << fileName << "\n";
+      fclose(file);
+      return -1;
+    }
+    block.numElements = sizes[0];
+    block.numElementNodes = sizes[1];
+  }
+  fclose(file);
+
+  //
+  // check the nodes and every block, the element tags also across blocks
+  //
+  std::vector<int> newNodes;
+  if (checkNodes(*theDomain, numNodes, nodeTags.data(), newNodes) != 0) {
+    opserr << "WARNING invalid nodes in mesh file " << fileName << "\n";
+    return -1;
+  }
+
+  std::vector<int> elementTags;
+  for (const BulkBlock &block : blocks)
+    elementTags.insert(elementTags.end(), block.tags.begin(), block.tags.end());
+  int duplicate = 0;
+  if (sortedTags(elementTags.data(), (int)elementTags.size(), &duplicate).size() != elementTags.size()) {
+    opserr << "WARNING element " << duplicate << " is given more than once in mesh file " << fileName << "\n";
+    return -1;
+  }
+
+  std::vector<int>   materialTags;
+  std::vector<void*> materials;
+  for (int b=0; b<numBlocks; b++) {
+    const BulkBlock &block = blocks[b];
+    if (checkElementBlock(*this, block.type, block.numElements, block.numElementNodes,
+                          block.tags.data(), block.connectivity.data(), block.matTags.data(),
+                          (int)block.params.size(), newNodes, materialTags, materials) < 0) {
+      opserr << "WARNING invalid element block " << b << " in mesh file " << fileName << "\n";
+      return -1;
+    }
+  }
+
+  //
+  // add them; should the domain refuse a block, the blocks before it
+  // and the nodes are removed again
+  //
+  if (this->addNodes(numNodes, nodeTags.data(), crds.data()) != 0)
+    return -1;
+
+  for (int b=0; b<numBlocks; b++) {
+    BulkBlock &block = blocks[b];
+    if (this->addElements(block.type, block.numElements, block.numElementNodes,
+                          block.tags.data(), block.connectivity.data(), block.matTags.data(),
+                          block.params.data(), (int)block.params.size(), block.option) != 0) {
+      opserr << "WARNING failed to add element block " << b << " from mesh file " << fileName << "\n";
+      for (int c=0; c<b; c++)
+        for (int tag : blocks[c].tags)
+          delete theDomain->removeElement(tag);
+      for (int tag : nodeTags)
+        delete theDomain->removeNode(tag);
+      return -1;
+    }
+  }
+
+  return 0;
+}
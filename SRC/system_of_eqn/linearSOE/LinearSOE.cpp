@@ -32,15 +32,108 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <vector>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Logging.h>
+#include <logging/Profiler.h>
+#include <threads/thread_pool.hpp>
+#include <algorithm>
+#include <thread>
+#include <math.h>
+
+namespace {
+
+// the vectors are reduced in blocks of a fixed size, summed in order, so
+// that the norms do not depend on the number of threads
+constexpr int normBlockSize = 8192;
+constexpr int minParallelNormSize = 16*normBlockSize;
+
+struct NormSums {
+  double x, b, dot;
+};
+
+template <int type>
+inline double
+normTerm(double v, int p)
+{
+  if (type == 2)
+    return v*v;
+  if (type == 1)
+    return fabs(v);
+  return pow(fabs(v), p);
+}
+
+template <int type>
+NormSums
+sumBlock(const double *x, const double *b, int begin, int end, int p)
+{
+  // independent partial sums, so that the loop vectorizes
+  double sx[4] = {0.0, 0.0, 0.0, 0.0};
+  double sb[4] = {0.0, 0.0, 0.0, 0.0};
+  double sd[4] = {0.0, 0.0, 0.0, 0.0};
+  int i = begin;
+  for ( ; i+4 <= end; i += 4)
+    for (int k=0; k<4; k++) {
+      sx[k] += normTerm<type>(x[i+k], p);
+      sb[k] += normTerm<type>(b[i+k], p);
+      sd[k] += x[i+k]*b[i+k];
+    }
+  for ( ; i < end; i++) {
+    sx[0] += normTerm<type>(x[i], p);
+    sb[0] += normTerm<type>(b[i], p);
+    sd[0] += x[i]*b[i];
+  }
+  return {(sx[0]+sx[1]) + (sx[2]+sx[3]),
+          (sb[0]+sb[1]) + (sb[2]+sb[3]),
+          (sd[0]+sd[1]) + (sd[2]+sd[3])};
+}
+
+template <>
+NormSums
+sumBlock<0>(const double *x, const double *b, int begin, int end, int p)
+{
+  NormSums sums = {0.0, 0.0, 0.0};
+  for (int i=begin; i<end; i++) {
+    sums.x = std::max(sums.x, fabs(x[i]));
+    sums.b = std::max(sums.b, fabs(b[i]));
+    sums.dot += x[i]*b[i];
+  }
+  return sums;
+}
+
+NormSums
+sumNormBlock(const double *x, const double *b, int begin, int end, int p)
+{
+  switch (p) {
+    case 2:  return sumBlock<2>(x, b, begin, end, p);
+    case 1:  return sumBlock<1>(x, b, begin, end, p);
+    default: return p > 0 ? sumBlock<3>(x, b, begin, end, p)
+                          : sumBlock<0>(x, b, begin, end, p);
+  }
+}
+
+OpenSees::thread_pool *
+normThreads(void)
+{
+  static OpenSees::thread_pool *threads = nullptr;
+  static const unsigned numThreads = std::min(8u, std::thread::hardware_concurrency());
+  if (threads == nullptr && numThreads > 1)
+    threads = new OpenSees::thread_pool{static_cast<OpenSees::concurrency_t>(numThreads)};
+  return threads;
+}
+
+}
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
-    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
+    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver),
+     norms{2, 0.0, 0.0, 0.0}
 {
 
 }
 
 LinearSOE::LinearSOE(int classtag)
-:MovableObject(classtag), theModel(0), theSolver(0)
+:MovableObject(classtag), theModel(0), theSolver(0), norms{2, 0.0, 0.0, 0.0}
 {
 
 }
@@ -52,13 +145,146 @@ LinearSOE::~LinearSOE()
     delete theSolver;
 }
 
+const LinearSOENorms &
+LinearSOE::formNorms(int type)
+{
+  const Vector &X = this->getX();
+  const Vector &B = this->getB();
+  const int n = std::min(X.Size(), B.Size());
+
+  norms.type = type;
+  if (n == 0) {
+    norms.normX = norms.normB = norms.dotXB = 0.0;
+    return norms;
+  }
+
+  const double *x = X.theData;
+  const double *b = B.theData;
+  const int numBlocks = (n + normBlockSize - 1)/normBlockSize;
+
+  std::vector<NormSums> blocks(numBlocks);
+  OpenSees::thread_pool *threads = n >= minParallelNormSize ? normThreads() : nullptr;
+  if (threads != nullptr) {
+    threads->submit_blocks<int>(0, numBlocks, [&](int first, int last) {
+      for (int k=first; k<last; k++)
+        blocks[k] = sumNormBlock(x, b, k*normBlockSize, std::min(n, (k+1)*normBlockSize), type);
+    }).wait();
+  } else {
+    for (int k=0; k<numBlocks; k++)
+      blocks[k] = sumNormBlock(x, b, k*normBlockSize, std::min(n, (k+1)*normBlockSize), type);
+  }
+
+  NormSums sums = {0.0, 0.0, 0.0};
+  for (const NormSums &block : blocks) {
+    if (type > 0) {
+      sums.x += block.x;
+      sums.b += block.b;
+    } else {
+      sums.x = std::max(sums.x, block.x);
+      sums.b = std::max(sums.b, block.b);
+    }
+    sums.dot += block.dot;
+  }
+
+  if (type == 2) {
+    norms.normX = sqrt(sums.x);
+    norms.normB = sqrt(sums.b);
+  } else if (type > 2) {
+    norms.normX = pow(sums.x, 1.0/type);
+    norms.normB = pow(sums.b, 1.0/type);
+  } else {
+    norms.normX = sums.x;
+    norms.normB = sums.b;
+  }
+  norms.dotXB = sums.dot;
+
+  return norms;
+}
+
+
+const LinearSOENorms &
+LinearSOE::getNorms(void) const
+{
+  return norms;
+}
+
+
 int 
 LinearSOE::solve(void)
 {
-  if (theSolver != 0)
-    return (theSolver->solve());
-  else 
+  if (theSolver == 0)
+    return -1;
+
+  OpenSees::ProfileScope scope(OpenSees::Profiler::Solve);
+  return theSolver->solve();
+}
+
+//
+// Solve A X = B for the columns of B. The first column is solved by
+// solve(), which factors A if it has not been; the others are then
+// handed to solveFactored() together, and solved one at a time with
+// the same factorization if the system cannot do that. The B and X
+// held by the system are overwritten.
+//
+int
+LinearSOE::solveMultiple(const Matrix &B, Matrix &X)
+{
+  const int n = this->getNumEqn();
+  const int numRHS = B.noCols();
+
+  if (B.noRows() != n || X.noRows() != n || X.noCols() != numRHS) {
+    opserr << "LinearSOE::solveMultiple() - B and X must have " << n << " rows and the same number of columns\n";
+    return -1;
+  }
+  if (theSolver == 0)
+    return -1;
+
+  Vector b(n);
+  for (int j=0; j<numRHS; j++) {
+    for (int i=0; i<n; i++)
+      b(i) = B(i,j);
+
+    if (this->setB(b) < 0 || this->solve() < 0)
+      return -2;
+
+    const Vector &x = this->getX();
+    for (int i=0; i<n; i++)
+      X(i,j) = x(i);
+
+    if (j == 0 && numRHS > 1) {
+      std::vector<double> BX((std::size_t)n*(numRHS - 1));
+      for (int k=1; k<numRHS; k++)
+        for (int i=0; i<n; i++)
+          BX[(std::size_t)(k-1)*n + i] = B(i,k);
+
+      int res;
+      {
+        OpenSees::ProfileScope scope(OpenSees::Profiler::Solve);
+        res = this->solveFactored(numRHS - 1, BX.data());
+      }
+      if (res == 0) {
+        for (int k=1; k<numRHS; k++)
+          for (int i=0; i<n; i++)
+            X(i,k) = BX[(std::size_t)(k-1)*n + i];
+        return 0;
+      }
+    }
+  }
+
+  return 0;
+}
+
+//
+// The solver may only use the factorization directly when the system it
+// holds is complete on this process; a system that assembles or
+// distributes its equations in solve() returns -1.
+//
+int
+LinearSOE::solveFactored(int numRHS, double *BX)
+{
+  if (theSolver == 0)
     return -1;
+  return theSolver->solveFactored(numRHS, BX);
 }
 
 int
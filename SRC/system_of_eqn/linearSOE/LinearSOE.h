@@ -43,6 +43,15 @@ class Vector;
 class ID;
 class AnalysisModel;
 
+// The norms of the X and B of a LinearSOE, of the type of Vector::pNorm(),
+// and their dot product.
+struct LinearSOENorms {
+    int    type;
+    double normX;
+    double normB;
+    double dotXB;
+};
+
 class LinearSOE : public MovableObject
 {
   public:
@@ -51,6 +60,7 @@ class LinearSOE : public MovableObject
     virtual ~LinearSOE();
 
     virtual int solve(void);    
+    virtual int solveMultiple(const Matrix &B, Matrix &X);
     virtual int setLinks(AnalysisModel &theModel);    
 
     // pure virtual functions
@@ -75,6 +85,12 @@ class LinearSOE : public MovableObject
             double getDeterminant(void);
     virtual double normRHS(void) = 0;
 
+    // forms the norms of X and B and X^T B in one pass over the vectors;
+    // the norms are kept until the next call, for the tests and output
+    // of the same iteration
+    const LinearSOENorms &formNorms(int type = 2);
+    const LinearSOENorms &getNorms(void) const;
+
     virtual void setX(int loc, double value) =0;
     virtual void setX(const Vector &X) =0;
     
@@ -82,10 +98,12 @@ class LinearSOE : public MovableObject
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
+    virtual int solveFactored(int numRHS, double *BX);
     AnalysisModel* theModel;
     
   private:
     LinearSOESolver *theSolver;    
+    LinearSOENorms norms;
 };
 
 
@@ -45,6 +45,11 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // solve with the factorization left by the last solve() for numRHS
+    // right-hand sides stored one after the other in BX, which are
+    // overwritten by the solutions; a solver that cannot returns -1
+    virtual int solveFactored(int numRHS, double *BX) {return -1;};
     
   protected:
     
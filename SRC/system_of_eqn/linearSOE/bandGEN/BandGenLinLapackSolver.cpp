@@ -158,6 +158,28 @@ BandGenLinLapackSolver::solve(void)
 }
 
 
+int
+BandGenLinLapackSolver::solveFactored(int numRHS, double *BX)
+{
+    assert(theSOE != nullptr);
+
+    if (theSOE->factored == false)
+      return -1;
+
+    int n = theSOE->size;
+    int kl = theSOE->numSubD;
+    int ku = theSOE->numSuperD;
+    int ldA = 2*kl + ku +1;
+    int ldB = n;
+    int info;
+
+    char type[] = "N";
+    DGBTRS(type,&n,&kl,&ku,&numRHS,theSOE->A,&ldA,iPiv,BX,&ldB,&info);
+
+    return info;
+}
+
+
 
 int
 BandGenLinLapackSolver::setSize()
@@ -40,6 +40,7 @@ class BandGenLinLapackSolver : public BandGenLinSolver
     ~BandGenLinLapackSolver();
 
     int solve();
+    int solveFactored(int numRHS, double *BX);
     int setSize();
 
     int sendSelf(int commitTag, Channel &theChannel);
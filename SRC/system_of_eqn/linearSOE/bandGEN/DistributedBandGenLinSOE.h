@@ -64,6 +64,8 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
     int setChannels(int numChannels, Channel **theChannels);
 
   protected:
+    // the right-hand side is only summed over the processes by solve()
+    int solveFactored(int numRHS, double *BX) {return -1;};
     
   private:
     int processID;
@@ -93,6 +93,27 @@ BandSPDLinLapackSolver::solve(void)
 }
 
 
+int
+BandSPDLinLapackSolver::solveFactored(int numRHS, double *BX)
+{
+    assert(theSOE != nullptr);
+
+    if (theSOE->factored == false)
+      return -1;
+
+    int n = theSOE->size;
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    int ldB = n;
+    int info;
+
+    char tflag[] = "U";
+    DPBTRS(tflag, &n,&kd,&numRHS,theSOE->A,&ldA,BX,&ldB,&info);
+
+    return info;
+}
+
+
 int
 BandSPDLinLapackSolver::setSize()
 {
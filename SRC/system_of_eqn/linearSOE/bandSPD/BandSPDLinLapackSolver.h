@@ -45,6 +45,7 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
     ~BandSPDLinLapackSolver();
 
     int solve(void);
+    int solveFactored(int numRHS, double *BX);
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
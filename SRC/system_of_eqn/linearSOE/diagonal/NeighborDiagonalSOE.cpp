@@ -0,0 +1,334 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of NeighborDiagonalSOE.
+//
+// Written: cmp
+//
+#include <math.h>
+#include <algorithm>
+#include <NeighborDiagonalSOE.h>
+#include <NeighborDiagonalSolver.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Logging.h>
+
+
+NeighborDiagonalSOE::NeighborDiagonalSOE(NeighborDiagonalSolver &theSolver, MPI_Comm comm)
+:LinearSOE(theSolver, LinSOE_TAGS_NeighborDiagonalSOE),
+ size(0), numEqn(0), vectX(nullptr), vectB(nullptr),
+ isAfactored(false), exchangeA(false), isSummed(false), comm(comm),
+ theExchange(comm), theModel(nullptr)
+{
+  theSolver.setLinearSOE(*this);
+}
+
+
+NeighborDiagonalSOE::~NeighborDiagonalSOE()
+{
+  if (theExchange.isActive())
+    this->finishExchange();
+
+  delete vectX;
+  delete vectB;
+}
+
+
+int
+NeighborDiagonalSOE::getNumEqn() const
+{
+  return numEqn;
+}
+
+
+int
+NeighborDiagonalSOE::getNumInterfaceEqn() const
+{
+  return theExchange.getNumShared();
+}
+
+
+int
+NeighborDiagonalSOE::setAnalysisModel(AnalysisModel &theAnalysisModel)
+{
+  theModel = &theAnalysisModel;
+  return 0;
+}
+
+
+int
+NeighborDiagonalSOE::setSize(Graph &theGraph)
+{
+  if (theExchange.isActive())
+    this->finishExchange();
+
+  //
+  // the local equations, numbered in the order of their global numbers
+  //
+  size = theGraph.getNumVertex();
+
+  dofs.clear();
+  dofs.reserve(size);
+  Vertex *theVertex;
+  VertexIter &theVertices = theGraph.getVertices();
+  while ((theVertex = theVertices()) != nullptr)
+    dofs.push_back(theVertex->getTag());
+  std::sort(dofs.begin(), dofs.end());
+
+  if (theExchange.setUp(dofs.data(), size) < 0) {
+    opserr << "NeighborDiagonalSOE::setSize() - failed to find the interface equations\n";
+    return -1;
+  }
+
+  numEqn = size > 0 ? dofs.back() + 1 : 0;
+  location.assign(numEqn, -1);
+  for (int i=0; i<size; i++)
+    location[dofs[i]] = i;
+
+  A.assign(size, 0.0);
+  B.assign(size, 0.0);
+  invA.assign(size, 0.0);
+  X.assign(numEqn, 0.0);
+  assembledB.assign(numEqn, 0.0);
+  sharedA.assign(theExchange.getNumShared(), 0.0);
+  sharedB.assign(theExchange.getNumShared(), 0.0);
+  isAfactored = false;
+  isSummed = false;
+
+  delete vectX;
+  delete vectB;
+  vectX = new Vector(X.data(), numEqn);
+  vectB = new Vector(assembledB.data(), numEqn);
+
+  NeighborDiagonalSolver *theSolver = (NeighborDiagonalSolver *)this->getSolver();
+  return theSolver->setSize();
+}
+
+
+bool
+NeighborDiagonalSOE::touchesInterface(const ID &id) const
+{
+  for (int i=0; i<id.Size(); i++) {
+    int dof = id(i);
+    if (dof >= 0 && dof < numEqn && location[dof] >= 0
+        && theExchange.getSharedIndex(location[dof]) >= 0)
+      return true;
+  }
+  return false;
+}
+
+
+int
+NeighborDiagonalSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  if (fact == 0.0)
+    return 0;
+
+  if (theExchange.isActive() && this->touchesInterface(id)) {
+    opserr << "NeighborDiagonalSOE::addA() - interface equations are being exchanged\n";
+    return -1;
+  }
+
+  for (int i=0; i<id.Size(); i++) {
+    int dof = id(i);
+    if (dof < numEqn && dof >= 0 && location[dof] >= 0)
+      A[location[dof]] += m(i,i)*fact;
+  }
+  isSummed = false;
+  return 0;
+}
+
+
+int
+NeighborDiagonalSOE::addB(const Vector &v, const ID &id, double fact)
+{
+  if (fact == 0.0)
+    return 0;
+
+  if (theExchange.isActive() && this->touchesInterface(id)) {
+    opserr << "NeighborDiagonalSOE::addB() - interface equations are being exchanged\n";
+    return -1;
+  }
+
+  if (fact == 1.0) {
+    for (int i=0; i<id.Size(); i++) {
+      int dof = id(i);
+      if (dof < numEqn && dof >= 0 && location[dof] >= 0)
+        B[location[dof]] += v(i);
+    }
+  } else {
+    for (int i=0; i<id.Size(); i++) {
+      int dof = id(i);
+      if (dof < numEqn && dof >= 0 && location[dof] >= 0)
+        B[location[dof]] += v(i)*fact;
+    }
+  }
+  isSummed = false;
+  return 0;
+}
+
+
+int
+NeighborDiagonalSOE::setB(const Vector &v, double fact)
+{
+  if (v.Size() != numEqn) {
+    opserr << "NeighborDiagonalSOE::setB() - incompatible sizes " << numEqn << " and " << v.Size() << "\n";
+    return -1;
+  }
+  if (theExchange.isActive()) {
+    opserr << "NeighborDiagonalSOE::setB() - interface equations are being exchanged\n";
+    return -1;
+  }
+
+  // v holds totals; the interface ones are left to their owners
+  for (int i=0; i<size; i++) {
+    int k = theExchange.getSharedIndex(i);
+    B[i] = (k < 0 || theExchange.ownsShared(k)) ? v(dofs[i])*fact : 0.0;
+  }
+  isSummed = false;
+  return 0;
+}
+
+
+void
+NeighborDiagonalSOE::zeroA()
+{
+  if (theExchange.isActive())
+    this->finishExchange();
+
+  std::fill(A.begin(), A.end(), 0.0);
+  isAfactored = false;
+  isSummed = false;
+}
+
+
+void
+NeighborDiagonalSOE::zeroB()
+{
+  if (theExchange.isActive())
+    this->finishExchange();
+
+  std::fill(B.begin(), B.end(), 0.0);
+  isSummed = false;
+}
+
+
+void
+NeighborDiagonalSOE::setX(int loc, double value)
+{
+  if (loc < numEqn && loc >= 0)
+    X[loc] = value;
+}
+
+
+void
+NeighborDiagonalSOE::setX(const Vector &x)
+{
+  if (x.Size() == numEqn && vectX != nullptr)
+    *vectX = x;
+}
+
+
+const Vector &
+NeighborDiagonalSOE::getX()
+{
+  return *vectX;
+}
+
+
+const Vector &
+NeighborDiagonalSOE::getB()
+{
+  if (this->sumInterface() < 0)
+    opserr << "NeighborDiagonalSOE::getB() - failed to sum the interface equations\n";
+
+  for (int i=0; i<size; i++) {
+    int k = theExchange.getSharedIndex(i);
+    assembledB[dofs[i]] = k < 0 ? B[i] : sharedB[k];
+  }
+  return *vectB;
+}
+
+
+double
+NeighborDiagonalSOE::normRHS()
+{
+  if (this->sumInterface() < 0)
+    opserr << "NeighborDiagonalSOE::normRHS() - failed to sum the interface equations\n";
+
+  // interior equations, and the interface equations this process owns
+  double local = 0.0;
+  for (int i=0; i<size; i++)
+    if (theExchange.getSharedIndex(i) < 0)
+      local += B[i]*B[i];
+  for (int k=0; k<theExchange.getNumShared(); k++)
+    if (theExchange.ownsShared(k))
+      local += sharedB[k]*sharedB[k];
+
+  double norm = 0.0;
+  MPI_Allreduce(&local, &norm, 1, MPI_DOUBLE, MPI_SUM, comm);
+  return sqrt(norm);
+}
+
+
+//
+// bring the totals on the interface up to date
+//
+int
+NeighborDiagonalSOE::sumInterface()
+{
+  if (isSummed)
+    return 0;
+  if (!theExchange.isActive() && this->startExchange() < 0)
+    return -1;
+  return this->finishExchange();
+}
+
+
+//
+// post the exchange of the interface contributions to B and, unless it
+// has been factored, to A
+//
+int
+NeighborDiagonalSOE::startExchange()
+{
+  exchangeA = !isAfactored;
+  isSummed = false;
+  const double *values[2] = {B.data(), A.data()};
+  return theExchange.start(values, exchangeA ? 2 : 1);
+}
+
+
+int
+NeighborDiagonalSOE::finishExchange()
+{
+  double *sums[2] = {sharedB.data(), sharedA.data()};
+  if (theExchange.finish(sums) < 0)
+    return -1;
+
+  isSummed = true;
+  return 0;
+}
+
+
+int
+NeighborDiagonalSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "NeighborDiagonalSOE::sendSelf() - each process creates its own system\n";
+  return -1;
+}
+
+
+int
+NeighborDiagonalSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "NeighborDiagonalSOE::recvSelf() - each process creates its own system\n";
+  return -1;
+}
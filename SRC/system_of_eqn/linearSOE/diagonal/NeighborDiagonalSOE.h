@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: NeighborDiagonalSOE stores a diagonal system of equations
+// distributed over MPI processes, each holding the equations of its own
+// part of the model. Contributions to equations on the interface between
+// parts are summed with an MPI_NeighborExchange, which sends only the
+// interface entries and only to the processes sharing them; there is no
+// gather through one process and no barrier.
+//
+// The exchange is posted by startExchange() and completed by
+// finishExchange(). NeighborDiagonalSolver posts it itself if it has not
+// been, and solves the interior equations while the messages are in
+// flight. A driver that assembles the elements on the interface first can
+// call startExchange() before assembling the interior elements, so the
+// communication overlaps the element computation as well; nothing may be
+// added to an interface equation while an exchange is in progress.
+//
+// A and B hold the local contributions only; the totals on the interface
+// and the inverse of the diagonal are kept apart, so a solve can be
+// repeated, and a failed one leaves A as it was assembled. Once A has
+// been factored only B is exchanged until zeroA() is called.
+//
+// The equation numbers of the DOF_Groups are left as the numberer set
+// them; the SOE keeps its own map from those to the local equations. X
+// and the vector returned by getB() are therefore indexed by the global
+// equation number and are getNumEqn() long, which is one more than the
+// largest equation held locally; the entries of other processes are 0.
+// getB() holds the assembled totals of the local equations and normRHS()
+// is the norm of the whole assembled B, each interface equation counted
+// once. Both sum the interface if that has not been done since B last
+// changed, so all processes must call them together. setB() takes totals
+// as well, as getB() returns them: the total of an interface equation is
+// kept as the contribution of the process that owns it, so that summing
+// the interface gives it back.
+//
+// Written: cmp
+//
+#ifndef NeighborDiagonalSOE_h
+#define NeighborDiagonalSOE_h
+
+#include <mpi.h>
+#include <vector>
+#include <LinearSOE.h>
+#include <MPI_NeighborExchange.h>
+
+class Vector;
+class AnalysisModel;
+class NeighborDiagonalSolver;
+
+class NeighborDiagonalSOE : public LinearSOE
+{
+  public:
+    NeighborDiagonalSOE(NeighborDiagonalSolver &theSolver, MPI_Comm comm = MPI_COMM_WORLD);
+    ~NeighborDiagonalSOE();
+
+    int getNumEqn() const;
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+
+    void zeroA();
+    void zeroB();
+
+    void setX(int loc, double value);
+    void setX(const Vector &x);
+
+    const Vector &getX();
+    const Vector &getB();
+    double normRHS();
+
+    int setAnalysisModel(AnalysisModel &theModel);
+
+    int startExchange();
+    int finishExchange();
+    int getNumInterfaceEqn() const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    friend class NeighborDiagonalSolver;
+
+  private:
+    bool touchesInterface(const ID &id) const;
+    int sumInterface();
+
+    int size;                               // local equations
+    int numEqn;                             // length of X and getB()
+    std::vector<int> dofs;                  // global number of each local equation
+    std::vector<int> location;              // local equation of each global one, or -1
+    std::vector<double> A, B;               // by local equation
+    std::vector<double> invA;               // inverse of the summed diagonal
+    std::vector<double> X, assembledB;      // by global equation
+    std::vector<double> sharedA, sharedB;   // totals on the interface
+    Vector *vectX, *vectB;
+    bool isAfactored;
+    bool exchangeA;
+    bool isSummed;                          // shared totals are up to date
+
+    MPI_Comm comm;
+
+    MPI_NeighborExchange theExchange;
+    AnalysisModel *theModel;
+};
+
+#endif
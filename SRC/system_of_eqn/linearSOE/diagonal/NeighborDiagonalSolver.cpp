@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of NeighborDiagonalSolver.
+//
+// Written: cmp
+//
+#include <math.h>
+#include <NeighborDiagonalSolver.h>
+#include <NeighborDiagonalSOE.h>
+#include <Logging.h>
+
+
+NeighborDiagonalSolver::NeighborDiagonalSolver(double tol)
+:LinearSOESolver(SOLVER_TAGS_NeighborDiagonalSolver),
+ theSOE(nullptr), minDiagTol(tol)
+{
+
+}
+
+
+NeighborDiagonalSolver::~NeighborDiagonalSolver()
+{
+
+}
+
+
+int
+NeighborDiagonalSolver::setLinearSOE(NeighborDiagonalSOE &theNewSOE)
+{
+  theSOE = &theNewSOE;
+  return 0;
+}
+
+
+int
+NeighborDiagonalSolver::setSize()
+{
+  return 0;
+}
+
+
+int
+NeighborDiagonalSolver::solve()
+{
+  if (theSOE == nullptr) {
+    opserr << "NeighborDiagonalSolver::solve() - no NeighborDiagonalSOE has been set\n";
+    return -1;
+  }
+
+  NeighborDiagonalSOE &soe = *theSOE;
+  MPI_NeighborExchange &theExchange = soe.theExchange;
+
+  if (!soe.isSummed && !theExchange.isActive() && soe.startExchange() < 0)
+    return -1;
+
+  const bool factor = soe.exchangeA;
+  const int size = soe.size;
+  const int *dofs = soe.dofs.data();
+  const double *A = soe.A.data();
+  const double *B = soe.B.data();
+  double *invA = soe.invA.data();
+  double *X = soe.X.data();
+
+  // a small pivot is only reported once the exchange is complete, so
+  // that the neighbors are not left waiting
+  int result = 0;
+
+  for (int i=0; i<size; i++) {
+    if (theExchange.getSharedIndex(i) >= 0)
+      continue;
+    if (factor) {
+      if (fabs(A[i]) <= minDiagTol) {
+        result = -2;
+        continue;
+      }
+      invA[i] = 1.0/A[i];
+    }
+    X[dofs[i]] = invA[i]*B[i];
+  }
+
+  if (!soe.isSummed && soe.finishExchange() < 0)
+    return -1;
+
+  const std::vector<int> &shared = theExchange.getShared();
+  for (std::size_t k=0; k<shared.size(); k++) {
+    const int i = shared[k];
+    if (factor) {
+      if (fabs(soe.sharedA[k]) <= minDiagTol) {
+        result = -2;
+        continue;
+      }
+      invA[i] = 1.0/soe.sharedA[k];
+    }
+    X[dofs[i]] = invA[i]*soe.sharedB[k];
+  }
+
+  // A is untouched, so the next solve factors it again
+  if (result < 0) {
+    opserr << "NeighborDiagonalSolver::solve() - a diagonal entry is below the tolerance\n";
+    return result;
+  }
+
+  soe.isAfactored = true;
+  return 0;
+}
+
+
+int
+NeighborDiagonalSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return -1;
+}
+
+
+int
+NeighborDiagonalSolver::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return -1;
+}
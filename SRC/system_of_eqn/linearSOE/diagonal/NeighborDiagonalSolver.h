@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: NeighborDiagonalSolver solves a NeighborDiagonalSOE. The
+// interior equations are solved while the interface contributions are
+// being exchanged, and the interface equations once they have arrived.
+// As in DiagonalDirectSolver the inverse of the diagonal is kept, so
+// later solves with the same A only exchange B.
+//
+// Written: cmp
+//
+#ifndef NeighborDiagonalSolver_h
+#define NeighborDiagonalSolver_h
+
+#include <LinearSOESolver.h>
+
+class NeighborDiagonalSOE;
+
+class NeighborDiagonalSolver : public LinearSOESolver
+{
+  public:
+    NeighborDiagonalSolver(double minDiagTol = 1.0e-18);
+    ~NeighborDiagonalSolver();
+
+    int solve();
+    int setSize();
+    int setLinearSOE(NeighborDiagonalSOE &theSOE);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  private:
+    NeighborDiagonalSOE *theSOE;
+    double minDiagTol;
+};
+
+#endif
@@ -132,6 +132,29 @@ FullGenLinLapackSolver::solve(void)
 }
 
 
+int
+FullGenLinLapackSolver::solveFactored(int numRHS, double *BX)
+{
+    assert(theSOE != nullptr);
+
+    if (theSOE->factored == false)
+      return -1;
+
+    int n = theSOE->size;
+    if (n == 0)
+      return 0;
+
+    int ldA = n;
+    int ldB = n;
+    int info;
+
+    char tran[] = "N";
+    DGETRS(tran, &n,&numRHS,theSOE->A,&ldA,iPiv,BX,&ldB,&info);
+
+    return info;
+}
+
+
 int
 FullGenLinLapackSolver::setSize()
 {
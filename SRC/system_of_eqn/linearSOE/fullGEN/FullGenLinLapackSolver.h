@@ -38,6 +38,7 @@ class FullGenLinLapackSolver : public FullGenLinSolver
     ~FullGenLinLapackSolver();
 
     int solve(void);
+    int solveFactored(int numRHS, double *BX);
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -49,6 +49,13 @@ TclDispatch_newMumpsLinearSOE(ClientData clientData, Tcl_Interp* interp, int arg
     }
 
 #  ifdef _PARALLEL_PROCESSING
+      // MPI is not started by the shared memory machine broker
+      int mpiStarted = 0;
+      MPI_Initialized(&mpiStarted);
+      if (!mpiStarted) {
+        opserr << "WARNING system Mumps requires MPI, which is not running with OPENSEES_SHARED_MEMORY\n";
+        return nullptr;
+      }
       MumpsParallelSolver *theSolver = new MumpsParallelSolver(icntl7, icntl14);
       theSOE = new MumpsParallelSOE(*theSolver);
 #  elif _PARALLEL_INTERPRETERS
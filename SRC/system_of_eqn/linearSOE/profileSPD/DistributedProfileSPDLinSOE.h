@@ -70,6 +70,8 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     int setChannels(int numChannels, Channel **theChannels);
 
   protected:
+    // the right-hand side is only summed over the processes by solve()
+    int solveFactored(int numRHS, double *BX) {return -1;};
     
   private:
     int processID;
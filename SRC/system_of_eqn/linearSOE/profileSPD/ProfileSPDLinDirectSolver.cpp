@@ -290,6 +290,59 @@ ProfileSPDLinDirectSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
 }
 #endif	
 
+//
+// The forward and back substitutions are done for all the right-hand
+// sides together, so each column of the factor is read once.
+//
+int
+ProfileSPDLinDirectSolver::solveFactored(int numRHS, double *BX)
+{
+    assert(theSOE != nullptr);
+
+    // a condensed system holds only part of the factorization
+    if (theSOE->isAfactored == false || theSOE->isAcondensed == true)
+      return -1;
+
+    int theSize = theSOE->size;
+    if (theSize == 0 || numRHS == 0)
+	return 0;
+
+    // do forward substitution 
+    for (int i=1; i<theSize; i++) {
+	int rowitop = RowTop[i];
+	for (int r=0; r<numRHS; r++) {
+	    double *X = BX + (std::size_t)r*theSize;
+	    double *ajiPtr = topRowPtr[i];
+	    double *bjPtr  = &X[rowitop];  
+	    double tmp = 0;	    
+	    for (int j=rowitop; j<i; j++) 
+		tmp -= *ajiPtr++ * *bjPtr++; 
+	    X[i] += tmp;
+	}
+    }
+
+    // divide by diag term 
+    for (int r=0; r<numRHS; r++) {
+	double *X = BX + (std::size_t)r*theSize;
+	for (int j=0; j<theSize; j++) 
+	    X[j] *= invD[j];
+    }
+
+    // now do the back substitution
+    for (int k=(theSize-1); k>0; k--) {
+	int rowktop = RowTop[k];
+	for (int r=0; r<numRHS; r++) {
+	    double *X = BX + (std::size_t)r*theSize;
+	    double bk = X[k];
+	    double *ajiPtr = topRowPtr[k]; 		
+	    for (int j=rowktop; j<k; j++) 
+		X[j] -= *ajiPtr++ * bk;
+	}
+    }   	 
+
+    return 0;
+}
+
 int 
 ProfileSPDLinDirectSolver::factor(int n)
 {
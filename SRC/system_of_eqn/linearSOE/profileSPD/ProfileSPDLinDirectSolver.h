@@ -50,6 +50,7 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     virtual ~ProfileSPDLinDirectSolver();
 
     virtual int solve(void);        
+    virtual int solveFactored(int numRHS, double *BX);
     virtual int setSize(void);    
     double getDeterminant(void);
 
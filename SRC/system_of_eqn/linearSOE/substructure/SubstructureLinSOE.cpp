@@ -0,0 +1,356 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <math.h>
+#include <assert.h>
+#include <algorithm>
+#include <SubstructureLinSOE.h>
+#include <SubstructureLinSolver.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Graph.h>
+#include <CSRGraph.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <Logging.h>
+#include <classTags.h>
+
+#ifdef _USE_METIS_5p1
+#  include <metis.h>
+#else
+extern "C"
+void METIS_PartGraphKway(int *, int *, int *, int *, int *, int *, int *, int *, int *, int *, int *);
+#endif
+
+
+SubstructureLinSOE::SubstructureLinSOE(SubstructureLinSolver &theSolvr, int np)
+:LinearSOE(theSolvr, LinSOE_TAGS_SubstructureLinSOE),
+ size(0), numParts(np > 0 ? np : 1),
+ vectX(nullptr), vectB(nullptr), factored(false)
+{
+  theSolvr.setLinearSOE(*this);
+}
+
+
+SubstructureLinSOE::~SubstructureLinSOE()
+{
+  if (vectX != nullptr)
+    delete vectX;
+  if (vectB != nullptr)
+    delete vectB;
+}
+
+
+int
+SubstructureLinSOE::getNumEqn() const
+{
+  return size;
+}
+
+
+int
+SubstructureLinSOE::getNumParts() const
+{
+  return (int)parts.size();
+}
+
+
+int
+SubstructureLinSOE::getNumInterfaceEqn() const
+{
+  return (int)interface.size();
+}
+
+
+int
+SubstructureLinSOE::partition(const std::vector<int> &xadj, const std::vector<int> &adjncy,
+                              std::vector<int> &part)
+{
+  int numVertex = (int)xadj.size() - 1;
+  part.assign(numVertex, 0);
+
+  int nparts = numParts;
+  if (nparts < 2 || numVertex < 2*nparts || adjncy.empty())
+    return 1;
+
+  int edgecut = 0;
+#ifdef _USE_METIS_5p1
+  idx_t ncon = 1;
+  idx_t options[METIS_NOPTIONS];
+  METIS_SetDefaultOptions(options);
+  options[METIS_OPTION_NUMBERING] = 0;
+  int status = METIS_PartGraphKway(&numVertex, &ncon,
+                                   const_cast<int*>(xadj.data()), const_cast<int*>(adjncy.data()),
+                                   nullptr, nullptr, nullptr, &nparts, nullptr, nullptr,
+                                   options, &edgecut, part.data());
+  if (status != METIS_OK) {
+    opserr << "WARNING SubstructureLinSOE::setSize - METIS_PartGraphKway failed with flag " << status << "\n";
+    return -1;
+  }
+#else
+  int wgtflag = 0, numflag = 0;
+  int options[5] = {0};
+  METIS_PartGraphKway(&numVertex,
+                      const_cast<int*>(xadj.data()), const_cast<int*>(adjncy.data()),
+                      nullptr, nullptr, &wgtflag, &numflag, &nparts, options,
+                      &edgecut, part.data());
+#endif
+  return nparts;
+}
+
+
+int
+SubstructureLinSOE::setSize(Graph &theGraph)
+{
+  CSRGraph graph(theGraph);
+  size = graph.numVertex();
+
+  // the vertices of the graph of a LinearSOE are the equation numbers
+  std::vector<int> part;
+  int np = this->partition(graph.xadj, graph.adjncy, part);
+  if (np < 0)
+    return -1;
+
+  // a vertex separator is formed from the higher numbered part of each
+  // cut edge, so the interiors of two parts are never coupled
+  owner.assign(size, 0);
+  local.assign(size, -1);
+  for (int i=0; i<size; i++) {
+    assert(graph.tags[i] >= 0 && graph.tags[i] < size);
+    owner[graph.tags[i]] = part[i];
+  }
+  for (int i=0; i<size; i++)
+    for (int e=graph.xadj[i]; e<graph.xadj[i+1]; e++)
+      if (part[graph.adjncy[e]] > part[i]) {
+        owner[graph.tags[graph.adjncy[e]]] = -1;
+      }
+
+  parts.assign(np, Part{});
+  interface.clear();
+  for (int eq=0; eq<size; eq++) {
+    if (owner[eq] < 0) {
+      local[eq] = (int)interface.size();
+      interface.push_back(eq);
+    } else {
+      Part &p = parts[owner[eq]];
+      local[eq] = (int)p.interior.size();
+      p.interior.push_back(eq);
+    }
+  }
+  const int numInterface = (int)interface.size();
+
+  // bandwidth of the interior blocks and the interface equations
+  // coupled to each part
+  for (Part &p : parts) {
+    p.kl = p.ku = 0;
+    p.interfaceMap.assign(numInterface, -1);
+  }
+  for (int i=0; i<size; i++) {
+    const int eq = graph.tags[i];
+    if (owner[eq] < 0)
+      continue;
+
+    Part &p = parts[owner[eq]];
+    for (int e=graph.xadj[i]; e<graph.xadj[i+1]; e++) {
+      const int other = graph.tags[graph.adjncy[e]];
+      if (owner[other] < 0) {
+        if (p.interfaceMap[local[other]] < 0) {
+          p.interfaceMap[local[other]] = (int)p.interface.size();
+          p.interface.push_back(local[other]);
+        }
+      } else if (owner[other] == owner[eq]) {
+        const int diff = local[eq] - local[other];
+        p.kl = std::max(p.kl,  diff);
+        p.ku = std::max(p.ku, -diff);
+      }
+    }
+  }
+
+  for (Part &p : parts) {
+    // keep the coupled interface equations in the global order
+    std::sort(p.interface.begin(), p.interface.end());
+    for (int k=0; k<(int)p.interface.size(); k++)
+      p.interfaceMap[p.interface[k]] = k;
+
+    const std::size_t ni = p.interior.size(), nb = p.interface.size();
+    p.Aii.assign(ni*(2*p.kl + p.ku + 1), 0.0);
+    p.Aib.assign(ni*nb, 0.0);
+    p.Abi.assign(nb*ni, 0.0);
+  }
+  Abb.assign((std::size_t)numInterface*numInterface, 0.0);
+
+  B.assign(size, 0.0);
+  X.assign(size, 0.0);
+  if (vectX != nullptr)
+    delete vectX;
+  if (vectB != nullptr)
+    delete vectB;
+  vectX = new Vector(X.data(), size);
+  vectB = new Vector(B.data(), size);
+
+  factored = false;
+
+  LinearSOESolver *theSolvr = this->getSolver();
+  return theSolvr->setSize();
+}
+
+
+int
+SubstructureLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  assert(id.Size() == m.noRows() && id.Size() == m.noCols());
+
+  if (fact == 0.0)
+    return 0;
+
+  const int idSize = id.Size();
+  const int numInterface = (int)interface.size();
+
+  for (int j=0; j<idSize; j++) {
+    const int col = id(j);
+    if (col < 0 || col >= size)
+      continue;
+    const int colPart = owner[col], lc = local[col];
+
+    for (int i=0; i<idSize; i++) {
+      const int row = id(i);
+      if (row < 0 || row >= size)
+        continue;
+      const int rowPart = owner[row], lr = local[row];
+      const double value = m(i,j)*fact;
+
+      if (rowPart < 0 && colPart < 0)
+        Abb[lr + (std::size_t)lc*numInterface] += value;
+
+      else if (rowPart < 0) {
+        Part &p = parts[colPart];
+        const int k = p.interfaceMap[lr];
+        if (k >= 0)
+          p.Abi[k + (std::size_t)lc*p.interface.size()] += value;
+
+      } else if (colPart < 0) {
+        Part &p = parts[rowPart];
+        const int k = p.interfaceMap[lc];
+        if (k >= 0)
+          p.Aib[lr + (std::size_t)k*p.interior.size()] += value;
+
+      } else if (rowPart == colPart) {
+        Part &p = parts[rowPart];
+        const int diff = lr - lc;
+        if (diff <= p.kl && -diff <= p.ku)
+          p.Aii[p.kl + p.ku + diff + (std::size_t)lc*(2*p.kl + p.ku + 1)] += value;
+      }
+    }
+  }
+  return 0;
+}
+
+
+int
+SubstructureLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+  assert(id.Size() == v.Size());
+
+  if (fact == 0.0)
+    return 0;
+
+  for (int i=0; i<id.Size(); i++) {
+    const int pos = id(i);
+    if (pos < size && pos >= 0)
+      B[pos] += v(i)*fact;
+  }
+  return 0;
+}
+
+
+int
+SubstructureLinSOE::setB(const Vector &v, double fact)
+{
+  assert(v.Size() == size);
+
+  for (int i=0; i<size; i++)
+    B[i] = v(i)*fact;
+  return 0;
+}
+
+
+void
+SubstructureLinSOE::zeroA()
+{
+  for (Part &p : parts) {
+    std::fill(p.Aii.begin(), p.Aii.end(), 0.0);
+    std::fill(p.Aib.begin(), p.Aib.end(), 0.0);
+    std::fill(p.Abi.begin(), p.Abi.end(), 0.0);
+  }
+  std::fill(Abb.begin(), Abb.end(), 0.0);
+  factored = false;
+}
+
+
+void
+SubstructureLinSOE::zeroB()
+{
+  std::fill(B.begin(), B.end(), 0.0);
+}
+
+
+const Vector &
+SubstructureLinSOE::getX()
+{
+  assert(vectX != nullptr);
+  return *vectX;
+}
+
+
+const Vector &
+SubstructureLinSOE::getB()
+{
+  assert(vectB != nullptr);
+  return *vectB;
+}
+
+
+double
+SubstructureLinSOE::normRHS()
+{
+  double norm = 0.0;
+  for (double b : B)
+    norm += b*b;
+  return sqrt(norm);
+}
+
+
+void
+SubstructureLinSOE::setX(int loc, double value)
+{
+  if (loc < size && loc >= 0)
+    X[loc] = value;
+}
+
+
+void
+SubstructureLinSOE::setX(const Vector &x)
+{
+  if (x.Size() == size && vectX != nullptr)
+    *vectX = x;
+}
+
+
+int
+SubstructureLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+  return -1;
+}
+
+
+int
+SubstructureLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return -1;
+}
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SubstructureLinSOE stores the system of equations split
+// into substructures for a shared-memory domain decomposition. In
+// setSize() the equation graph is partitioned with METIS into numParts
+// parts and a vertex separator is taken as the interface. The equations
+// of a part that are not on the interface are its interior, and are only
+// coupled to interior equations of the same part and to the interface.
+//
+// Each part holds its own interior block, in LAPACK band storage with the
+// interior equations numbered in the global order, and its dense coupling
+// blocks with the interface equations it touches. The interface block is
+// held densely. Because the parts share no storage, their static
+// condensation onto the interface is done independently by
+// SubstructureLinSolver on a pool of threads.
+//
+// Written: cmp
+//
+#ifndef SubstructureLinSOE_h
+#define SubstructureLinSOE_h
+
+#include <vector>
+#include <LinearSOE.h>
+
+class Vector;
+class SubstructureLinSolver;
+
+class SubstructureLinSOE : public LinearSOE
+{
+  public:
+    SubstructureLinSOE(SubstructureLinSolver &theSolver, int numParts = 1);
+    ~SubstructureLinSOE();
+
+    int getNumEqn() const;
+    int setSize(Graph &theGraph);
+
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+
+    void zeroA();
+    void zeroB();
+
+    const Vector &getX();
+    const Vector &getB();
+    double normRHS();
+
+    void setX(int loc, double value);
+    void setX(const Vector &x);
+
+    int getNumParts() const;
+    int getNumInterfaceEqn() const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    friend class SubstructureLinSolver;
+
+  protected:
+    struct Part {
+      std::vector<int> interior;     // global equation of each interior equation
+      std::vector<int> interface;    // interface index of each coupled interface equation
+      std::vector<int> interfaceMap; // inverse of interface, -1 if not coupled
+      int kl, ku;                    // sub- and super-diagonals of Aii
+      std::vector<double> Aii;       // interior block, LAPACK band storage
+      std::vector<double> Aib;       // interior-interface block, column major
+      std::vector<double> Abi;       // interface-interior block, column major
+    };
+
+    int partition(const std::vector<int> &xadj, const std::vector<int> &adjncy,
+                  std::vector<int> &part);
+
+    int size;
+    int numParts;
+    std::vector<Part> parts;
+
+    // owner[i] is the part of equation i or -1 for the interface, and
+    // local[i] its index among the interior equations of the part or
+    // among the interface equations
+    std::vector<int> owner;
+    std::vector<int> local;
+    std::vector<int> interface;      // global equation of each interface equation
+    std::vector<double> Abb;         // interface block, column major
+
+    std::vector<double> B, X;
+    Vector *vectX;
+    Vector *vectB;
+    bool factored;
+};
+
+#endif
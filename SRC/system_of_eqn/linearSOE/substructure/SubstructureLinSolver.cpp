@@ -0,0 +1,280 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <assert.h>
+#include <algorithm>
+#include <blasdecl.h>
+#include <SubstructureLinSolver.h>
+#include <SubstructureLinSOE.h>
+#include <Logging.h>
+#include <classTags.h>
+#include <threads/thread_pool.hpp>
+
+
+SubstructureLinSolver::SubstructureLinSolver(int nt)
+:LinearSOESolver(SOLVER_TAGS_SubstructureLinSolver),
+ theSOE(nullptr), numThreads(nt > 0 ? nt : 1), threads(nullptr)
+{
+  if (numThreads > 1)
+    threads = new OpenSees::thread_pool{static_cast<OpenSees::concurrency_t>(numThreads)};
+}
+
+
+SubstructureLinSolver::~SubstructureLinSolver()
+{
+  if (threads != nullptr)
+    delete threads;
+}
+
+
+int
+SubstructureLinSolver::setLinearSOE(SubstructureLinSOE &theSubstrSOE)
+{
+  theSOE = &theSubstrSOE;
+  return 0;
+}
+
+
+int
+SubstructureLinSolver::setSize()
+{
+  assert(theSOE != nullptr);
+
+  work.resize(theSOE->parts.size());
+  for (std::size_t p=0; p<work.size(); p++) {
+    const SubstructureLinSOE::Part &part = theSOE->parts[p];
+    work[p].iPiv.resize(std::max<std::size_t>(part.interior.size(), 1));
+    work[p].y.resize(part.interior.size());
+    work[p].z.resize(part.interface.size());
+    work[p].S.clear();
+  }
+
+  const int numInterface = theSOE->getNumInterfaceEqn();
+  iPiv.resize(std::max(numInterface, 1));
+  g.resize(numInterface);
+  return 0;
+}
+
+
+template <class F> void
+SubstructureLinSolver::forEachPart(F &&f)
+{
+  const int numParts = (int)work.size();
+  if (threads == nullptr || numParts < 2) {
+    for (int p=0; p<numParts; p++)
+      f(p);
+  } else
+    threads->submit_sequence<int>(0, numParts, f).wait();
+}
+
+
+//
+// Factor the interior block of a part, replace its interior-interface
+// block by Aii^-1 Aib and form its contribution Abi Aii^-1 Aib to the
+// Schur complement
+//
+int
+SubstructureLinSolver::condense(int p)
+{
+  SubstructureLinSOE::Part &part = theSOE->parts[p];
+  Work &w = work[p];
+
+  int ni = (int)part.interior.size();
+  int nb = (int)part.interface.size();
+  w.S.assign((std::size_t)nb*nb, 0.0);
+  if (ni == 0)
+    return 0;
+
+  int kl = part.kl, ku = part.ku;
+  int ldA = 2*kl + ku + 1;
+  int ldB = ni;
+  int info = 0;
+  DGBSV(&ni, &kl, &ku, &nb, part.Aii.data(), &ldA, w.iPiv.data(),
+        part.Aib.data(), &ldB, &info);
+  if (info != 0)
+    return info > 0 ? -info : info;
+
+  if (nb > 0) {
+    double one = 1.0, zero = 0.0;
+    DGEMM("N", "N", &nb, &nb, &ni, &one, part.Abi.data(), &nb,
+          part.Aib.data(), &ni, &zero, w.S.data(), &nb);
+  }
+  return 0;
+}
+
+
+//
+// y = Aii^-1 bi and z = Abi y
+//
+int
+SubstructureLinSolver::forward(int p)
+{
+  SubstructureLinSOE::Part &part = theSOE->parts[p];
+  Work &w = work[p];
+
+  int ni = (int)part.interior.size();
+  int nb = (int)part.interface.size();
+  if (ni == 0)
+    return 0;
+
+  for (int i=0; i<ni; i++)
+    w.y[i] = theSOE->B[part.interior[i]];
+
+  char trans[] = "N";
+  int kl = part.kl, ku = part.ku;
+  int ldA = 2*kl + ku + 1;
+  int nrhs = 1;
+  int info = 0;
+  DGBTRS(trans, &ni, &kl, &ku, &nrhs, part.Aii.data(), &ldA, w.iPiv.data(),
+         w.y.data(), &ni, &info);
+
+  if (nb > 0) {
+    double one = 1.0, zero = 0.0;
+    int inc = 1;
+    DGEMV("N", &nb, &ni, &one, part.Abi.data(), &nb, w.y.data(), &inc,
+          &zero, w.z.data(), &inc);
+  }
+  return info;
+}
+
+
+//
+// xi = y - Aii^-1 Aib xb
+//
+int
+SubstructureLinSolver::backward(int p)
+{
+  SubstructureLinSOE::Part &part = theSOE->parts[p];
+  Work &w = work[p];
+
+  int ni = (int)part.interior.size();
+  int nb = (int)part.interface.size();
+  if (ni == 0)
+    return 0;
+
+  if (nb > 0) {
+    for (int k=0; k<nb; k++)
+      w.z[k] = g[part.interface[k]];
+
+    double one = 1.0, minusOne = -1.0;
+    int inc = 1;
+    DGEMV("N", &ni, &nb, &minusOne, part.Aib.data(), &ni, w.z.data(), &inc,
+          &one, w.y.data(), &inc);
+  }
+
+  for (int i=0; i<ni; i++)
+    theSOE->X[part.interior[i]] = w.y[i];
+  return 0;
+}
+
+
+int
+SubstructureLinSolver::solve()
+{
+  assert(theSOE != nullptr);
+
+  const int numParts = (int)work.size();
+  int numInterface = theSOE->getNumInterfaceEqn();
+  std::vector<int> status(numParts, 0);
+
+  if (theSOE->factored == false) {
+    this->forEachPart([&](int p) {
+      status[p] = this->condense(p);
+    });
+
+    for (int p=0; p<numParts; p++)
+      if (status[p] != 0) {
+        opserr << "WARNING SubstructureLinSolver::solve - factorization of part " << p
+               << " failed with info " << status[p] << "\n";
+        return -1;
+      }
+
+    // assemble the Schur complement on the interface
+    for (int p=0; p<numParts; p++) {
+      const std::vector<int> &map = theSOE->parts[p].interface;
+      const std::vector<double> &S = work[p].S;
+      const int nb = (int)map.size();
+      for (int j=0; j<nb; j++) {
+        double *Aj = theSOE->Abb.data() + (std::size_t)map[j]*numInterface;
+        for (int i=0; i<nb; i++)
+          Aj[map[i]] -= S[i + (std::size_t)j*nb];
+      }
+      work[p].S.clear();
+      work[p].S.shrink_to_fit();
+    }
+
+    if (numInterface > 0) {
+      int info = 0;
+      DGETRF(&numInterface, &numInterface, theSOE->Abb.data(), &numInterface,
+             iPiv.data(), &info);
+      if (info != 0) {
+        opserr << "WARNING SubstructureLinSolver::solve - factorization of the interface "
+               << "failed with info " << info << "\n";
+        return -2;
+      }
+    }
+    theSOE->factored = true;
+  }
+
+  this->forEachPart([&](int p) {
+    status[p] = this->forward(p);
+  });
+
+  for (int p=0; p<numParts; p++)
+    if (status[p] != 0) {
+      opserr << "WARNING SubstructureLinSolver::solve - substitution in part " << p
+             << " failed with info " << status[p] << "\n";
+      return -3;
+    }
+
+  // condensed right hand side and interface solution
+  for (int k=0; k<numInterface; k++)
+    g[k] = theSOE->B[theSOE->interface[k]];
+
+  for (int p=0; p<numParts; p++) {
+    const std::vector<int> &map = theSOE->parts[p].interface;
+    for (int k=0; k<(int)map.size(); k++)
+      g[map[k]] -= work[p].z[k];
+  }
+
+  if (numInterface > 0) {
+    char trans[] = "N";
+    int nrhs = 1;
+    int info = 0;
+    DGETRS(trans, &numInterface, &nrhs, theSOE->Abb.data(), &numInterface,
+           iPiv.data(), g.data(), &numInterface, &info);
+    if (info != 0) {
+      opserr << "WARNING SubstructureLinSolver::solve - substitution on the interface "
+             << "failed with info " << info << "\n";
+      return -3;
+    }
+  }
+
+  for (int k=0; k<numInterface; k++)
+    theSOE->X[theSOE->interface[k]] = g[k];
+
+  this->forEachPart([&](int p) {
+    this->backward(p);
+  });
+
+  return 0;
+}
+
+
+int
+SubstructureLinSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return -1;
+}
+
+
+int
+SubstructureLinSolver::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return -1;
+}
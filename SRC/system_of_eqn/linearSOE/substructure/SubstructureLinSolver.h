@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SubstructureLinSolver solves a SubstructureLinSOE by static
+// condensation. Each part factors its interior block and forms its Schur
+// complement on the interface as a separate task on a pool of numThreads
+// threads; the condensed interface system is then assembled, factored and
+// solved on the calling thread, after which the interior unknowns of the
+// parts are recovered in parallel. Once factored, subsequent solves only
+// repeat the forward and back substitutions.
+//
+// Written: cmp
+//
+#ifndef SubstructureLinSolver_h
+#define SubstructureLinSolver_h
+
+#include <vector>
+#include <LinearSOESolver.h>
+
+class SubstructureLinSOE;
+
+namespace OpenSees {
+  class thread_pool;
+}
+
+class SubstructureLinSolver : public LinearSOESolver
+{
+  public:
+    SubstructureLinSolver(int numThreads = 1);
+    ~SubstructureLinSolver();
+
+    int solve();
+    int setSize();
+    int setLinearSOE(SubstructureLinSOE &theSOE);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  private:
+    template <class F> void forEachPart(F &&f);
+    int condense(int part);
+    int forward(int part);
+    int backward(int part);
+
+    SubstructureLinSOE *theSOE;
+    int numThreads;
+    OpenSees::thread_pool *threads;
+
+    // work areas of each part
+    struct Work {
+      std::vector<int>    iPiv;
+      std::vector<double> S;  // Abi Aii^-1 Aib
+      std::vector<double> y;  // Aii^-1 bi
+      std::vector<double> z;  // Abi y, then the interface solution
+    };
+    std::vector<Work> work;
+    std::vector<int>  iPiv;
+    std::vector<double> g;
+};
+
+#endif
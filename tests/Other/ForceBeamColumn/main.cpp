@@ -0,0 +1,146 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Micro-benchmark for the state determination of ForceBeamColumn3d. One
+// cantilever element with -sections Lobatto points, each a fiber section
+// of -fibers by -fibers Steel02 fibers, is driven through -steps steps of
+// a cyclic biaxial tip displacement of amplitude -amp times the yield
+// drift. Every step calls update(), getResistingForce() and commitState()
+// of the element. The time per update and a checksum of the resisting
+// forces are printed.
+//
+// A binary measures only the build of ForceBeamColumn3d it is linked
+// with; it cannot time the serial and the threaded section loops side by
+// side. To compare two versions of the element, or the serial loop with
+// the threaded one (ForceBeamColumn3d.cpp built with N_SECTION_THREADS
+// defined), build the library and this program twice and run both with
+// the same arguments; the checksums agree up to the order of summation.
+// It is built with -DOPS_BUILD_BENCHMARKS=ON.
+//
+//   ./forceBeamColumn -sections 10 -fibers 20 -steps 2000 -amp 4
+//
+// Written: cmp
+//
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include <StandardStream.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <Steel02.h>
+#include <ElasticMaterial.h>
+#include <FiberSection3d.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearCrdTransf3d.h>
+#include <ForceBeamColumn3d.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+int
+main(int argc, char **argv)
+{
+  int numSections = 5;
+  int numFibers = 10;
+  int numSteps = 1000;
+  double amp = 4.0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-sections") == 0 && i + 1 < argc)
+      numSections = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-fibers") == 0 && i + 1 < argc)
+      numFibers = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-steps") == 0 && i + 1 < argc)
+      numSteps = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-amp") == 0 && i + 1 < argc)
+      amp = atof(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s <-sections n> <-fibers n> <-steps n> <-amp a>\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (numSections < 2 || numSections > 10 || numFibers < 1) {
+    fprintf(stderr, "need 2 to 10 sections and at least one fiber\n");
+    return 1;
+  }
+
+  // 3 m cantilever with a 0.3 m square steel section
+  const double L = 3.0;
+  const double d = 0.3;
+  const double E = 200.0e9;
+  const double fy = 350.0e6;
+
+  Domain theDomain;
+  Node *nodeI = new Node(1, 6, 0.0, 0.0, 0.0);
+  Node *nodeJ = new Node(2, 6, L, 0.0, 0.0);
+  theDomain.addNode(nodeI);
+  theDomain.addNode(nodeJ);
+
+  Steel02 steel(1, fy, E, 0.01);
+  ElasticMaterial torsion(2, 1.0e9);
+
+  SectionForceDeformation *sections[10];
+  const double a = d/numFibers;
+  for (int i = 0; i < numSections; i++) {
+    FiberSection3d *section = new FiberSection3d(i+1, numFibers*numFibers, torsion);
+    for (int j = 0; j < numFibers; j++)
+      for (int k = 0; k < numFibers; k++)
+        section->addFiber(steel, a*a, -0.5*d + (j+0.5)*a, -0.5*d + (k+0.5)*a);
+    sections[i] = section;
+  }
+
+  LobattoBeamIntegration lobatto;
+  Vector vecxz(3);
+  vecxz(2) = 1.0;
+  LinearCrdTransf3d transf(1, vecxz);
+
+  ForceBeamColumn3d *theElement = new ForceBeamColumn3d(1, 1, 2, numSections, sections,
+                                                        lobatto, transf);
+  theDomain.addElement(theElement);
+
+  for (int i = 0; i < numSections; i++)
+    delete sections[i];
+
+  // tip drift at first yield of a cantilever
+  const double uy = fy/E*L*L/(1.5*d);
+
+  Vector u(6);
+  double checksum = 0.0;
+  int numFailed = 0;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (int n = 1; n <= numSteps; n++) {
+    const double t = 4.0*M_PI*n/numSteps;
+    u(1) = amp*uy*(double)n/numSteps*sin(t);
+    u(2) = 0.5*amp*uy*(double)n/numSteps*cos(t);
+    nodeJ->setTrialDisp(u);
+
+    if (theElement->update() < 0)
+      numFailed++;
+
+    const Vector &p = theElement->getResistingForce();
+    for (int i = 0; i < p.Size(); i++)
+      checksum += fabs(p(i));
+
+    theElement->commitState();
+    nodeJ->commitState();
+  }
+
+  auto stop = std::chrono::steady_clock::now();
+  const double seconds = std::chrono::duration<double>(stop - start).count();
+
+  printf("sections %d fibers %d steps %d failed %d\n",
+         numSections, numFibers*numFibers, numSteps, numFailed);
+  printf("time per update %.3f us, checksum %.10e\n", 1.0e6*seconds/numSteps, checksum);
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Unit test of NeighborDiagonalSOE and NeighborDiagonalSolver. Process r
+// holds the global equations r*m to (r+1)*m, so neighboring processes
+// share one equation. Every process adds the same diagonal to A and
+// r+1+i to B for each of its equations, so the interface equations have
+// twice the diagonal and the sum of the contributions of both processes
+// in B.
+//
+//  1) X is B/A with B and A summed over the processes.
+//  2) getB() returns the totals, and setB() of them leaves the totals
+//     and X unchanged, i.e. the interface is not summed twice.
+//  3) A solve that fails on a zero pivot leaves A as it was assembled, so
+//     that once the pivot is fixed the next solve is right.
+//
+// The program exits with a nonzero status if any check fails on any
+// process. It is run with
+//
+//   mpirun -np 3 ./neighborDiagonal
+//
+// Written: cmp
+//
+#include <mpi.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include <StandardStream.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <NeighborDiagonalSOE.h>
+#include <NeighborDiagonalSolver.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+namespace {
+
+const int m = 4;
+int rank, np;
+int numFailed = 0;
+
+void
+check(bool ok, const char *what)
+{
+  if (!ok) {
+    printf("  process %d FAILED: %s\n", rank, what);
+    numFailed++;
+  }
+}
+
+// the contributions of this process to B and A
+double
+localB(int dof)
+{
+  return rank + 1 + (dof - rank*m);
+}
+
+double
+totalB(int dof)
+{
+  double total = 0.0;
+  for (int r=0; r<np; r++)
+    if (dof >= r*m && dof <= (r+1)*m)
+      total += r + 1 + (dof - r*m);
+  return total;
+}
+
+double
+totalA(int dof)
+{
+  int count = 0;
+  for (int r=0; r<np; r++)
+    if (dof >= r*m && dof <= (r+1)*m)
+      count++;
+  return count;
+}
+
+void
+assemble(NeighborDiagonalSOE &theSOE, double diagonal, bool addB = true)
+{
+  Matrix a(1,1);
+  Vector b(1);
+  ID id(1);
+  for (int dof = rank*m; dof <= (rank+1)*m; dof++) {
+    id(0) = dof;
+    a(0,0) = diagonal;
+    b(0) = localB(dof);
+    theSOE.addA(a, id);
+    if (addB)
+      theSOE.addB(b, id);
+  }
+}
+
+// largest difference of X from B/A, over the local equations, with each
+// process adding diagonal to A
+double
+errorX(NeighborDiagonalSOE &theSOE, double diagonal)
+{
+  const Vector &X = theSOE.getX();
+  double error = 0.0;
+  for (int dof = rank*m; dof <= (rank+1)*m; dof++)
+    error = fmax(error, fabs(X(dof) - totalB(dof)/(diagonal*totalA(dof))));
+  return error;
+}
+
+}
+
+
+int
+main(int argc, char **argv)
+{
+  MPI_Init(&argc, &argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+  NeighborDiagonalSolver *theSolver = new NeighborDiagonalSolver();
+  NeighborDiagonalSOE theSOE(*theSolver);
+
+  Graph theGraph(m+1);
+  for (int dof = rank*m; dof <= (rank+1)*m; dof++)
+    theGraph.addVertex(new Vertex(dof, dof), false);
+  check(theSOE.setSize(theGraph) == 0, "setSize() failed");
+  check(theSOE.getNumInterfaceEqn() == (rank > 0) + (rank < np-1),
+        "wrong number of interface equations");
+
+  // 1) summed solve
+  assemble(theSOE, 1.0);
+  check(theSOE.solve() == 0, "solve() failed");
+  check(errorX(theSOE, 1.0) < 1.0e-14, "X differs from B/A");
+
+  // 2) round trip of the totals through setB()
+  Vector B(theSOE.getB());
+  double errorB = 0.0;
+  for (int dof = rank*m; dof <= (rank+1)*m; dof++)
+    errorB = fmax(errorB, fabs(B(dof) - totalB(dof)));
+  check(errorB < 1.0e-14, "getB() differs from the totals");
+
+  theSOE.setB(B);
+  const Vector &B2 = theSOE.getB();
+  for (int dof = rank*m; dof <= (rank+1)*m; dof++)
+    errorB = fmax(errorB, fabs(B2(dof) - totalB(dof)));
+  check(errorB < 1.0e-14, "setB() of the totals changes them");
+  check(theSOE.solve() == 0 && errorX(theSOE, 1.0) < 1.0e-14, "X changes after setB() of the totals");
+
+  // 3) a zero pivot on the interface, then fixed
+  theSOE.zeroA();
+  theSOE.zeroB();
+  assemble(theSOE, rank % 2 == 0 ? 4.0 : -4.0);
+  if (np > 1)
+    check(theSOE.solve() < 0, "a zero pivot was not reported");
+
+  // every process adds, so that all of them sum the interface again
+  assemble(theSOE, rank % 2 == 0 ? 0.0 : 8.0, false);
+  check(theSOE.solve() == 0, "solve() failed after the pivot was fixed");
+  check(errorX(theSOE, 4.0) < 1.0e-14, "X is wrong after a failed solve");
+
+  int failed = 0;
+  MPI_Allreduce(&numFailed, &failed, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (rank == 0)
+    printf("%s\n", failed == 0 ? "PASSED" : "FAILED");
+
+  MPI_Finalize();
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Scaling benchmark for the assembly of a distributed diagonal system with
+// MPI_NeighborExchange. A grid of nx by ny four-node elements with one
+// equation per node is split into blocks over a px by py grid of
+// processes. Each step every process computes its element residuals, with
+// a synthetic cost of -work square-root iterations per element node, adds
+// them into B, sums B on the interface with its neighbors and solves
+// X = B/A. Three ways of doing the step are timed:
+//
+//   overlap    the interface elements are assembled first, the exchange is
+//              posted, and the interior elements are assembled and solved
+//              while the messages are in flight
+//   post       the exchange is posted after all the elements, as the
+//              analysis does when the integrator assembles in model order
+//   allreduce  B is assembled into a vector of all the equations and summed
+//              with MPI_Allreduce, which is what a global collective costs
+//
+// The three give the same checksum up to the order of summation.
+//
+// The program is built by the CMakeLists.txt in this directory, and
+// run for an increasing number of processes with
+//
+//   for np in 1 2 4 8 16 32 64; do
+//     mpirun -np $np ./neighborExchange -nx 256 -ny 256 -work 20 -steps 50
+//   done
+//
+// Written: cmp
+//
+#include <mpi.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <StandardStream.h>
+#include <MPI_NeighborExchange.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+namespace {
+
+struct Block {
+  int nx, ny;                 // elements in the whole grid
+  int i0, i1, j0, j1;         // elements [i0,i1) x [j0,j1) are local
+  int numNodeX() const {return i1 - i0 + 1;}
+  int numDOF() const   {return numNodeX()*(j1 - j0 + 1);}
+  int local(int i, int j) const {return (j - j0)*numNodeX() + (i - i0);}
+  int global(int i, int j) const {return j*(nx + 1) + i;}
+};
+
+double
+elementWork(int e, int a, int work)
+{
+  const double x = 1.0 + 1.0e-3*((4*e + a) % 97);
+  double y = x;
+  for (int k=0; k<work; k++)
+    y = 0.5*(y + x/y);
+  return y;
+}
+
+void
+assemble(const Block &b, const std::vector<int> &elements, int work, double *B)
+{
+  for (int e : elements) {
+    const int i = e % b.nx;
+    const int j = e / b.nx;
+    const int nodes[4] = {b.local(i, j),   b.local(i+1, j),
+                          b.local(i+1, j+1), b.local(i, j+1)};
+    for (int a=0; a<4; a++)
+      B[nodes[a]] += elementWork(e, a, work);
+  }
+}
+
+void
+assembleGlobal(const Block &b, const std::vector<int> &elements, int work, double *B)
+{
+  for (int e : elements) {
+    const int i = e % b.nx;
+    const int j = e / b.nx;
+    const int nodes[4] = {b.global(i, j),   b.global(i+1, j),
+                          b.global(i+1, j+1), b.global(i, j+1)};
+    for (int a=0; a<4; a++)
+      B[nodes[a]] += elementWork(e, a, work);
+  }
+}
+
+}
+
+
+int
+main(int argc, char **argv)
+{
+  MPI_Init(&argc, &argv);
+
+  int rank, np;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+  int nx = 256, ny = 256, work = 20, steps = 50;
+  for (int i=1; i+1<argc; i+=2) {
+    if (strcmp(argv[i], "-nx") == 0)         nx    = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-ny") == 0)    ny    = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-work") == 0)  work  = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-steps") == 0) steps = atoi(argv[i+1]);
+  }
+
+  int dims[2] = {0, 0};
+  MPI_Dims_create(np, 2, dims);
+  const int px = dims[0], py = dims[1];
+  const int rx = rank % px, ry = rank / px;
+
+  Block b{nx, ny, rx*nx/px, (rx + 1)*nx/px, ry*ny/py, (ry + 1)*ny/py};
+  const int numDOF = b.numDOF();
+
+  std::vector<int> dofs(numDOF);
+  for (int j=b.j0; j<=b.j1; j++)
+    for (int i=b.i0; i<=b.i1; i++)
+      dofs[b.local(i, j)] = b.global(i, j);
+
+  double t0 = MPI_Wtime();
+  MPI_NeighborExchange theExchange;
+  theExchange.setUp(dofs.data(), numDOF);
+  const double setUpTime = MPI_Wtime() - t0;
+
+  const std::vector<int> &shared = theExchange.getShared();
+  const int numShared = (int)shared.size();
+
+  // elements touching the interface, and the others
+  std::vector<int> interface, interior, all;
+  for (int j=b.j0; j<b.j1; j++)
+    for (int i=b.i0; i<b.i1; i++) {
+      const int e = j*nx + i;
+      all.push_back(e);
+      if (theExchange.getSharedIndex(b.local(i, j))     >= 0 ||
+          theExchange.getSharedIndex(b.local(i+1, j))   >= 0 ||
+          theExchange.getSharedIndex(b.local(i+1, j+1)) >= 0 ||
+          theExchange.getSharedIndex(b.local(i, j+1))   >= 0)
+        interface.push_back(e);
+      else
+        interior.push_back(e);
+    }
+
+  // lumped diagonal, each element adding a quarter to its nodes
+  std::vector<double> A(numDOF, 0.0), invA(numDOF), B(numDOF), X(numDOF);
+  std::vector<double> sharedA(numShared), sharedB(numShared);
+  for (int e : all) {
+    const int i = e % nx, j = e / nx;
+    A[b.local(i, j)] += 0.25;     A[b.local(i+1, j)] += 0.25;
+    A[b.local(i+1, j+1)] += 0.25; A[b.local(i, j+1)] += 0.25;
+  }
+  {
+    const double *values[1] = {A.data()};
+    double *sums[1] = {sharedA.data()};
+    theExchange.start(values, 1);
+    theExchange.finish(sums);
+  }
+  for (int i=0; i<numDOF; i++)
+    invA[i] = 1.0/A[i];
+  for (int k=0; k<numShared; k++)
+    invA[shared[k]] = 1.0/sharedA[k];
+
+  // a node counts towards the checksum on the lowest process holding it
+  std::vector<char> owned(numDOF, 1);
+  for (int j=b.j0; j<=b.j1; j++)
+    for (int i=b.i0; i<=b.i1; i++)
+      if ((i == b.i0 && rx > 0) || (j == b.j0 && ry > 0))
+        owned[b.local(i, j)] = 0;
+
+  auto checksum = [&](const double *x) {
+    double local = 0.0, total = 0.0;
+    for (int i=0; i<numDOF; i++)
+      if (owned[i])
+        local += x[i];
+    MPI_Allreduce(&local, &total, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return total;
+  };
+
+  const double *values[1] = {B.data()};
+  double *sums[1] = {sharedB.data()};
+
+  const char *modes[3] = {"overlap", "post", "allreduce"};
+  std::vector<double> globalB;
+  if (np > 1)
+    globalB.resize((std::size_t)(nx + 1)*(ny + 1));
+
+  int maxNeighbors = 0, maxShared = 0;
+  const int numNeighbors = theExchange.getNumNeighbors();
+  MPI_Reduce(&numNeighbors, &maxNeighbors, 1, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&numShared, &maxShared, 1, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD);
+  if (rank == 0)
+    printf("# np %d grid %dx%d elements %d work %d steps %d neighbors %d interface %d setup %.3e s\n",
+           np, px, py, nx*ny, work, steps, maxNeighbors, maxShared, setUpTime);
+
+  for (int mode=0; mode<3; mode++) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    t0 = MPI_Wtime();
+
+    for (int step=0; step<steps; step++) {
+      std::fill(B.begin(), B.end(), 0.0);
+
+      if (mode == 0) {
+        assemble(b, interface, work, B.data());
+        theExchange.start(values, 1);
+        assemble(b, interior, work, B.data());
+        for (int i=0; i<numDOF; i++)
+          X[i] = B[i]*invA[i];
+        theExchange.finish(sums);
+        for (int k=0; k<numShared; k++)
+          X[shared[k]] = sharedB[k]*invA[shared[k]];
+
+      } else if (mode == 1) {
+        assemble(b, all, work, B.data());
+        theExchange.start(values, 1);
+        theExchange.finish(sums);
+        for (int i=0; i<numDOF; i++)
+          X[i] = B[i]*invA[i];
+        for (int k=0; k<numShared; k++)
+          X[shared[k]] = sharedB[k]*invA[shared[k]];
+
+      } else if (np > 1) {
+        std::fill(globalB.begin(), globalB.end(), 0.0);
+        assembleGlobal(b, all, work, globalB.data());
+        MPI_Allreduce(MPI_IN_PLACE, globalB.data(), (int)globalB.size(), MPI_DOUBLE,
+                      MPI_SUM, MPI_COMM_WORLD);
+        for (int i=0; i<numDOF; i++)
+          X[i] = globalB[dofs[i]]*invA[i];
+
+      } else {
+        assemble(b, all, work, B.data());
+        for (int i=0; i<numDOF; i++)
+          X[i] = B[i]*invA[i];
+      }
+    }
+
+    double elapsed = MPI_Wtime() - t0, slowest = 0.0;
+    MPI_Reduce(&elapsed, &slowest, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    const double sum = checksum(X.data());
+    if (rank == 0)
+      printf("%-10s np %3d  %.4e s/step  checksum %.17g\n", modes[mode], np, slowest/steps, sum);
+  }
+
+  MPI_Finalize();
+  return 0;
+}
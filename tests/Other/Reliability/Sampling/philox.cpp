@@ -0,0 +1,218 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Unit test of PhiloxRandGenerator and SamplingStatistics.
+//
+//  1) The Philox4x32-10 block function reproduces the known answers of
+//     the Random123 distribution (kat_vectors) for three counter/key
+//     pairs.
+//  2) The numbers of a sample are the block function of the counter
+//     (pair, 0, sample) and the key (seed, 0x4F70), drawn the same
+//     through fillUniformNumbers(), setSample() and the stream of
+//     generate_nIndependentUniformNumbers().
+//  3) Statistics accumulated one sample at a time with add(), and those
+//     of unequal groups of the samples combined with merge(), agree with
+//     the means, variances and correlations of a two-pass evaluation.
+//
+// The program exits with a nonzero status if any check fails. It is built
+// with -DOPS_BUILD_BENCHMARKS=ON.
+//
+// Written: cmp
+//
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+#include <StandardStream.h>
+#include <Vector.h>
+#include <PhiloxRandGenerator.h>
+#include <SamplingStatistics.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int numFailed = 0;
+
+static void
+check(bool ok, const char *what)
+{
+  if (!ok) {
+    printf("  FAILED: %s\n", what);
+    numFailed++;
+  }
+}
+
+// 53 bits of two words to (0,1), as PhiloxRandGenerator does
+static double
+toUnit(uint32_t a, uint32_t b)
+{
+  const uint64_t bits = ((uint64_t)(a >> 5) << 26) | (b >> 6);
+  return ((double)bits + 0.5)/9007199254740992.0;
+}
+
+static void
+testKnownAnswers()
+{
+  struct {
+    uint32_t ctr[4];
+    uint32_t key[2];
+    uint32_t expected[4];
+  } kat[] = {
+    {{0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u},
+     {0x00000000u, 0x00000000u},
+     {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}},
+    {{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+     {0xffffffffu, 0xffffffffu},
+     {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}},
+    {{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+     {0xa4093822u, 0x299f31d0u},
+     {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}},
+  };
+
+  for (auto &k : kat) {
+    uint32_t ctr[4] = {k.ctr[0], k.ctr[1], k.ctr[2], k.ctr[3]};
+    PhiloxRandGenerator::block(ctr, k.key[0], k.key[1]);
+    printf("  ctr %08x %08x %08x %08x key %08x %08x -> %08x %08x %08x %08x\n",
+           k.ctr[0], k.ctr[1], k.ctr[2], k.ctr[3], k.key[0], k.key[1],
+           ctr[0], ctr[1], ctr[2], ctr[3]);
+    check(ctr[0] == k.expected[0] && ctr[1] == k.expected[1] &&
+          ctr[2] == k.expected[2] && ctr[3] == k.expected[3],
+          "Philox4x32-10 known answer");
+  }
+}
+
+static void
+testSamples()
+{
+  const int seed = 12345;
+  const int n = 5;
+  PhiloxRandGenerator generator(seed);
+
+  bool counterOK = true, streamOK = true, positionOK = true, rangeOK = true;
+  double u[n];
+  for (long k=0; k<20; k++) {
+    // the numbers of sample k from the block function
+    double expected[n];
+    const long sample = k == 19 ? 0x123456789L : k;
+    for (int j=0; j<n; j+=2) {
+      uint32_t ctr[4] = {(uint32_t)(j/2), 0u, (uint32_t)sample, (uint32_t)((uint64_t)sample >> 32)};
+      PhiloxRandGenerator::block(ctr, (uint32_t)seed, 0x4F70u);
+      expected[j] = toUnit(ctr[0], ctr[1]);
+      if (j+1 < n)
+        expected[j+1] = toUnit(ctr[2], ctr[3]);
+    }
+
+    generator.fillUniformNumbers(sample, n, u);
+    for (int j=0; j<n; j++) {
+      counterOK = counterOK && u[j] == expected[j];
+      rangeOK = rangeOK && u[j] > 0.0 && u[j] < 1.0;
+    }
+
+    // the stream draws the samples in order, from the position set
+    if (k == 19)
+      generator.setSample(sample);
+    if (generator.getSample() != sample)
+      positionOK = false;
+    generator.generate_nIndependentUniformNumbers(n, 0.0, 1.0);
+    const Vector &drawn = generator.getGeneratedNumbers();
+    for (int j=0; j<n; j++)
+      streamOK = streamOK && drawn(j) == expected[j];
+  }
+
+  printf("  samples: counter %s, stream %s, position %s\n",
+         counterOK ? "ok" : "wrong", streamOK ? "ok" : "wrong", positionOK ? "ok" : "wrong");
+  check(counterOK, "fillUniformNumbers differs from the block function");
+  check(rangeOK, "a uniform number is not strictly between 0 and 1");
+  check(streamOK, "the stream differs from fillUniformNumbers");
+  check(positionOK, "the stream is not at the expected sample");
+}
+
+static void
+testStatistics()
+{
+  const int numQ = 3;
+  const int numSamples = 1000;
+
+  // correlated quantities with a large common offset, which a one-pass
+  // sum of squares would lose
+  std::vector<double> q(numSamples*numQ);
+  PhiloxRandGenerator generator(7);
+  for (int k=0; k<numSamples; k++) {
+    double u[numQ];
+    generator.fillUniformNumbers(k, numQ, u);
+    q[k*numQ+0] = 1.0e6 + u[0];
+    q[k*numQ+1] = 2.0*u[0] + u[1];
+    q[k*numQ+2] = -3.0 + u[2]*u[2];
+  }
+
+  // two-pass reference
+  double mean[numQ] = {0.0}, comoment[numQ][numQ] = {{0.0}};
+  for (int k=0; k<numSamples; k++)
+    for (int i=0; i<numQ; i++)
+      mean[i] += q[k*numQ+i];
+  for (int i=0; i<numQ; i++)
+    mean[i] /= numSamples;
+  for (int k=0; k<numSamples; k++)
+    for (int i=0; i<numQ; i++)
+      for (int j=0; j<numQ; j++)
+        comoment[i][j] += (q[k*numQ+i] - mean[i])*(q[k*numQ+j] - mean[j]);
+
+  // one at a time, and unequal groups merged, with an empty group
+  SamplingStatistics serial(numQ), merged(numQ), group(numQ);
+  for (int k=0; k<numSamples; k++)
+    serial.add(&q[k*numQ]);
+
+  const int bounds[] = {0, 1, 2, 37, 37, 400, 999, numSamples};
+  for (int g=0; g+1 < (int)(sizeof(bounds)/sizeof(int)); g++) {
+    group.zero();
+    for (int k=bounds[g]; k<bounds[g+1]; k++)
+      group.add(&q[k*numQ]);
+    merged.merge(group);
+  }
+
+  SamplingStatistics *stats[2] = {&serial, &merged};
+  const char *name[2] = {"add", "merge"};
+  for (int s=0; s<2; s++) {
+    const SamplingStatistics &st = *stats[s];
+    double meanError = 0.0, varError = 0.0, corrError = 0.0;
+    for (int i=0; i<numQ; i++) {
+      meanError = fmax(meanError, fabs(st.getMean(i) - mean[i])/fabs(mean[i]));
+      const double var = comoment[i][i]/(numSamples-1);
+      varError = fmax(varError, fabs(st.getVariance(i) - var)/var);
+      const double varOfMean = comoment[i][i]/numSamples/numSamples;
+      varError = fmax(varError, fabs(st.getVarianceOfMean(i) - varOfMean)/varOfMean);
+      for (int j=0; j<numQ; j++) {
+        const double corr = comoment[i][j]/sqrt(comoment[i][i]*comoment[j][j]);
+        corrError = fmax(corrError, fabs(st.getCorrelation(i,j) - corr));
+      }
+    }
+    printf("  %-6s count %ld, relative errors: mean %.2e variance %.2e correlation %.2e\n",
+           name[s], st.getCount(), meanError, varError, corrError);
+    check(st.getCount() == numSamples, "wrong number of samples");
+    check(meanError < 1.0e-14, "means differ from the two-pass values");
+    check(varError < 1.0e-9, "variances differ from the two-pass values");
+    check(corrError < 1.0e-10, "correlations differ from the two-pass values");
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  printf("Philox4x32-10 known answers\n");
+  testKnownAnswers();
+  printf("PhiloxRandGenerator samples\n");
+  testSamples();
+  printf("SamplingStatistics against two passes\n");
+  testStatistics();
+
+  if (numFailed != 0) {
+    printf("%d checks FAILED\n", numFailed);
+    return 1;
+  }
+  printf("PASSED\n");
+  return 0;
+}
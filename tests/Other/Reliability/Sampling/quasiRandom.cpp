@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Unit test of the quasi-random generators.
+//
+//  1) Less its random digital shift, which cancels in the exclusive or of
+//     two points of a replicate, SobolSequenceGenerator reproduces the
+//     first 32 points in all 21 dimensions of the reference implementation
+//     of Joe and Kuo (sobol.cc with new-joe-kuo-6.21201). The reference
+//     emits the points in Gray code order, so its point p is point
+//     p^(p>>1) of the generator.
+//  2) Less its random rotation, coordinate j of point k of
+//     HaltonSequenceGenerator is the radical inverse of k+1 in the j-th
+//     prime.
+//  3) Each replicate of LatinHypercubeGenerator places exactly one of
+//     every numPoints consecutive points in each stratum of each
+//     coordinate.
+//
+// The program exits with a nonzero status if any check fails. It is built
+// with -DOPS_BUILD_BENCHMARKS=ON.
+//
+// Written: cmp
+//
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+#include <StandardStream.h>
+#include <Vector.h>
+#include <SobolSequenceGenerator.h>
+#include <HaltonSequenceGenerator.h>
+#include <LatinHypercubeGenerator.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int numFailed = 0;
+
+static void
+check(bool ok, const char *what)
+{
+  if (!ok) {
+    printf("  FAILED: %s\n", what);
+    numFailed++;
+  }
+}
+
+// the coordinates of sample k
+static const Vector &
+draw(QuasiRandomGenerator &generator, long k, int n)
+{
+  generator.setSample(k);
+  generator.generate_nIndependentUniformNumbers(n, 0.0, 1.0);
+  return generator.getGeneratedNumbers();
+}
+
+//
+// first 32 points of Joe and Kuo in 21 dimensions, in units of 1/32
+//
+const int numSobolPoints = 32;
+const int numSobolDimensions = 21;
+const int joeKuo[numSobolPoints][numSobolDimensions] = {
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    {16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {24,  8,  8,  8, 24, 24,  8, 24, 24, 24, 24, 24,  8,  8, 24,  8, 24,  8, 24,  8,  8},
+    { 8, 24, 24, 24,  8,  8, 24,  8,  8,  8,  8,  8, 24, 24,  8, 24,  8, 24,  8, 24, 24},
+    {12, 12, 20, 28, 12,  4, 12, 28, 28, 20, 28, 12, 12, 20, 12, 28, 12, 28, 28,  4,  4},
+    {28, 28,  4, 12, 28, 20, 28, 12, 12,  4, 12, 28, 28,  4, 28, 12, 28, 12, 12, 20, 20},
+    {20,  4, 28, 20, 20, 28,  4,  4,  4, 12,  4, 20,  4, 28, 20, 20, 20, 20,  4, 12, 12},
+    { 4, 20, 12,  4,  4, 12, 20, 20, 20, 28, 20,  4, 20, 12,  4,  4,  4,  4, 20, 28, 28},
+    { 6, 10, 30, 14, 18, 10, 14, 30, 30, 10, 22,  2, 30, 30, 26, 30, 26, 26, 30, 10,  6},
+    {22, 26, 14, 30,  2, 26, 30, 14, 14, 26,  6, 18, 14, 14, 10, 14, 10, 10, 14, 26, 22},
+    {30,  2, 22,  6, 10, 18,  6,  6,  6, 18, 14, 26, 22, 22,  2, 22,  2, 18,  6,  2, 14},
+    {14, 18,  6, 22, 26,  2, 22, 22, 22,  2, 30, 10,  6,  6, 18,  6, 18,  2, 22, 18, 30},
+    {10,  6, 10, 18, 30, 14,  2,  2,  2, 30, 10, 14, 18, 10, 22,  2, 22,  6,  2, 14,  2},
+    {26, 22, 26,  2, 14, 30, 18, 18, 18, 14, 26, 30,  2, 26,  6, 18,  6, 22, 18, 30, 18},
+    {18, 14,  2, 26,  6, 22, 10, 26, 26,  6, 18, 22, 26,  2, 14, 10, 14, 14, 26,  6, 10},
+    { 2, 30, 18, 10, 22,  6, 26, 10, 10, 22,  2,  6, 10, 18, 30, 26, 30, 30, 10, 22, 26},
+    { 3, 15, 15, 21,  9, 31, 17, 27, 15,  5,  3, 13, 21, 21, 11,  1, 25, 19, 25,  1, 23},
+    {19, 31, 31,  5, 25, 15,  1, 11, 31, 21, 19, 29,  5,  5, 27, 17,  9,  3,  9, 17,  7},
+    {27,  7,  7, 29, 17,  7, 25,  3, 23, 29, 27, 21, 29, 29, 19,  9,  1, 27,  1,  9, 31},
+    {11, 23, 23, 13,  1, 23,  9, 19,  7, 13, 11,  5, 13, 13,  3, 25, 17, 11, 17, 25, 15},
+    {15,  3, 27,  9,  5, 27, 29,  7, 19, 17, 31,  1, 25,  1,  7, 29, 21, 15,  5,  5, 19},
+    {31, 19, 11, 25, 21, 11, 13, 23,  3,  1, 15, 17,  9, 17, 23, 13,  5, 31, 21, 21,  3},
+    {23, 11, 19,  1, 29,  3, 21, 31, 11,  9,  7, 25, 17,  9, 31, 21, 13,  7, 29, 13, 27},
+    { 7, 27,  3, 17, 13, 19,  5, 15, 27, 25, 23,  9,  1, 25, 15,  5, 29, 23, 13, 29, 11},
+    { 5,  5, 17, 27, 27, 21, 31,  5, 17, 15, 21, 15, 11, 11, 17, 31,  3,  9,  7, 11, 17},
+    {21, 21,  1, 11, 11,  5, 15, 21,  1, 31,  5, 31, 27, 27,  1, 15, 19, 25, 23, 27,  1},
+    {29, 13, 25, 19,  3, 13, 23, 29,  9, 23, 13, 23,  3,  3,  9, 23, 27,  1, 31,  3, 25},
+    {13, 29,  9,  3, 19, 29,  7, 13, 25,  7, 29,  7, 19, 19, 25,  7, 11, 17, 15, 19,  9},
+    { 9,  9,  5,  7, 23, 17, 19, 25, 13, 27,  9,  3,  7, 31, 29,  3, 15, 21, 27, 15, 21},
+    {25, 25, 21, 23,  7,  1,  3,  9, 29, 11, 25, 19, 23, 15, 13, 19, 31,  5, 11, 31,  5},
+    {17,  1, 13, 15, 15,  9, 27,  1, 21,  3, 17, 27, 15, 23,  5, 11, 23, 29,  3,  7, 29},
+    { 1, 17, 29, 31, 31, 25, 11, 17,  5, 19,  1, 11, 31,  7, 21, 27,  7, 13, 19, 23, 13},
+};
+
+static void
+testSobol()
+{
+  SobolSequenceGenerator generator(1, 2024);
+
+  // the 32 bits of a coordinate, u = (x + 1/2)/2^32
+  std::vector<uint32_t> first(numSobolDimensions);
+  const Vector &u0 = draw(generator, 0, numSobolDimensions);
+  for (int j=0; j<numSobolDimensions; j++)
+    first[j] = (uint32_t)(u0(j)*4294967296.0 - 0.5);
+
+  int numWrong = 0;
+  for (int p=0; p<numSobolPoints; p++) {
+    const Vector &u = draw(generator, p ^ (p >> 1), numSobolDimensions);
+    for (int j=0; j<numSobolDimensions; j++) {
+      const uint32_t x = (uint32_t)(u(j)*4294967296.0 - 0.5) ^ first[j];
+      if (x != (uint32_t)joeKuo[p][j] << 27) {
+        if (numWrong++ < 5)
+          printf("  point %d dimension %d: %.8f, Joe-Kuo %.8f\n", p, j+1,
+                 x/4294967296.0, joeKuo[p][j]/32.0);
+      }
+    }
+  }
+  printf("  %d points in %d dimensions, %d coordinates differ\n",
+         numSobolPoints, numSobolDimensions, numWrong);
+  check(numWrong == 0, "Sobol points differ from Joe-Kuo");
+}
+
+static void
+testHalton()
+{
+  const int primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29};
+  const int n = sizeof(primes)/sizeof(int);
+  const int numPoints = 200;
+  HaltonSequenceGenerator generator(1, 99);
+
+  std::vector<double> first(n);
+  const Vector &u0 = draw(generator, 0, n);
+  for (int j=0; j<n; j++)
+    first[j] = u0(j);
+
+  double maxError = 0.0;
+  for (int k=0; k<numPoints; k++) {
+    const Vector &u = draw(generator, k, n);
+    for (int j=0; j<n; j++) {
+      // radical inverse of k+1 as a fraction of integers
+      long numerator = 0, denominator = 1;
+      for (long i = k+1; i > 0; i /= primes[j]) {
+        numerator = numerator*primes[j] + i % primes[j];
+        denominator *= primes[j];
+      }
+      const double inverse = (double)numerator/denominator;
+
+      // point 0 is the radical inverse of 1, i.e. 1/b
+      double x = u(j) - first[j] + 1.0/primes[j];
+      x -= floor(x);
+      maxError = fmax(maxError, fmin(fabs(x - inverse), 1.0 - fabs(x - inverse)));
+    }
+  }
+  printf("  %d points in %d dimensions, largest difference %.2e\n", numPoints, n, maxError);
+  check(maxError < 1.0e-12, "Halton points differ from the radical inverses");
+}
+
+static void
+testLatinHypercube()
+{
+  const int numPoints = 50;
+  const int numReplicates = 3;
+  const int n = 4;
+  const int numDesigns = 2;
+  LatinHypercubeGenerator generator(numPoints, numReplicates, 31);
+
+  bool stratified = true, inRange = true, designsDiffer = false;
+  std::vector<int> firstStrata(numReplicates*n*numPoints);
+  for (int design=0; design<numDesigns; design++) {
+    for (int r=0; r<numReplicates; r++) {
+      std::vector<int> count(n*numPoints, 0);
+      for (int p=0; p<numPoints; p++) {
+        const long k = ((long)design*numPoints + p)*numReplicates + r;
+        const Vector &u = draw(generator, k, n);
+        for (int j=0; j<n; j++) {
+          inRange = inRange && u(j) > 0.0 && u(j) < 1.0;
+          int stratum = (int)floor(u(j)*numPoints);
+          if (stratum < 0 || stratum >= numPoints)
+            continue;
+          count[j*numPoints + stratum]++;
+          int &firstStratum = firstStrata[(r*n + j)*numPoints + p];
+          if (design == 0)
+            firstStratum = stratum;
+          else if (firstStratum != stratum)
+            designsDiffer = true;
+        }
+      }
+      for (int i=0; i<n*numPoints; i++)
+        stratified = stratified && count[i] == 1;
+    }
+  }
+  printf("  %d designs of %d replicates of %d points in %d dimensions: %s\n",
+         numDesigns, numReplicates, numPoints, n, stratified ? "stratified" : "not stratified");
+  check(inRange, "a coordinate is not strictly between 0 and 1");
+  check(stratified, "a stratum of a replicate has no point or more than one");
+  check(designsDiffer, "the designs are not permuted independently");
+}
+
+int
+main(int argc, char **argv)
+{
+  printf("Sobol sequence against Joe and Kuo\n");
+  testSobol();
+  printf("Halton sequence against radical inverses\n");
+  testHalton();
+  printf("Latin hypercube stratification\n");
+  testLatinHypercube();
+
+  if (numFailed != 0) {
+    printf("%d checks FAILED\n", numFailed);
+    return 1;
+  }
+  printf("PASSED\n");
+  return 0;
+}
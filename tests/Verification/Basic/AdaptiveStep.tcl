@@ -0,0 +1,123 @@
+
+# Adaptive time step
+#
+# An undamped SDOF oscillator under a suddenly applied constant load P
+# has the exact response u(t) = P/k (1 - cos(wn t)).
+#
+# 1) Newmark and HHT with the step adapted to the local error estimate
+#    must follow the exact response, with every accepted step within
+#    the tolerance.
+# 2) For a load so small that the displacements are below the absolute
+#    tolerance, no step may be rejected.
+# 3) An integrator that provides no error estimate is rejected.
+# 4) The legacy variable step form, analyze n dT dtMin dtMax Jd, is not
+#    taken for the adaptive form when dtMin is negative.
+
+puts "AdaptiveStep.tcl: Verification of the adaptive time step"
+
+set testOK 0
+
+set PI [expr 2.0*asin(1.0)]
+set k  100.0
+set Tn 1.0
+set m  [expr $k*$Tn*$Tn/(4.0*$PI*$PI)]
+set wn [expr 2.0*$PI/$Tn]
+
+# procedure to build the oscillator loaded by P
+proc buildModel {P integrator} {
+    global k m
+
+    wipe
+    model basic -ndm 1 -ndf 1
+    node 1 0.0
+    node 2 0.0 -mass $m
+    fix 1 1
+    uniaxialMaterial Elastic 1 $k
+    element zeroLength 1 1 2 -mat 1 -dir 1
+    timeSeries Constant 1
+    pattern Plain 1 1 {
+        load 2 $P
+    }
+
+    constraints Plain
+    numberer Plain
+    system ProfileSPD
+    test NormDispIncr 1.0e-12 10 0
+    algorithm Newton
+    integrator {*}$integrator
+    analysis Transient
+}
+
+#
+# 1) adapted steps follow the exact response
+#
+set P 10.0
+foreach integrator {{Newmark 0.5 0.25} {HHT 0.9}} {
+    buildModel $P $integrator
+    if {[analyze 15 0.1 -tol 1.0e-4 -min 1.0e-5 -max 0.1] != 0} {
+        puts "  adaptive analysis with $integrator failed"
+        set testOK -1
+        continue
+    }
+    array set stats [adaptiveStats]
+
+    set t [getTime]
+    set u [nodeDisp 2 1]
+    set exact [expr $P/$k*(1.0 - cos($wn*$t))]
+    set error [expr abs($u - $exact)/($P/$k)]
+    puts [format "  %-16s t %.4f u %.6f exact %.6f, accepted %d rejected %d, max error %.3f" \
+              $integrator $t $u $exact $stats(accepted) $stats(rejected) $stats(maxError)]
+    if {abs($t - 1.5) > 1.0e-10 || $error > 1.0e-3} {
+        puts "  $integrator does not follow the exact response"
+        set testOK -1
+    }
+    if {$stats(maxError) > 1.0 || $stats(rejected) + $stats(failed) > $stats(accepted)} {
+        puts "  $integrator accepted a step above the tolerance or rejected too many"
+        set testOK -1
+    }
+    if {$stats(maxStep) >= 0.1} {
+        puts "  $integrator was not refined"
+        set testOK -1
+    }
+}
+
+#
+# 2) displacements below the absolute tolerance
+#
+buildModel 1.0e-8 {Newmark 0.5 0.25}
+analyze 20 0.1 -tol 1.0e-4 -max 0.1
+array set stats [adaptiveStats]
+puts [format "  small load: accepted %d rejected %d" $stats(accepted) $stats(rejected)]
+if {$stats(rejected) != 0 || $stats(accepted) != 20} {
+    puts "  steps were rejected for displacements below the absolute tolerance"
+    set testOK -1
+}
+
+#
+# 3) no error estimate
+#
+buildModel $P {CentralDifference}
+if {[analyze 10 0.01 -tol 1.0e-4] >= 0} {
+    puts "  the adaptive step was accepted for CentralDifference"
+    set testOK -1
+}
+
+#
+# 4) legacy variable step with a negative dtMin
+#
+buildModel $P {Newmark 0.5 0.25}
+if {[catch {analyze 10 0.01 -0.001 0.02 10} ok] || $ok != 0} {
+    puts "  analyze numIncr dT dtMin dtMax Jd failed for dtMin < 0"
+    set testOK -1
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test AdaptiveStep.tcl \n\n"
+    puts $results "| PASSED |  AdaptiveStep.tcl"
+} else {
+    puts "\nFAILED Verification Test AdaptiveStep.tcl \n\n"
+    puts $results "FAILED : AdaptiveStep.tcl"
+}
+close $results
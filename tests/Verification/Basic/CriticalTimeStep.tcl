@@ -0,0 +1,74 @@
+
+# Critical time step
+#
+# An SDOF oscillator of mass m and stiffness k has omega = sqrt(k/m),
+# for which the central difference method is stable up to 2/omega.
+#
+# 1) criticalTimeStep and the step taken by analyze -safety 1.0 with
+#    ExplicitDifference equal 2/omega.
+# 2) With Rayleigh damping the step of ExplicitDifference is reduced to
+#    2/omega (sqrt(1+xi^2) - xi), xi = alphaM/(2 omega) + betaK omega/2.
+
+puts "CriticalTimeStep.tcl: Verification of the critical time step estimate"
+
+set testOK 0
+
+set k 100.0
+set m 1.0
+set omega [expr sqrt($k/$m)]
+
+proc buildModel {alphaM betaK} {
+    global k m
+
+    wipe
+    model basic -ndm 1 -ndf 1
+    node 1 0.0
+    node 2 0.0 -mass $m
+    fix 1 1
+    uniaxialMaterial Elastic 1 $k
+    element zeroLength 1 1 2 -mat 1 -dir 1
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load 2 1.0
+    }
+
+    constraints Plain
+    numberer Plain
+    system FullGeneral
+    test NormDispIncr 1.0e-12 10 0
+    algorithm Linear
+    integrator ExplicitDifference
+    analysis Transient
+    rayleigh $alphaM $betaK 0.0 0.0
+}
+
+foreach {alphaM betaK case} {0.0 0.0 undamped 0.0 0.02 stiffness 1.0 0.0 mass 1.0 0.02 Rayleigh} {
+    set xi [expr 0.5*$alphaM/$omega + 0.5*$betaK*$omega]
+    set exact [expr 2.0/$omega*(sqrt(1.0 + $xi*$xi) - $xi)]
+
+    buildModel $alphaM $betaK
+    set dtDomain [criticalTimeStep]
+    analyze 1 -safety 1.0
+    set dt [getTime %.15g]
+
+    puts [format "  %-9s xi %.3f  step %.8f  exact %.8f  undamped %.8f" $case $xi $dt $exact $dtDomain]
+    if {abs($dtDomain - 2.0/$omega) > 1.0e-10*$dtDomain} {
+        puts "  criticalTimeStep differs from 2/omega"
+        set testOK -1
+    }
+    if {abs($dt - $exact) > 1.0e-10*$exact} {
+        puts "  the $case step of ExplicitDifference is wrong"
+        set testOK -1
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test CriticalTimeStep.tcl \n\n"
+    puts $results "| PASSED |  CriticalTimeStep.tcl"
+} else {
+    puts "\nFAILED Verification Test CriticalTimeStep.tcl \n\n"
+    puts $results "FAILED : CriticalTimeStep.tcl"
+}
+close $results
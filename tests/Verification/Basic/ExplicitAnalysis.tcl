@@ -0,0 +1,172 @@
+
+# Explicit Analysis - lumped mass central difference engine
+#
+# 1) An undamped SDOF oscillator under a suddenly applied constant load,
+#    u(t) = P/k (1 - cos(wn t)), checked at the peak t = T/2.
+# 2) A fixed-free chain of springs, and beside it a chain of trusses,
+#    run with one and with four threads; the threaded updates of the
+#    reentrant springs, done while the trusses are updated serially,
+#    must reproduce the serial response at every node.
+# 3) The profiler counts the element updates of the explicit engine as
+#    domain updates.
+# 4) The SDOF oscillator of 1) under a constant ground acceleration ag
+#    has the relative response u(t) = -m ag/k (1 - cos(wn t)); with the
+#    mass on the elements, the ground motion is rejected.
+
+puts "ExplicitAnalysis.tcl: Verification of the explicit analysis"
+
+set PI [expr 2.0*asin(1.0)]
+set testOK 0
+set tol 1.0e-3
+
+# procedure to build a chain of numEle springs, fixed at node 0, with
+# a constant load P at the free end; with trusses, a chain of numEle
+# trusses of unit length and stiffness k is added from node 1000
+proc buildChain {numEle k m P {trusses 0}} {
+    wipe
+    model basic -ndm 1 -ndf 1
+    uniaxialMaterial Elastic 1 $k
+    node 0 0.0
+    fix 0 1
+    for {set i 1} {$i <= $numEle} {incr i} {
+        node $i 0.0 -mass $m
+        element zeroLength $i [expr $i-1] $i -mat 1 -dir 1
+    }
+    if {$trusses} {
+        node 1000 0.0
+        fix 1000 1
+        for {set i 1} {$i <= $numEle} {incr i} {
+            node [expr 1000+$i] [expr double($i)] -mass $m
+            element Truss [expr 1000+$i] [expr 999+$i] [expr 1000+$i] 1.0 1
+        }
+    }
+    timeSeries Constant 1
+    pattern Plain 1 1 {
+        load $numEle $P
+        if {$trusses} {
+            load [expr 1000+$numEle] [expr 0.5*$P]
+        }
+    }
+}
+
+#
+# 1) SDOF
+#
+set k 10.0
+set m 0.2533
+set P 1.0
+set wn [expr sqrt($k/$m)]
+set Tn [expr 2.0*$PI/$wn]
+
+buildChain 1 $k $m $P
+analysis Explicit
+set numSteps 1000
+set dt [expr 0.5*$Tn/$numSteps]
+analyze $numSteps $dt
+
+set u [nodeDisp 1 1]
+set uExact [expr 2.0*$P/$k]
+set err [expr abs($u - $uExact)/$uExact]
+puts [format "  SDOF peak displacement %.6f exact %.6f" $u $uExact]
+if {$err > $tol} {
+    puts "  SDOF peak displacement is outside the tolerance"
+    set testOK -1
+}
+
+#
+# 2) threaded element updates
+#
+set numEle 40
+foreach numThreads {1 4} {
+    buildChain $numEle $k $m $P 1
+    analysis Explicit -threads $numThreads
+    analyze 500 0.001
+    foreach node [getNodeTags] {
+        set chainDisp($numThreads,$node) [nodeDisp $node 1]
+        set chainVel($numThreads,$node)  [nodeVel $node 1]
+    }
+}
+puts [format "  chain tip displacement %.10e serial %.10e threaded" \
+          $chainDisp(1,$numEle) $chainDisp(4,$numEle)]
+set numDiffer 0
+foreach node [getNodeTags] {
+    if {abs($chainDisp(4,$node) - $chainDisp(1,$node)) > 1.0e-12*abs($chainDisp(1,$numEle))
+        || abs($chainVel(4,$node) - $chainVel(1,$node)) > 1.0e-12*abs($chainVel(1,$numEle))} {
+        incr numDiffer
+    }
+}
+if {$numDiffer > 0 || $chainDisp(1,$numEle) == 0.0 || $chainDisp(1,[expr 1000+$numEle]) == 0.0} {
+    puts "  threaded response differs from the serial response at $numDiffer nodes"
+    set testOK -1
+}
+
+#
+# 3) profiler
+#
+buildChain $numEle $k $m $P
+analysis Explicit -threads 4
+profile reset
+profile on -elements
+analyze 10 0.001
+profile off
+set report [profile report -json]
+profile reset
+if {![regexp {"domainUpdate": \{"calls": ([0-9]+)} $report -> calls] || $calls < 10} {
+    puts "  the profiler did not record the domain updates"
+    set testOK -1
+}
+if {![regexp {"class": "ZeroLength", "update": \{"calls": ([0-9]+)} $report -> calls]
+    || $calls < 10*$numEle} {
+    puts "  the profiler did not record the element updates"
+    set testOK -1
+}
+
+#
+# 4) ground acceleration
+#
+set ag 2.0
+proc buildBase {k m ag elementMass} {
+    wipe
+    model basic -ndm 1 -ndf 1
+    uniaxialMaterial Elastic 1 $k
+    node 0 0.0
+    fix 0 1
+    if {$elementMass} {
+        node 1 1.0
+        element Truss 1 0 1 1.0 1 -rho [expr 2.0*$m]
+    } else {
+        node 1 1.0 -mass $m
+        element Truss 1 0 1 1.0 1
+    }
+    timeSeries Constant 1
+    pattern UniformExcitation 1 1 -accel 1 -fact $ag
+}
+
+buildBase $k $m $ag 0
+analysis Explicit
+analyze $numSteps [expr 0.5*$Tn/$numSteps]
+set u [nodeDisp 1 1]
+set uExact [expr -2.0*$m*$ag/$k]
+puts [format "  ground motion peak displacement %.6f exact %.6f" $u $uExact]
+if {abs($u - $uExact) > $tol*abs($uExact)} {
+    puts "  the ground motion response is outside the tolerance"
+    set testOK -1
+}
+
+buildBase $k $m $ag 1
+analysis Explicit
+if {[analyze 10 0.001] >= 0} {
+    puts "  a ground motion was accepted with the mass on the elements"
+    set testOK -1
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ExplicitAnalysis.tcl \n\n"
+    puts $results "| PASSED |  ExplicitAnalysis.tcl"
+} else {
+    puts "\nFAILED Verification Test ExplicitAnalysis.tcl \n\n"
+    puts $results "FAILED : ExplicitAnalysis.tcl"
+}
+close $results
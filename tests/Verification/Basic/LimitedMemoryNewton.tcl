@@ -0,0 +1,84 @@
+
+# Limited memory Newton
+#
+# A statically indeterminate three bar truss of bilinear steel is loaded
+# past the yield of its bars in ten load steps. The response found with
+# algorithm LBFGS and algorithm Anderson, with the current and with the
+# initial tangent, must match that found with Newton.
+
+puts "LimitedMemoryNewton.tcl: Verification of the LBFGS and Anderson algorithms"
+
+set testOK 0
+set tol 1.0e-6
+
+proc buildTruss {} {
+    wipe
+    model basic -ndm 2 -ndf 2
+
+    node 1 -100.0 100.0
+    node 2    0.0 100.0
+    node 3  100.0 100.0
+    node 4    0.0   0.0
+    fix 1 1 1
+    fix 2 1 1
+    fix 3 1 1
+
+    uniaxialMaterial Steel01 1 36.0 29000.0 0.02
+    element Truss 1 1 4 2.0 1
+    element Truss 2 2 4 1.0 1
+    element Truss 3 3 4 2.0 1
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load 4 60.0 -150.0
+    }
+
+    constraints Plain
+    numberer Plain
+    system BandGeneral
+    test NormDispIncr 1.0e-12 100 0
+    integrator LoadControl 0.1
+}
+
+proc displacements {} {
+    return [list [nodeDisp 4 1] [nodeDisp 4 2]]
+}
+
+buildTruss
+algorithm Newton
+analysis Static
+analyze 10
+set reference [displacements]
+set scale [expr max(abs([lindex $reference 0]), abs([lindex $reference 1]))]
+puts [format "  %-28s ux %.8f uy %.8f" Newton {*}$reference]
+
+foreach options {LBFGS {LBFGS -initial} Anderson {Anderson -initial}} {
+    buildTruss
+    algorithm {*}$options
+    analysis Static
+    if {[analyze 10] != 0} {
+        puts "  algorithm $options failed"
+        set testOK -1
+        continue
+    }
+
+    set u [displacements]
+    puts [format "  %-28s ux %.8f uy %.8f" $options {*}$u]
+    foreach a $u b $reference {
+        if {abs($a - $b) > $tol*$scale} {
+            puts "  algorithm $options differs from Newton"
+            set testOK -1
+        }
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test LimitedMemoryNewton.tcl \n\n"
+    puts $results "| PASSED |  LimitedMemoryNewton.tcl"
+} else {
+    puts "\nFAILED Verification Test LimitedMemoryNewton.tcl \n\n"
+    puts $results "FAILED : LimitedMemoryNewton.tcl"
+}
+close $results
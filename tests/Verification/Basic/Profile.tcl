@@ -0,0 +1,148 @@
+
+# Analysis profiler
+#
+# A five element truss is analyzed in 5 load steps with Newton under
+# profile on -elements.
+#
+# 1) profile report -json has the elapsed time, every phase and, for the
+#    Truss class, every element task, with counts that agree with the
+#    analysis: one commit and one record per step, one solve and test per
+#    tangent, and one element update, tangent and residual per element
+#    and domain update, tangent and unbalance.
+# 2) The columns of the text report line up with their headers.
+# 3) Nothing is counted while the profiler is off, and reset clears the
+#    totals.
+
+puts "Profile.tcl: Verification of the profile command"
+
+set testOK 0
+
+wipe
+model basic -ndm 2 -ndf 2
+node 1 0.0 0.0
+node 2 1.0 0.0
+node 3 2.0 0.0
+node 4 1.0 1.0
+fix 1 1 1
+fix 3 1 1
+uniaxialMaterial Elastic 1 1000.0
+element Truss 1 1 4 1.0 1
+element Truss 2 2 4 1.0 1
+element Truss 3 3 4 1.0 1
+element Truss 4 1 2 1.0 1
+element Truss 5 2 3 1.0 1
+set profNumEle 5
+set profNumSteps 5
+
+timeSeries Linear 1
+pattern Plain 1 1 {
+    load 4 1.0 -1.0
+}
+constraints Plain
+numberer Plain
+system BandGeneral
+test NormDispIncr 1.0e-10 10 0
+algorithm Newton
+integrator LoadControl [expr 1.0/$profNumSteps]
+analysis Static
+
+# the counts of a JSON report, in profCalls(phase) and profCalls(task)
+proc profileCounts {report} {
+    global profCalls testOK
+    array unset profCalls
+    if {![regexp {"elapsed": [0-9.eE+-]+} $report]} {
+        puts "  the report has no elapsed time"
+        set testOK -1
+    }
+    foreach key {formTangent formUnbalance solve test domainUpdate domainCommit record} {
+        if {![regexp [format {"%s": \{"calls": ([0-9]+), "seconds": [0-9.eE+-]+\}} $key] $report -> profCalls($key)]} {
+            puts "  the report has no phase $key"
+            set testOK -1
+            set profCalls($key) -1
+        }
+    }
+    set profCalls(classes) [regexp -all {"class": } $report]
+    foreach key {update tangent residual} {
+        set profCalls($key) 0
+        regexp [format {"class": "Truss".*"%s": \{"calls": ([0-9]+),} $key] $report -> profCalls($key)
+    }
+}
+
+#
+# 1) counts of the JSON report
+#
+profile reset
+profile on -elements
+analyze $profNumSteps
+profile off
+profileCounts [profile report -json]
+
+puts "  phases: [array get profCalls]"
+if {$profCalls(domainCommit) != $profNumSteps || $profCalls(record) != $profNumSteps} {
+    puts "  there is not one commit and record per step"
+    set testOK -1
+}
+if {$profCalls(formTangent) < $profNumSteps || $profCalls(solve) != $profCalls(formTangent)
+    || $profCalls(test) != $profCalls(solve)} {
+    puts "  there is not one solve and test per Newton iteration"
+    set testOK -1
+}
+if {$profCalls(classes) != 1
+    || $profCalls(update) != $profNumEle*$profCalls(domainUpdate)
+    || $profCalls(tangent) != $profNumEle*$profCalls(formTangent)
+    || $profCalls(residual) != $profNumEle*$profCalls(formUnbalance)} {
+    puts "  the element counts do not match the phases"
+    set testOK -1
+}
+
+#
+# 2) text report columns
+#
+# the end of each column after the first, a column being words apart by
+# single spaces
+proc columnEnds {line} {
+    set ends {}
+    foreach range [lrange [regexp -all -inline -indices {\S+(?: \S+)*} $line] 1 end] {
+        lappend ends [lindex $range 1]
+    }
+    return $ends
+}
+set profLines [split [string trimright [profile report] "\n"] "\n"]
+set profHeader ""
+foreach line [lrange $profLines 1 end] {
+    if {[regexp {^  (phase|element class) } $line]} {
+        set profHeader $line
+        continue
+    }
+    if {[columnEnds $line] != [columnEnds $profHeader]} {
+        puts "  columns do not line up with the header:\n$profHeader\n$line"
+        set testOK -1
+    }
+}
+
+#
+# 3) off and reset
+#
+analyze 2
+profileCounts [profile report -json]
+if {$profCalls(domainCommit) != $profNumSteps} {
+    puts "  steps were counted while the profiler was off"
+    set testOK -1
+}
+profile reset
+profileCounts [profile report -json]
+if {$profCalls(domainCommit) != 0 || $profCalls(solve) != 0 || $profCalls(classes) != 0} {
+    puts "  reset did not clear the totals"
+    set testOK -1
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test Profile.tcl \n\n"
+    puts $results "| PASSED |  Profile.tcl"
+} else {
+    puts "\nFAILED Verification Test Profile.tcl \n\n"
+    puts $results "FAILED : Profile.tcl"
+}
+close $results
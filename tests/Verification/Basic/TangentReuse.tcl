@@ -0,0 +1,104 @@
+
+# Tangent reuse
+#
+# 1) A linear spring loaded in ten steps with Newton -reuse: the tangent
+#    factored in the first step still contracts the residual, so it is
+#    kept for the following steps and the displacement is exact.
+# 2) A bilinear spring loaded past yield with ModifiedNewton -reuse. The
+#    elastic tangent kept from the earlier steps contracts the residual
+#    by only 1-b per iteration once the spring yields, so the algorithm
+#    must factor a new tangent for the step to converge within the
+#    iteration limit; the response must match that of Newton.
+
+puts "TangentReuse.tcl: Verification of the tangent reuse policy"
+
+set testOK 0
+set tol 1.0e-8
+
+set k  100.0
+set Fy 10.0
+set b  0.02
+
+# procedure to build a spring of the given material loaded by P in
+# ten load steps
+proc buildSpring {material P} {
+    wipe
+    model basic -ndm 1 -ndf 1
+    uniaxialMaterial {*}$material
+    node 1 0.0
+    node 2 0.0
+    fix 1 1
+    element zeroLength 1 1 2 -mat 1 -dir 1
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load 2 $P
+    }
+    constraints Plain
+    numberer Plain
+    system BandGeneral
+    test NormUnbalance 1.0e-10 8 0
+    integrator LoadControl 0.1
+}
+
+#
+# 1) reuse across steps
+#
+set P 5.0
+buildSpring [list Elastic 1 $k] $P
+algorithm Newton -reuse 0.5
+analysis Static
+if {[analyze 10] != 0} {
+    puts "  Newton -reuse failed on the linear spring"
+    set testOK -1
+}
+set u [nodeDisp 2 1]
+set saved [numFactSaved]
+puts [format "  linear spring u %.10f exact %.10f, factorizations saved %d" $u [expr $P/$k] $saved]
+if {abs($u - $P/$k) > $tol*$P/$k} {
+    puts "  displacement of the linear spring is wrong"
+    set testOK -1
+}
+if {$saved < 9} {
+    puts "  the tangent was not reused across the steps"
+    set testOK -1
+}
+
+#
+# 2) refactor when the contraction degrades
+#
+set P 15.0
+buildSpring [list Steel01 1 $Fy $k $b] $P
+algorithm Newton
+analysis Static
+analyze 10
+set reference [nodeDisp 2 1]
+
+buildSpring [list Steel01 1 $Fy $k $b] $P
+algorithm ModifiedNewton -reuse 0.1
+analysis Static
+set ok [analyze 10]
+set u [nodeDisp 2 1]
+set saved [numFactSaved]
+puts [format "  yielding spring u %.10f Newton %.10f, factorizations saved %d" $u $reference $saved]
+if {$ok != 0} {
+    puts "  ModifiedNewton -reuse did not factor a new tangent after yield"
+    set testOK -1
+} elseif {abs($u - $reference) > 1.0e-6*abs($reference)} {
+    puts "  displacement of the yielding spring differs from Newton"
+    set testOK -1
+}
+if {$saved < 1} {
+    puts "  the elastic tangent was not reused before yield"
+    set testOK -1
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test TangentReuse.tcl \n\n"
+    puts $results "| PASSED |  TangentReuse.tcl"
+} else {
+    puts "\nFAILED Verification Test TangentReuse.tcl \n\n"
+    puts $results "FAILED : TangentReuse.tcl"
+}
+close $results
@@ -0,0 +1,312 @@
+
+# Transformation constraint handler
+#
+# The Transformation handler condenses the constrained DOFs out of each
+# element with T^t K T, keeping the nonzeros of each node's T between
+# steps unless its MP_Constraint is time varying.
+#
+# 1) A one story 3D frame with a rigid diaphragm whose master node has
+#    SPs, a fixity on a retained DOF of a constrained node, and a second
+#    level tied to it with equalDOF; one linear step. The displacements
+#    are compared with those of the Penalty handler, which does not
+#    transform the elements and agrees to the order of the stiffness over
+#    the penalty. (Lagrange takes only square constraint matrices.)
+# 2) A 2D frame with a Joint2D beam-column joint under large displacements,
+#    whose MP_Constraints are time varying, in ten load steps. The
+#    displacements are compared with those of the same analysis built
+#    afresh at every step, so that every T is formed anew.
+# 3) A 2D and a 3D portal frame whose beam nodes follow a mid-span node
+#    through one rigidLink beam with several constrained nodes; the
+#    displacements are compared with those of one rigidLink beam per
+#    constrained node.
+# 4) A rigidLink beam with a node that does not exist fails and leaves no
+#    constraint behind: the displacements are those of the frame without
+#    the link.
+
+puts "TransformationConstraints.tcl: Verification of the Transformation handler"
+
+set testOK 0
+
+proc setAnalysis {handler steps} {
+    constraints {*}$handler
+    numberer RCM
+    system FullGeneral
+    test NormDispIncr 1.0e-8 20 0
+    algorithm Newton
+    integrator LoadControl [expr 1.0/$steps]
+    analysis Static
+}
+
+# procedure to analyze the model made by build with the Transformation
+# handler and with the reference, either another handler or "rebuilt",
+# and compare the displacements
+proc compare {title build steps reference tol} {
+    set response {}
+    foreach run [list Transformation $reference] {
+        eval $build
+        if {$run == "rebuilt"} {
+            set ok 0
+            for {set i 0} {$i < $steps} {incr i} {
+                wipeAnalysis
+                setAnalysis Transformation $steps
+                set ok [expr $ok + [analyze 1]]
+            }
+        } else {
+            setAnalysis $run $steps
+            set ok [analyze $steps]
+        }
+        if {$ok != 0} {
+            puts "  $title: the analysis with $run failed"
+            return -1
+        }
+        set u {}
+        foreach node [lsort -integer [getNodeTags]] {
+            lappend u {*}[nodeDisp $node]
+        }
+        lappend response $u
+    }
+
+    set scale 0.0
+    set error 0.0
+    foreach a [lindex $response 0] b [lindex $response 1] {
+        set scale [expr max($scale, abs($b))]
+        set error [expr max($error, abs($a - $b))]
+    }
+    puts [format "  %-34s max difference %.3e of %.3e" $title $error $scale]
+    if {$error > $tol*$scale} {
+        return -1
+    }
+    return 0
+}
+
+#
+# 1) 3D frame
+#
+proc frame3d {} {
+    wipe
+    model basic -ndm 3 -ndf 6
+
+    set L 240.0
+    set H 144.0
+    set E 29000.0
+    set G 11200.0
+
+    node 1  0.0 0.0 0.0
+    node 2  $L  0.0 0.0
+    node 3  $L  $L  0.0
+    node 4  0.0 $L  0.0
+    node 5  0.0 0.0 $H
+    node 6  $L  0.0 $H
+    node 7  $L  $L  $H
+    node 8  0.0 $L  $H
+    node 9  [expr $L/2] [expr $L/2] $H
+    node 10 $L  0.0 [expr 2*$H]
+    node 11 $L  $L  [expr 2*$H]
+
+    foreach n {1 2 3 4} {
+        fix $n 1 1 1 1 1 1
+    }
+    fix 9 0 0 1 1 1 0
+    fix 5 0 0 0 1 0 0
+
+    rigidDiaphragm 3 9 5 6 7 8
+    equalDOF 10 11 1
+
+    geomTransf Linear 1 1.0 0.0 0.0
+    geomTransf Linear 2 0.0 0.0 1.0
+    set A 20.0; set Iz 1400.0; set Iy 600.0; set J 50.0
+    set e 1
+    foreach {i j} {1 5 2 6 3 7 4 8 6 10 7 11} {
+        element elasticBeamColumn $e $i $j $A $E $G $J $Iy $Iz 1
+        incr e
+    }
+    foreach {i j} {5 6 6 7 7 8 8 5 10 11} {
+        element elasticBeamColumn $e $i $j $A $E $G $J $Iy $Iz 2
+        incr e
+    }
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load 9  20.0 10.0 0.0 0.0 0.0 500.0
+        load 10  5.0  0.0 -10.0 0.0 0.0 0.0
+        load 11  0.0  8.0 -10.0 0.0 0.0 0.0
+    }
+}
+
+if {[compare "3D frame, rigidDiaphragm, equalDOF" frame3d 1 {Penalty 1.0e12 1.0e12} 1.0e-6] != 0} {
+    set testOK -1
+}
+
+#
+# 2) Joint2D with large displacements
+#
+proc joint2d {} {
+    wipe
+    model basic -ndm 2 -ndf 3
+
+    set H 144.0
+    set L 240.0
+    set d 10.0
+    set E 29000.0
+
+    # column, joint and beam; the joint's center node is 100
+    node 1 0.0 0.0
+    node 2 0.0 [expr $H - $d]
+    node 3 $d  $H
+    node 4 0.0 [expr $H + $d]
+    node 5 [expr -$d] $H
+    node 6 $L  $H
+    node 7 0.0 [expr $H + $d + 60.0]
+    fix 1 1 1 1
+    fix 6 0 1 0
+
+    uniaxialMaterial Elastic 1 1.0e7
+    element Joint2D 10 3 4 5 2 100 1 1
+
+    geomTransf Corotational 1
+    element elasticBeamColumn 1 1 2 20.0 $E 800.0 1
+    element elasticBeamColumn 2 3 6 15.0 $E 600.0 1
+    element elasticBeamColumn 3 4 7 10.0 $E 200.0 1
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load 7 40.0 -20.0 0.0
+        load 6  0.0   0.0 500.0
+    }
+}
+
+if {[compare "Joint2D, large displacements" joint2d 10 rebuilt 1.0e-8] != 0} {
+    set testOK -1
+}
+
+# procedure to analyze the model made by build in one linear step with
+# the Transformation handler, returning the displacements of all nodes
+proc solveFrame {build} {
+    eval $build
+    setAnalysis Transformation 1
+    if {[analyze 1] != 0} {
+        return {}
+    }
+    set u {}
+    foreach node [lsort -integer [getNodeTags]] {
+        lappend u {*}[nodeDisp $node]
+    }
+    return $u
+}
+
+proc maxDifference {a b} {
+    set error 0.0
+    foreach x $a y $b {
+        set error [expr max($error, abs($x - $y))]
+    }
+    return $error
+}
+
+# portal frame of 2 or 3 dimensions with its beam nodes 2, 3 and, in 3D,
+# 6 and 7 tied to the mid-span node 5 by the command link, with %s for
+# the constrained nodes; node 5 has beams of its own, so the frame is
+# stable without the link
+proc portal {ndm link} {
+    wipe
+    set L 240.0
+    set H 144.0
+    set E 29000.0
+
+    if {$ndm == 2} {
+        model basic -ndm 2 -ndf 3
+        node 1 0.0 0.0
+        node 2 0.0 $H
+        node 3 $L  $H
+        node 4 $L  0.0
+        node 5 [expr $L/2] $H
+        fix 1 1 1 1
+        fix 4 1 1 1
+        geomTransf Linear 1
+        foreach {e i j} {1 1 2 2 4 3 3 2 5 4 5 3} {
+            element elasticBeamColumn $e $i $j 20.0 $E 1400.0 1
+        }
+        set constrained {2 3}
+        timeSeries Linear 1
+        pattern Plain 1 1 {
+            load 5 20.0 -10.0 0.0
+            load 3  0.0 -10.0 100.0
+        }
+    } else {
+        model basic -ndm 3 -ndf 6
+        node 1 0.0 0.0 0.0
+        node 2 0.0 0.0 $H
+        node 3 $L  0.0 $H
+        node 4 $L  0.0 0.0
+        node 5 [expr $L/2] [expr $L/2] $H
+        node 6 0.0 $L  $H
+        node 7 $L  $L  $H
+        node 8 0.0 $L  0.0
+        node 9 $L  $L  0.0
+        foreach n {1 4 8 9} {
+            fix $n 1 1 1 1 1 1
+        }
+        geomTransf Linear 1 1.0 0.0 0.0
+        geomTransf Linear 2 0.0 0.0 1.0
+        set e 1
+        foreach {i j} {1 2 4 3 8 6 9 7} {
+            element elasticBeamColumn $e $i $j 20.0 $E 11200.0 50.0 600.0 1400.0 1
+            incr e
+        }
+        foreach {i j} {2 3 3 7 7 6 6 2 2 5 5 7} {
+            element elasticBeamColumn $e $i $j 20.0 $E 11200.0 50.0 600.0 1400.0 2
+            incr e
+        }
+        set constrained {2 3 6 7}
+        timeSeries Linear 1
+        pattern Plain 1 1 {
+            load 5 20.0 10.0 -5.0 0.0 0.0 500.0
+            load 7  0.0  0.0 -10.0 100.0 0.0 0.0
+        }
+    }
+
+    eval [format $link $constrained]
+}
+
+#
+# 3) one rigidLink beam with several constrained nodes
+#
+foreach ndm {2 3} {
+    set several [solveFrame [list portal $ndm {rigidLink beam 5 %s}]]
+    set perNode [solveFrame [list portal $ndm {foreach c {%s} {rigidLink beam 5 $c}}]]
+    set error [maxDifference $several $perNode]
+    puts [format "  %-34s max difference %.3e" "${ndm}D rigidLink beam, several nodes" $error]
+    if {[llength $several] == 0 || [llength $several] != [llength $perNode] || $error > 1.0e-12} {
+        puts "  one rigidLink beam with several nodes differs from one per node"
+        set testOK -1
+    }
+}
+
+#
+# 4) a rigidLink beam that fails leaves nothing behind
+#
+foreach ndm {2 3} {
+    set failed [solveFrame [list portal $ndm {
+        if {![catch {rigidLink beam 5 %s 99}]} {
+            puts "  rigidLink beam with a missing node did not fail"
+            set ::testOK -1
+        }
+    }]]
+    set noLink [solveFrame [list portal $ndm {}]]
+    set error [maxDifference $failed $noLink]
+    puts [format "  %-34s max difference %.3e" "${ndm}D failed rigidLink beam" $error]
+    if {[llength $failed] == 0 || [llength $failed] != [llength $noLink] || $error > 1.0e-12} {
+        puts "  a failed rigidLink beam left constraints in the domain"
+        set testOK -1
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test TransformationConstraints.tcl \n\n"
+    puts $results "| PASSED |  TransformationConstraints.tcl"
+} else {
+    puts "\nFAILED Verification Test TransformationConstraints.tcl \n\n"
+    puts $results "FAILED : TransformationConstraints.tcl"
+}
+close $results
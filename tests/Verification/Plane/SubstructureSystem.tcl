@@ -0,0 +1,104 @@
+
+# Substructure system of equations
+#
+# A plane stress cantilever meshed with nx by ny quads is loaded at the
+# tip in ten load steps with the initial tangent, so every step after the
+# first solves again with the same factors. The displacements found with
+# the threaded substructuring solver are compared with those of the
+# banded general solver.
+
+puts "SubstructureSystem.tcl: Verification of the substructure solver against BandGen"
+
+set testOK 0
+set tol 1.0e-10
+
+set L 10.0
+set H 1.0
+set nx 40
+set ny 4
+
+proc buildModel {} {
+    global L H nx ny
+
+    wipe
+    model basic -ndm 2 -ndf 2
+    nDMaterial ElasticIsotropic 1 200.0e6 0.3
+
+    for {set i 0} {$i <= $nx} {incr i} {
+        for {set j 0} {$j <= $ny} {incr j} {
+            node [expr $i*($ny+1) + $j + 1] [expr $i*$L/$nx] [expr $j*$H/$ny]
+        }
+    }
+    for {set i 0} {$i < $nx} {incr i} {
+        for {set j 0} {$j < $ny} {incr j} {
+            set n1 [expr $i*($ny+1) + $j + 1]
+            set n2 [expr $n1 + $ny + 1]
+            element quad [expr $i*$ny + $j + 1] $n1 $n2 [expr $n2+1] [expr $n1+1] 0.1 "PlaneStress" 1
+        }
+    }
+    for {set j 0} {$j <= $ny} {incr j} {
+        fix [expr $j + 1] 1 1
+    }
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load [expr $nx*($ny+1) + 1]  0.0 -100.0
+        load [expr ($nx+1)*($ny+1)] 50.0 -100.0
+    }
+
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-12 10 0
+    algorithm ModifiedNewton -initial
+    integrator LoadControl 0.1
+}
+
+proc displacements {} {
+    set u {}
+    foreach node [getNodeTags] {
+        lappend u [nodeDisp $node 1] [nodeDisp $node 2]
+    }
+    return $u
+}
+
+buildModel
+system BandGen
+analysis Static
+analyze 10
+set reference [displacements]
+
+set scale 0.0
+foreach value $reference {
+    set scale [expr max($scale, abs($value))]
+}
+
+foreach options {{-parts 1} {-parts 4 -threads 2} {-parts 7 -threads 3}} {
+    buildModel
+    system Substructure {*}$options
+    analysis Static
+    if {[analyze 10] != 0} {
+        puts "  analysis with system Substructure $options failed"
+        set testOK -1
+        continue
+    }
+
+    set error 0.0
+    foreach a [displacements] b $reference {
+        set error [expr max($error, abs($a - $b))]
+    }
+    puts [format "  system Substructure %-22s max difference %.3e" $options $error]
+    if {$error > $tol*$scale} {
+        set testOK -1
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test SubstructureSystem.tcl \n\n"
+    puts $results "| PASSED |  SubstructureSystem.tcl"
+} else {
+    puts "\nFAILED Verification Test SubstructureSystem.tcl \n\n"
+    puts $results "FAILED : SubstructureSystem.tcl"
+}
+close $results
@@ -0,0 +1,181 @@
+
+# Model changes between analyses
+#
+# 1) A linear elastic truss is changed between calls to analyze: elements
+#    are removed and added (which updates the analysis in place), then
+#    nodes, a fixity and an equalDOF constraint are added and removed
+#    (which rebuild it), and finally fixities and a prescribed
+#    displacement are added to and removed from existing nodes (which
+#    update the penalty constraints in place). After each change the
+#    displacements must match those of the same sequence of changes
+#    analyzed with an analysis that is wiped and built afresh after
+#    every change. Elements added to nodes that have already displaced
+#    start unstrained, so the reference has to go through the same
+#    sequence rather than build each stage at once.
+# 2) A uniform load added to a cantilever in analysis, in a new pattern,
+#    must be applied by the next analyze, and removing the pattern must
+#    remove it again.
+
+puts "ModelChanges.tcl: Verification of model changes between analyses"
+
+set testOK 0
+set tol 1.0e-8
+
+#
+# the changes made at each stage
+#
+set stages {
+    {}
+    {remove element 5}
+    {element Truss 9 2 4 2.0 1}
+    {node 5 200.0 0.0; fix 5 1 1; element Truss 6 2 5 1.0 1; element Truss 7 3 5 1.5 1}
+    {node 6 200.0 100.0; element Truss 8 5 6 1.0 1; equalDOF 3 6 1}
+    {remove element 8; remove mp 6; remove node 6}
+    {fix 3 0 1}
+    {sp remove 3 2}
+    {pattern Plain 2 1 {sp 2 1 0.01}}
+    {sp remove 2 1 2; remove loadPattern 2}
+}
+
+proc baseModel {} {
+    wipe
+    model basic -ndm 2 -ndf 2
+    uniaxialMaterial Elastic 1 29000.0
+
+    node 1   0.0   0.0
+    node 2 100.0   0.0
+    node 3 100.0 100.0
+    node 4   0.0 100.0
+    fix 1 1 1
+    fix 2 0 1
+    fix 4 1 1
+
+    element Truss 1 1 2 1.0 1
+    element Truss 2 2 3 1.0 1
+    element Truss 3 3 4 1.0 1
+    element Truss 4 1 3 1.0 1
+    element Truss 5 2 4 1.0 1
+
+    timeSeries Constant 1
+    pattern Plain 1 1 {
+        load 3 10.0 -5.0
+    }
+}
+
+proc setAnalysis {{alpha 1.0e8}} {
+    constraints Penalty $alpha $alpha
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10 0
+    algorithm Newton
+    integrator LoadControl 1.0
+    analysis Static
+}
+
+proc displacements {} {
+    set u {}
+    foreach node [lsort -integer [getNodeTags]] {
+        lappend u $node [nodeDisp $node 1] [nodeDisp $node 2]
+    }
+    return $u
+}
+
+#
+# the reference, with a fresh analysis after each change
+#
+set numStages [llength $stages]
+baseModel
+for {set s 0} {$s < $numStages} {incr s} {
+    eval [lindex $stages $s]
+    wipeAnalysis
+    setAnalysis
+    analyze 1
+    set fresh($s) [displacements]
+}
+
+#
+# one model, changed in place
+#
+baseModel
+setAnalysis
+for {set s 0} {$s < $numStages} {incr s} {
+    eval [lindex $stages $s]
+    if {[analyze 1] != 0} {
+        puts "  analysis failed after stage $s"
+        set testOK -1
+        continue
+    }
+
+    set u [displacements]
+    if {[llength $u] != [llength $fresh($s)]} {
+        puts "  stage $s has nodes [getNodeTags], the fresh model others"
+        set testOK -1
+        continue
+    }
+
+    set scale 0.0
+    set error 0.0
+    foreach {node ux uy} $u {nodeRef uxRef uyRef} $fresh($s) {
+        set scale [expr max($scale, abs($uxRef), abs($uyRef))]
+        set error [expr max($error, abs($ux - $uxRef), abs($uy - $uyRef))]
+    }
+    puts [format "  stage %d: %-60s max difference %.3e" $s [lindex $stages $s] $error]
+    if {$error > $tol*$scale} {
+        set testOK -1
+    }
+}
+
+#
+# 2) an elemental load added in analysis
+#
+set beamL 100.0
+set beamE 29000.0
+set beamI 100.0
+set beamW -0.1
+
+wipe
+model basic -ndm 2 -ndf 3
+node 1 0.0 0.0
+node 2 $beamL 0.0
+fix 1 1 1 1
+geomTransf Linear 1
+element elasticBeamColumn 1 1 2 10.0 $beamE $beamI 1
+timeSeries Constant 1
+pattern Plain 1 1 {
+    load 2 0.0 0.0 0.0
+}
+# stiff enough that the penalty does not let the support rotate
+setAnalysis 1.0e12
+analyze 1
+
+pattern Plain 2 1 {
+    eleLoad -ele 1 -type -beamUniform $beamW
+}
+analyze 1
+set tip [nodeDisp 2 2]
+set exact [expr $beamW*pow($beamL,4)/(8.0*$beamE*$beamI)]
+puts [format "  eleLoad added in analysis: tip %.6e exact %.6e" $tip $exact]
+if {abs($tip - $exact) > 1.0e-6*abs($exact)} {
+    puts "  the elemental load added in analysis was not applied"
+    set testOK -1
+}
+
+remove loadPattern 2
+analyze 1
+set tip [nodeDisp 2 2]
+puts [format "  eleLoad removed:           tip %.6e" $tip]
+if {abs($tip) > 1.0e-6*abs($exact)} {
+    puts "  the removed elemental load is still applied"
+    set testOK -1
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ModelChanges.tcl \n\n"
+    puts $results "| PASSED |  ModelChanges.tcl"
+} else {
+    puts "\nFAILED Verification Test ModelChanges.tcl \n\n"
+    puts $results "FAILED : ModelChanges.tcl"
+}
+close $results
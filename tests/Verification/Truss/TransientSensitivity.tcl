@@ -0,0 +1,122 @@
+# Transient response sensitivity
+#
+# A fixed-free chain of 20 trusses of different moduli carries a lumped
+# mass at every node and a step load at the free end. The sensitivities
+# of the nodal displacements to the modulus of each truss, computed by
+# the direct differentiation method with the Newmark integrator and its
+# generalized form, must match central finite differences after 10
+# steps. With 20 parameters the sensitivities are solved in more than
+# one block of parameters.
+
+puts "TransientSensitivity.tcl: Verification of transient DDM sensitivities"
+
+set testOK 0
+
+set numEle 20
+set numSteps 10
+set dt 0.01
+set P 100.0
+set L 10.0
+set A 1.0
+set m 0.5
+
+proc modulus {i} {
+    return [expr 1.0e4*(1.0 + 0.05*$i)]
+}
+
+# procedure to build the chain, with the modulus of truss pertTruss
+# scaled by pertFactor, and run the transient analysis; returns the
+# displacements of the free nodes
+proc runChain {integrator {pertTruss 0} {pertFactor 1.0} {sensitivity 0}} {
+    global numEle numSteps dt P L A m
+
+    wipe
+    model basic -ndm 2 -ndf 2
+    node 0 0.0 0.0
+    fix 0 1 1
+    for {set i 1} {$i <= $numEle} {incr i} {
+        node $i [expr $i*$L] 0.0 -mass $m $m
+        fix $i 0 1
+        set E [modulus $i]
+        if {$i == $pertTruss} {
+            set E [expr $E*$pertFactor]
+        }
+        uniaxialMaterial Elastic $i $E
+        element Truss $i [expr $i-1] $i $A $i
+    }
+    timeSeries Constant 1
+    pattern Plain 1 1 {
+        load $numEle $P 0.0
+    }
+
+    if {$sensitivity} {
+        for {set i 1} {$i <= $numEle} {incr i} {
+            parameter $i element $i E
+        }
+    }
+
+    constraints Plain
+    numberer Plain
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10 0
+    algorithm Linear
+    integrator {*}$integrator
+    if {$sensitivity} {
+        sensitivityAlgorithm -computeAtEachStep
+    }
+    analysis Transient
+    analyze $numSteps $dt
+
+    set response {}
+    for {set i 1} {$i <= $numEle} {incr i} {
+        lappend response [nodeDisp $i 1]
+    }
+    return $response
+}
+
+foreach integrator {{Newmark 0.5 0.25} {Newmark 0.5 0.25 -alpha 1.0}} {
+    runChain $integrator 0 1.0 1
+    set uMax 0.0
+    for {set i 1} {$i <= $numEle} {incr i} {
+        set uMax [expr max($uMax, abs([nodeDisp $i 1]))]
+        for {set j 1} {$j <= $numEle} {incr j} {
+            set ddm($i,$j) [sensNodeDisp $i 1 $j]
+        }
+    }
+
+    set h 1.0e-5
+    set maxError 0.0
+    set worst 0
+    for {set j 1} {$j <= $numEle} {incr j} {
+        set E [modulus $j]
+        set plus  [runChain $integrator $j [expr 1.0 + $h]]
+        set minus [runChain $integrator $j [expr 1.0 - $h]]
+        for {set i 1} {$i <= $numEle} {incr i} {
+            set fd [expr ([lindex $plus [expr $i-1]] - [lindex $minus [expr $i-1]])/(2.0*$h*$E)]
+            # relative to the response of a unit change in the modulus
+            set error [expr abs($ddm($i,$j) - $fd)*$E/$uMax]
+            if {$error > $maxError} {
+                set maxError $error
+                set worst $j
+            }
+        }
+    }
+    wipe
+
+    puts [format "  %-28s %d parameters, largest difference %.3e (parameter %d)" \
+              $integrator $numEle $maxError $worst]
+    if {$uMax == 0.0 || $maxError > 1.0e-6} {
+        puts "  DDM sensitivities differ from the finite differences"
+        set testOK -1
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test TransientSensitivity.tcl \n\n"
+    puts $results "| PASSED |  TransientSensitivity.tcl"
+} else {
+    puts "\nFAILED Verification Test TransientSensitivity.tcl \n\n"
+    puts $results "FAILED : TransientSensitivity.tcl"
+}
+close $results
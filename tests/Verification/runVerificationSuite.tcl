@@ -11,18 +11,28 @@ source sdofTransient.tcl
 source SmallEigen.tcl
 source NewmarkIntegrator.tcl
 source mdofModal.tcl
+source ExplicitAnalysis.tcl
+source CriticalTimeStep.tcl
+source Profile.tcl
+source TangentReuse.tcl
+source LimitedMemoryNewton.tcl
+source AdaptiveStep.tcl
 cd ..
 
 source Truss/PlanarTruss.tcl
 source Truss/PlanarTruss.Extra.tcl
+source Truss/ModelChanges.tcl
+source Truss/TransientSensitivity.tcl
 
 source Frame/PortalFrame2d.tcl
 source Frame/EigenFrame.tcl
 source Frame/EigenFrame.Extra.tcl
 source Frame/AISC25.tcl
+source Frame/TransformationConstraints.tcl
 
 source Plane/PlaneStrain.tcl
 source Plane/QuadBending.tcl
+source Plane/SubstructureSystem.tcl
 
 # Shells
 source Shell/PinchedCylinder.tcl